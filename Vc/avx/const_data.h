@@ -37,8 +37,8 @@ namespace AVX
 {
 
 alignas(64) extern const unsigned int   _IndexesFromZero32[ 8];
-alignas(16) extern const unsigned short _IndexesFromZero16[16];
-alignas(16) extern const unsigned char  _IndexesFromZero8 [32];
+alignas(32) extern const unsigned short _IndexesFromZero16[16];
+alignas(32) extern const unsigned char  _IndexesFromZero8 [32];
 
 struct alignas(64) c_general
 {
@@ -54,6 +54,12 @@ struct alignas(64) c_general
     static const unsigned long long highMaskDouble;
 };
 
+struct c_compress
+{
+    alignas(64) static const unsigned int compress8[256];
+    alignas(64) static const unsigned int expand8[256];
+};
+
 template<typename T> struct c_trig
 {
     alignas(64) static const T data[];
@@ -431,6 +431,11 @@ Vc_INTRINSIC __m256 load(const short *mem, Flags f, LoadTag<__m256, float>)
 {
     return AVX::convert<short, float>(load16(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const float16 *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AvxIntrinsics::cvtph_ps(load16(aliasing_cast<ushort>(mem), f));
+}
 /*
 template<typename Flags> struct LoadHelper<float, unsigned char, Flags> {
     static __m256 load(const unsigned char *mem, Flags)
@@ -602,6 +607,10 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+Vc_INTRINSIC Vc_CONST __m256i one( llong) { return _mm256_set1_epi64x(1); }
+Vc_INTRINSIC Vc_CONST __m256i one(ullong) { return _mm256_set1_epi64x(1); }
+Vc_INTRINSIC Vc_CONST __m256i one(  long) { return _mm256_set1_epi64x(1); }
+Vc_INTRINSIC Vc_CONST __m256i one( ulong) { return _mm256_set1_epi64x(1); }
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -620,6 +629,14 @@ Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::
 {
     return AVX::sign_epi16(v, Detail::allone<__m256i>());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return AVX::sub_epi64(_mm256_setzero_si256(), v);
+}
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return AVX::sign_epi8(v, Detail::allone<__m256i>());
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m256 xor_(__m256 a, __m256 b) { return _mm256_xor_ps(a, b); }
@@ -691,6 +708,10 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+Vc_INTRINSIC __m256i abs(__m256i a,  llong) { return AVX::abs_epi64(a); }
+Vc_INTRINSIC __m256i abs(__m256i a, ullong) { return a; }
+Vc_INTRINSIC __m256i abs(__m256i a,   long) { return AVX::abs_epi64(a); }
+Vc_INTRINSIC __m256i abs(__m256i a,  ulong) { return a; }
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +720,12 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  llong) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ullong) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   long) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  ulong) { return AVX::add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +734,12 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  llong) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ullong) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   long) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  ulong) { return AVX::sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,8 +748,14 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
-
-// mul{{{1
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) { return AVX::mullo_epi8 (a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar) { return AVX::mullo_epi8 (a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  llong) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ullong) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   long) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  ulong) { return AVX::mullo_epi64(a, b); }
+
+// div{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
 Vc_INTRINSIC __m256d div(__m256d a, __m256d b, double) { return _mm256_div_pd(a, b); }
 Vc_INTRINSIC __m256i div(__m256i a, __m256i b,    int) {
@@ -756,6 +795,26 @@ Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  short) {
         _mm256_div_ps(convert<short, float>(hi128(a)), convert<short, float>(hi128(b)));
     return concat(convert<float, short>(lo), convert<float, short>(hi));
 }
+#ifdef Vc_IMPL_AVX2
+// the 8-bit quotients are exact in 16 bits; -128 / -1 wraps like the scalar conversion
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  schar) {
+    using namespace AVX;
+    const __m256i m = _mm256_set1_epi16(0xff);
+    const __m256i lo = and_si256(
+        div(_mm256_cvtepi8_epi16(lo128(a)), _mm256_cvtepi8_epi16(lo128(b)), short()), m);
+    const __m256i hi = and_si256(
+        div(_mm256_cvtepi8_epi16(hi128(a)), _mm256_cvtepi8_epi16(hi128(b)), short()), m);
+    return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packus_epi16(lo, hi));
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  uchar) {
+    using namespace AVX;
+    const __m256i lo =
+        div(_mm256_cvtepu8_epi16(lo128(a)), _mm256_cvtepu8_epi16(lo128(b)), short());
+    const __m256i hi =
+        div(_mm256_cvtepu8_epi16(hi128(a)), _mm256_cvtepu8_epi16(hi128(b)), short());
+    return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packus_epi16(lo, hi));
+}
+#endif  // Vc_IMPL_AVX2
 
 // horizontal add{{{1
 template <typename T> Vc_INTRINSIC T add(Common::IntrinsicType<T, 32 / sizeof(T)> a, T)
@@ -787,6 +846,12 @@ Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,    int) { return AvxIntrinsics:
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,   uint) { return AvxIntrinsics::cmpeq_epi32(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  short) { return AvxIntrinsics::cmpeq_epi16(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ushort) { return AvxIntrinsics::cmpeq_epi16(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  schar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  uchar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  llong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ullong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,   long) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  ulong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
 
 // cmpneq{{{1
 Vc_INTRINSIC __m256  cmpneq(__m256  a, __m256  b,  float) { return AvxIntrinsics::cmpneq_ps(a, b); }
@@ -797,6 +862,10 @@ Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  short) { return not_(AvxIntri
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ushort) { return not_(AvxIntrinsics::cmpeq_epi16(a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  schar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  uchar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  llong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ullong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,   long) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  ulong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
 
 // cmpgt{{{1
 Vc_INTRINSIC __m256  cmpgt(__m256  a, __m256  b,  float) { return AVX::cmpgt_ps(a, b); }
@@ -807,6 +876,10 @@ Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  llong) { return AVX::cmpgt_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ullong) { return AVX::cmpgt_epu64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,   long) { return AVX::cmpgt_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  ulong) { return AVX::cmpgt_epu64(a, b); }
 
 // cmpge{{{1
 Vc_INTRINSIC __m256  cmpge(__m256  a, __m256  b,  float) { return AVX::cmpge_ps(a, b); }
@@ -817,6 +890,10 @@ Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  llong) { return not_(AVX::cmpgt_epi64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ullong) { return not_(AVX::cmpgt_epu64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,   long) { return not_(AVX::cmpgt_epi64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  ulong) { return not_(AVX::cmpgt_epu64(b, a)); }
 
 // cmple{{{1
 Vc_INTRINSIC __m256  cmple(__m256  a, __m256  b,  float) { return AVX::cmple_ps(a, b); }
@@ -827,6 +904,10 @@ Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  llong) { return not_(AVX::cmpgt_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ullong) { return not_(AVX::cmpgt_epu64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,   long) { return not_(AVX::cmpgt_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  ulong) { return not_(AVX::cmpgt_epu64(a, b)); }
 
 // cmplt{{{1
 Vc_INTRINSIC __m256  cmplt(__m256  a, __m256  b,  float) { return AVX::cmplt_ps(a, b); }
@@ -837,6 +918,10 @@ Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  llong) { return AVX::cmpgt_epi64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ullong) { return AVX::cmpgt_epu64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,   long) { return AVX::cmpgt_epi64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  ulong) { return AVX::cmpgt_epu64(b, a); }
 
 // fma{{{1
 Vc_INTRINSIC __m256 fma(__m256  a, __m256  b, __m256  c,  float) {
@@ -890,30 +975,46 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  llong) { return AVX::sra_epi64(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ullong) { return AVX::srli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   long) { return AVX::sra_epi64(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  ulong) { return AVX::srli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::sra_epi8(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srl_epi8(a, shift); }
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  llong) { return AVX::sra_epi64(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ullong) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   long) { return AVX::sra_epi64(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  ulong) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8(a, shift); }
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  llong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ullong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   long) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  ulong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::sll_epi8(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::sll_epi8(a, shift); }
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  llong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ullong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   long) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  ulong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8(a, shift); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8(a, shift); }
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,6 +1034,10 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+Vc_INTRINSIC __m256i avx_broadcast( llong x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(ullong x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(  long x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast( ulong x) { return _mm256_set1_epi64x(x); }
 
 // sorted{{{1
 template <Vc::Implementation Impl, typename T,
@@ -1169,6 +1274,33 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 16), V> rotated(
     }
     return avx_cast<V>(_mm256_setzero_ps());
 }
+
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 32), V> rotated(
+    V v, int amount)
+{
+    using namespace AVX;
+    const __m128i vLo = avx_cast<__m128i>(lo128(v));
+    const __m128i vHi = avx_cast<__m128i>(hi128(v));
+    switch (static_cast<unsigned int>(amount) % N) {
+    case 0:
+        return v;
+#define Vc_CASE_(k_)                                                                     \
+    case k_:                                                                             \
+        return avx_cast<V>(                                                              \
+            concat(SSE::alignr_epi8<k_>(vHi, vLo), SSE::alignr_epi8<k_>(vLo, vHi)));     \
+    case k_ + 16:                                                                        \
+        return avx_cast<V>(                                                              \
+            concat(SSE::alignr_epi8<k_>(vLo, vHi), SSE::alignr_epi8<k_>(vHi, vLo)))
+        Vc_CASE_(1); Vc_CASE_(2); Vc_CASE_(3); Vc_CASE_(4); Vc_CASE_(5);
+        Vc_CASE_(6); Vc_CASE_(7); Vc_CASE_(8); Vc_CASE_(9); Vc_CASE_(10);
+        Vc_CASE_(11); Vc_CASE_(12); Vc_CASE_(13); Vc_CASE_(14); Vc_CASE_(15);
+#undef Vc_CASE_
+    case 16:
+        return Mem::permute128<X1, X0>(v);
+    }
+    return avx_cast<V>(_mm256_setzero_ps());
+}
 #endif  // Vc_IMPL_AVX2
 
 // testc{{{1
@@ -1314,12 +1446,14 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<8>(__m256i k)
 {
     return movemask(AVX::avx_cast<__m256>(k));
 }
-#ifdef Vc_IMPL_BMI2
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
 {
+#ifdef Vc_IMPL_BMI2
     return _pext_u32(movemask(k), 0x55555555u);
-}
+#else
+    return _mm_movemask_epi8(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k)));
 #endif
+}
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
 {
     return movemask(k);
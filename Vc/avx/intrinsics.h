@@ -149,6 +149,7 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m128i Vc_CONST _mm_setmin_epi32() { return _mm_castps_si128(_mm_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi16() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(c_general::minShort))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi32() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
+    static Vc_INTRINSIC m256i Vc_CONST setmin_epi64() { return _mm256_castpd_si256(_mm256_broadcast_sd(reinterpret_cast<const double *>(&c_general::signMaskFloat[0]))); }
 
     template <int i>
     static Vc_INTRINSIC Vc_CONST unsigned char extract_epu8(__m128i x)
@@ -558,6 +559,55 @@ static Vc_INTRINSIC m256i cmplt_epu8(__m256i a, __m256i b) {
 static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     return cmpgt_epi8(xor_si256(a, setmin_epi8()), xor_si256(b, setmin_epi8()));
 }
+static Vc_INTRINSIC m256i cmpgt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epi64(xor_si256(a, setmin_epi64()), xor_si256(b, setmin_epi64()));
+}
+static Vc_INTRINSIC m256i max_epi64(__m256i a, __m256i b) {
+    return blendv_epi8(b, a, cmpgt_epi64(a, b));
+}
+static Vc_INTRINSIC m256i max_epu64(__m256i a, __m256i b) {
+    return blendv_epi8(b, a, cmpgt_epu64(a, b));
+}
+static Vc_INTRINSIC m256i min_epi64(__m256i a, __m256i b) {
+    return blendv_epi8(a, b, cmpgt_epi64(a, b));
+}
+static Vc_INTRINSIC m256i min_epu64(__m256i a, __m256i b) {
+    return blendv_epi8(a, b, cmpgt_epu64(a, b));
+}
+// there is no vpsraq before AVX-512; see SSE::sra_epi64
+static Vc_INTRINSIC m256i sra_epi64(__m256i a, int shift) {
+    const m256i sign = cmpgt_epi64(_mm256_setzero_si256(), a);
+    return xor_si256(srl_epi64(xor_si256(a, sign), _mm_cvtsi32_si128(shift)), sign);
+}
+static Vc_INTRINSIC m256i abs_epi64(__m256i a) {
+    const m256i sign = cmpgt_epi64(_mm256_setzero_si256(), a);
+    return sub_epi64(xor_si256(a, sign), sign);
+}
+// a * b = lo(a) lo(b) + (hi(a) lo(b) + lo(a) hi(b)) << 32 (mod 2^64)
+static Vc_INTRINSIC m256i mullo_epi64(__m256i a, __m256i b) {
+    const m256i lolo = mul_epu32(a, b);
+    const m256i hilo = mul_epu32(srli_epi64<32>(a), b);
+    const m256i lohi = mul_epu32(a, srli_epi64<32>(b));
+    return add_epi64(lolo, slli_epi64<32>(add_epi64(hilo, lohi)));
+}
+// there are no 8-bit shifts and multiplies; see SSE::sll_epi8 and SSE::mullo_epi8
+static Vc_INTRINSIC m256i sll_epi8(__m256i a, int shift) {
+    return and_si256(sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                     _mm256_set1_epi8(static_cast<char>(0xff << shift)));
+}
+static Vc_INTRINSIC m256i srl_epi8(__m256i a, int shift) {
+    return and_si256(srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                     _mm256_set1_epi8(static_cast<char>(0xff >> shift)));
+}
+static Vc_INTRINSIC m256i sra_epi8(__m256i a, int shift) {
+    const m256i m = _mm256_set1_epi8(static_cast<char>(0x80 >> shift));
+    return sub_epi8(xor_si256(srl_epi8(a, shift), m), m);
+}
+static Vc_INTRINSIC m256i mullo_epi8(__m256i a, __m256i b) {
+    const m256i even = mullo_epi16(a, b);
+    const m256i odd = mullo_epi16(srli_epi16<8>(a), srli_epi16<8>(b));
+    return or_si256(and_si256(even, _mm256_set1_epi16(0xff)), slli_epi16<8>(odd));
+}
 #if defined(Vc_IMPL_XOP)
     Vc_AVX_TO_SSE_2_NEW(comlt_epu32)
     Vc_AVX_TO_SSE_2_NEW(comgt_epu32)
@@ -606,6 +656,23 @@ static Vc_INTRINSIC void _mm256_maskstore(int *mem, const __m256i mask, const __
 static Vc_INTRINSIC void _mm256_maskstore(unsigned int *mem, const __m256i mask, const __m256i v) {
     _mm256_maskstore(reinterpret_cast<int *>(mem), mask, v);
 }
+static Vc_INTRINSIC void _mm256_maskstore(long long *mem, const __m256i mask, const __m256i v) {
+#ifdef Vc_IMPL_AVX2
+    _mm256_maskstore_epi64(mem, mask, v);
+#else
+    _mm256_maskstore_pd(reinterpret_cast<double *>(mem), mask, _mm256_castsi256_pd(v));
+#endif
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned long long *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<long long *>(mem), mask, v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(long *mem, const __m256i mask, const __m256i v) {
+    using T = std::conditional<sizeof(long) == 8, long long, int>::type;
+    _mm256_maskstore(reinterpret_cast<T *>(mem), mask, v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned long *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<long *>(mem), mask, v);
+}
 static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const __m256i v) {
     using namespace AVX;
     _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
@@ -614,6 +681,14 @@ static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const
 static Vc_INTRINSIC void _mm256_maskstore(unsigned short *mem, const __m256i mask, const __m256i v) {
     _mm256_maskstore(reinterpret_cast<short *>(mem), mask, v);
 }
+static Vc_INTRINSIC void _mm256_maskstore(signed char *mem, const __m256i mask, const __m256i v) {
+    using namespace AVX;
+    _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
+    _mm_maskmoveu_si128(extract128<1>(v), extract128<1>(mask), reinterpret_cast<char *>(&mem[16]));
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned char *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<signed char *>(mem), mask, v);
+}
 
 #undef Vc_AVX_TO_SSE_1
 #undef Vc_AVX_TO_SSE_1_128
@@ -682,6 +757,34 @@ Vc_INTRINSIC void stream_store(void *mem, __m256i value, __m256i mask)
     stream_store(static_cast<__m128i *>(mem) + 1, extract128<1>(value), extract128<1>(mask));
 }
 
+// binary16 <-> binary32 conversion of 8 halves
+#ifdef Vc_IMPL_F16C
+Vc_INTRINSIC Vc_CONST m256 cvtph_ps(__m128i h) { return _mm256_cvtph_ps(h); }
+Vc_INTRINSIC Vc_CONST m128i cvtps_ph(__m256 x)
+{
+    return _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+}
+#else
+}  // namespace AvxIntrinsics
+namespace SseIntrinsics
+{
+Vc_INTRINSIC_L Vc_CONST_L __m128 cvtph_ps(__m128i h) Vc_INTRINSIC_R Vc_CONST_R;
+Vc_INTRINSIC_L Vc_CONST_L __m128i cvtps_ph(__m128 x) Vc_INTRINSIC_R Vc_CONST_R;
+}  // namespace SseIntrinsics
+namespace AvxIntrinsics
+{
+Vc_INTRINSIC Vc_CONST m256 cvtph_ps(__m128i h)
+{
+    return insert128<1>(_mm256_castps128_ps256(SseIntrinsics::cvtph_ps(h)),
+                        SseIntrinsics::cvtph_ps(_mm_unpackhi_epi64(h, h)));
+}
+Vc_INTRINSIC Vc_CONST m128i cvtps_ph(__m256 x)
+{
+    return _mm_unpacklo_epi64(SseIntrinsics::cvtps_ph(_mm256_castps256_ps128(x)),
+                              SseIntrinsics::cvtps_ph(extract128<1>(x)));
+}
+#endif
+
 #ifndef __x86_64__
 Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
     return _mm_castpd_si128(_mm_load_sd(reinterpret_cast<const double *>(&x)));
@@ -212,7 +212,7 @@ public:
         return get(*this, index);
     }
 
-        Vc_INTRINSIC Vc_PURE int count() const { return Detail::popcnt16(toInt()); }
+        Vc_INTRINSIC Vc_PURE int count() const { return Detail::popcnt32(toInt()); }
         Vc_INTRINSIC Vc_PURE int firstOne() const { return _bit_scan_forward(toInt()); }
 
         template <typename G> static Vc_INTRINSIC_L Mask generate(G &&gen) Vc_INTRINSIC_R;
@@ -798,7 +798,9 @@ Vc_INTRINSIC Vc_CONST To simd_cast(AVX2::Vector<FromT> x,
 // 1 AVX2::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
-    simd_cast(const AVX2::Mask<T> &k, enable_if<AVX2::is_mask<Return>::value> = nullarg);
+    simd_cast(const AVX2::Mask<T> &k,
+              enable_if<AVX2::is_mask<Return>::value &&
+                        (AVX2::Mask<T>::Size == 32) == (Return::Size == 32)> = nullarg);
 
 // 2 AVX2::Mask to 1 AVX2::Mask {{{2
 Vc_SIMD_CAST_AVX_2(double_m,  float_m);
@@ -2253,11 +2255,220 @@ simd_cast(AVX2::Vector<FromT> x, enable_if<Scalar::is_vector<To>::value>)
     return static_cast<To>(x[0]);
 }
 
+// 64-bit and 8-bit integer Vector casts {{{2
+namespace Detail
+{
+template <typename T>
+using is_split_cast_type = std::integral_constant<
+    bool, std::is_integral<T>::value && (sizeof(T) == 8 || sizeof(T) == 1)>;
+template <typename T, typename U>
+using is_split_cast_pair =
+    std::integral_constant<bool, is_split_cast_type<T>::value || is_split_cast_type<U>::value>;
+/**\internal
+ * Whether a simd_cast from \p From to \p Return involves a 64-bit or 8-bit integer Vector
+ * and an AVX2::Vector. These casts split every AVX2::Vector into its 128-bit halves and
+ * forward to the SSE::Vector casts.
+ */
+template <typename Return, typename From> struct is_avx_split_cast : std::false_type {};
+template <typename T, typename U>
+struct is_avx_split_cast<AVX2::Vector<T>, SSE::Vector<U>> : public is_split_cast_pair<T, U> {
+};
+template <typename T, typename U>
+struct is_avx_split_cast<SSE::Vector<T>, AVX2::Vector<U>> : public is_split_cast_pair<T, U> {
+};
+template <typename T, typename U>
+struct is_avx_split_cast<AVX2::Vector<T>, AVX2::Vector<U>>
+    : public std::integral_constant<bool, !std::is_same<T, U>::value &&
+                                              is_split_cast_pair<T, U>::value> {
+};
+
+template <typename T> Vc_INTRINSIC SSE::Vector<T> split_cast_lo(AVX2::Vector<T> x)
+{
+    return SSE::Vector<T>(AVX::lo128(x.data()));
+}
+template <typename T> Vc_INTRINSIC SSE::Vector<T> split_cast_hi(AVX2::Vector<T> x)
+{
+    return SSE::Vector<T>(AVX::hi128(x.data()));
+}
+
+// strategies for casting several SSE::Vectors (pieces) to one SSE or AVX2::Vector
+using AvxSplitCastFirst = std::integral_constant<int, 0>;  // SSE Return, same type as x0
+using AvxSplitCastSse = std::integral_constant<int, 1>;    // SSE Return
+using AvxSplitCastHalves = std::integral_constant<int, 2>;  // x0, x1 -> lo, hi
+using AvxSplitCastSplit = std::integral_constant<int, 3>;   // x0 -> lo and hi
+using AvxSplitCastPairs = std::integral_constant<int, 4>;   // x0, x1 -> lo; x2, x3 -> hi
+using AvxSplitCastEntrywise = std::integral_constant<int, 5>;
+using AvxSplitCastQuads = std::integral_constant<int, 6>;  // x0..x3 -> lo; x4..x7 -> hi
+template <typename Return, typename V, bool = SSE::is_vector<Return>::value>
+struct avx_split_cast_strategy
+    : public std::integral_constant<int, std::is_same<Return, V>::value ? 0 : 1> {
+};
+template <typename Return, typename V>
+struct avx_split_cast_strategy<Return, V, false>
+    : public std::integral_constant<
+          int, SSE::Vector<typename Return::EntryType>::Size == V::Size
+                   ? 2
+                   : V::Size >= Return::Size
+                         ? 3
+                         : SSE::Vector<typename Return::EntryType>::Size == 2 * V::Size
+                               ? 4
+                               : SSE::Vector<typename Return::EntryType>::Size == 4 * V::Size
+                                     ? 6
+                                     : 5> {
+};
+
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastFirst, V x0, Vs...)
+{
+    return x0;
+}
+template <typename Return, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastSse, Vs... xs)
+{
+    return simd_cast<Return>(xs...);
+}
+template <typename Return, typename V>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastHalves, V x0)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::zeroExtend(simd_cast<H>(x0).data());
+}
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastHalves, V x0, V x1, Vs...)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::concat(simd_cast<H>(x0).data(), simd_cast<H>(x1).data());
+}
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastSplit, V x0, Vs...)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::concat(simd_cast<H>(x0).data(), simd_cast<H, 1>(x0).data());
+}
+template <typename Return, typename V>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastPairs, V x0)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::zeroExtend(simd_cast<H>(x0).data());
+}
+template <typename Return, typename V>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastPairs, V x0, V x1)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::zeroExtend(simd_cast<H>(x0, x1).data());
+}
+template <typename Return, typename V>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastPairs, V x0, V x1, V x2)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::concat(simd_cast<H>(x0, x1).data(), simd_cast<H>(x2).data());
+}
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastPairs, V x0, V x1, V x2, V x3, Vs...)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::concat(simd_cast<H>(x0, x1).data(), simd_cast<H>(x2, x3).data());
+}
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC enable_if<(sizeof...(Vs) < 4), Return> avx_split_cast(AvxSplitCastQuads, V x0,
+                                                                   Vs... xs)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::zeroExtend(simd_cast<H>(x0, xs...).data());
+}
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC enable_if<(sizeof...(Vs) >= 1 && sizeof...(Vs) <= 4), Return> avx_split_cast(
+    AvxSplitCastQuads, V x0, V x1, V x2, V x3, Vs... xs)
+{
+    using H = SSE::Vector<typename Return::EntryType>;
+    return AVX::concat(simd_cast<H>(x0, x1, x2, x3).data(), simd_cast<H>(xs...).data());
+}
+template <typename Return, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast(AvxSplitCastEntrywise, Vs... xs)
+{
+    return cast_entrywise<Return>(xs...);
+}
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC Return avx_split_cast_pieces(V x0, Vs... xs)
+{
+    return avx_split_cast<Return>(avx_split_cast_strategy<Return, V>(), x0, xs...);
+}
+}  // namespace Detail
+
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<Detail::is_avx_split_cast<Return, SSE::Vector<T>>::value, Return>
+    simd_cast(SSE::Vector<T> x0, Ts... xs)
+{
+    return Detail::avx_split_cast_pieces<Return>(x0, xs...);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<Detail::is_avx_split_cast<Return, AVX2::Vector<T>>::value, Return>
+    simd_cast(AVX2::Vector<T> x)
+{
+    return Detail::avx_split_cast_pieces<Return>(Detail::split_cast_lo(x),
+                                                 Detail::split_cast_hi(x));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<Detail::is_avx_split_cast<Return, AVX2::Vector<T>>::value, Return>
+    simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1)
+{
+    return Detail::avx_split_cast_pieces<Return>(
+        Detail::split_cast_lo(x0), Detail::split_cast_hi(x0), Detail::split_cast_lo(x1),
+        Detail::split_cast_hi(x1));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<Detail::is_avx_split_cast<Return, AVX2::Vector<T>>::value &&
+                                    AVX2::is_vector<Return>::value,
+                                Return>
+    simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2)
+{
+    return Detail::avx_split_cast_pieces<Return>(
+        Detail::split_cast_lo(x0), Detail::split_cast_hi(x0), Detail::split_cast_lo(x1),
+        Detail::split_cast_hi(x1), Detail::split_cast_lo(x2), Detail::split_cast_hi(x2));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<Detail::is_avx_split_cast<Return, AVX2::Vector<T>>::value &&
+                                    AVX2::is_vector<Return>::value,
+                                Return>
+    simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+              AVX2::Vector<T> x3)
+{
+    return Detail::avx_split_cast_pieces<Return>(
+        Detail::split_cast_lo(x0), Detail::split_cast_hi(x0), Detail::split_cast_lo(x1),
+        Detail::split_cast_hi(x1), Detail::split_cast_lo(x2), Detail::split_cast_hi(x2),
+        Detail::split_cast_lo(x3), Detail::split_cast_hi(x3));
+}
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<Detail::is_avx_split_cast<Return, AVX2::Vector<T>>::value &&
+                  (!AVX2::is_vector<Return>::value || sizeof...(Ts) >= 2),
+              Return>
+    simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, Ts... xs)
+{
+    return Detail::cast_entrywise<Return>(x0, x1, x2, xs...);
+}
+
+// Scalar::Vector to 64-bit and 8-bit integer AVX2::Vector {{{2
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<AVX2::is_vector<Return>::value &&
+                  Detail::is_split_cast_type<typename Return::EntryType>::value,
+              Return>
+    simd_cast(Scalar::Vector<T> x0, Ts... xs)
+{
+    return Detail::cast_entrywise<Return>(x0, xs...);
+}
+
 // Mask casts without offset {{{1
 // 1 AVX2::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
-    simd_cast(const AVX2::Mask<T> &k, enable_if<AVX2::is_mask<Return>::value>)
+    simd_cast(const AVX2::Mask<T> &k,
+              enable_if<AVX2::is_mask<Return>::value &&
+                        (AVX2::Mask<T>::Size == 32) == (Return::Size == 32)>)
 {
     return {Detail::mask_cast<Mask<T, VectorAbi::Avx>::Size, Return::Size,
                               typename Return::VectorTypeF>(k.dataI())};
@@ -2536,6 +2747,141 @@ simd_cast(AVX2::Mask<FromT> x, enable_if<Scalar::is_mask<To>::value>)
     return static_cast<To>(x[0]);
 }
 
+// 8-bit integer Mask casts {{{2
+namespace Detail
+{
+/**\internal
+ * Expands the 8-bit mask entries in the low bytes of \p k to the entries of \p Return.
+ */
+template <typename Return>
+Vc_INTRINSIC Return int8_mask_expand(__m128i k, std::integral_constant<std::size_t, 16>)
+{
+    return AVX::concat(_mm_unpacklo_epi8(k, k), _mm_unpackhi_epi8(k, k));
+}
+template <typename Return>
+Vc_INTRINSIC Return int8_mask_expand(__m128i k, std::integral_constant<std::size_t, 8>)
+{
+    const auto tmp = _mm_unpacklo_epi8(k, k);
+    return AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp));
+}
+template <typename Return>
+Vc_INTRINSIC Return int8_mask_expand(__m128i k, std::integral_constant<std::size_t, 4>)
+{
+    auto tmp = _mm_unpacklo_epi8(k, k);
+    tmp = _mm_unpacklo_epi16(tmp, tmp);
+    return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp));
+}
+template <typename Return> Vc_INTRINSIC Return int8_mask_expand(__m128i k)
+{
+    return int8_mask_expand<Return>(k, std::integral_constant<std::size_t, Return::Size>());
+}
+
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC std::uint64_t int8_mask_bits(std::size_t) { return 0; }
+/**\internal
+ * Concatenates the bits of \p k, \p ks... starting at bit \p i.
+ */
+template <typename M, typename... Ms>
+Vc_INTRINSIC std::uint64_t int8_mask_bits(std::size_t i, M k, Ms... ks)
+{
+    return (std::uint64_t(unsigned(k.toInt())) << i) |
+           int8_mask_bits(i + M::Size, ks...);
+}
+
+/**\internal
+ * Returns the 32-entry 8-bit mask with entry i set iff bit i of \p bits is set.
+ */
+Vc_INTRINSIC __m256i int8_mask_from_bits(std::uint32_t bits)
+{
+    const __m256i byteOfBit = _mm256_shuffle_epi8(
+        _mm256_set1_epi32(int(bits)),
+        _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                         2, 2, 3, 3, 3, 3, 3, 3, 3, 3));
+    const __m256i bit = _mm256_set1_epi64x(0x8040201008040201ll);
+    return _mm256_cmpeq_epi8(_mm256_and_si256(byteOfBit, bit), bit);
+}
+#endif  // Vc_IMPL_AVX2
+}  // namespace Detail
+
+#ifdef Vc_IMPL_AVX2
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<AVX2::is_mask<Return>::value && Return::Size == 32 &&
+                  AVX2::Mask<T>::Size != 32,
+              Return>
+    simd_cast(AVX2::Mask<T> k, Ts... ks)
+{
+    return {AVX::avx_cast<__m256>(Detail::int8_mask_from_bits(
+        std::uint32_t(Detail::int8_mask_bits(0, k, ks...))))};
+}
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST enable_if<AVX2::is_mask<Return>::value && Return::Size == 32, Return>
+    simd_cast(SSE::Mask<T> k, Ts... ks)
+{
+    return {AVX::avx_cast<__m256>(Detail::int8_mask_from_bits(
+        std::uint32_t(Detail::int8_mask_bits(0, k, ks...))))};
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<AVX2::is_mask<Return>::value && Return::Size != 32 &&
+                  AVX2::Mask<T>::Size == 32,
+              Return>
+    simd_cast(AVX2::Mask<T> k)
+{
+    return Detail::int8_mask_expand<Return>(AVX::lo128(k.dataI()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<SSE::is_mask<Return>::value && AVX2::Mask<T>::Size == 32, Return>
+    simd_cast(AVX2::Mask<T> k)
+{
+    return simd_cast<Return>(SSE::Mask<T>(AVX::lo128(k.data())));
+}
+#endif  // Vc_IMPL_AVX2
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<AVX2::is_mask<Return>::value && Return::Size != 32 && sizeof(T) == 1,
+              Return>
+    simd_cast(SSE::Mask<T> k)
+{
+    return Detail::int8_mask_expand<Return>(k.dataI());
+}
+
+// the remaining AVX2::Mask to 8-bit SSE::Mask casts go via the two SSE::Mask halves
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<SSE::is_mask<Return>::value &&
+                                    sizeof(typename Return::EntryType) == 1 &&
+                                    AVX2::Mask<T>::Size != 32,
+                                Return>
+    simd_cast(AVX2::Mask<T> k)
+{
+    return simd_cast<Return>(SSE::Mask<T>(AVX::lo128(k.data())),
+                             SSE::Mask<T>(AVX::hi128(k.data())));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<SSE::is_mask<Return>::value &&
+                                    sizeof(typename Return::EntryType) == 1,
+                                Return>
+    simd_cast(AVX2::Mask<T> k0, AVX2::Mask<T> k1)
+{
+    return simd_cast<Return>(
+        SSE::Mask<T>(AVX::lo128(k0.data())), SSE::Mask<T>(AVX::hi128(k0.data())),
+        SSE::Mask<T>(AVX::lo128(k1.data())), SSE::Mask<T>(AVX::hi128(k1.data())));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<SSE::is_mask<Return>::value &&
+                                    sizeof(typename Return::EntryType) == 1,
+                                Return>
+    simd_cast(AVX2::Mask<T> k0, AVX2::Mask<T> k1, AVX2::Mask<T> k2, AVX2::Mask<T> k3)
+{
+    return simd_cast<Return>(
+        SSE::Mask<T>(AVX::lo128(k0.data())), SSE::Mask<T>(AVX::hi128(k0.data())),
+        SSE::Mask<T>(AVX::lo128(k1.data())), SSE::Mask<T>(AVX::hi128(k1.data())),
+        SSE::Mask<T>(AVX::lo128(k2.data())), SSE::Mask<T>(AVX::hi128(k2.data())),
+        SSE::Mask<T>(AVX::lo128(k3.data())), SSE::Mask<T>(AVX::hi128(k3.data())));
+}
+
 // offset == 0 | convert from AVX2::Mask/Vector {{{1
 template <typename Return, int offset, typename From>
 Vc_INTRINSIC Vc_CONST enable_if<
@@ -2629,6 +2975,18 @@ Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && SSE::is_vector<Return>::value &&
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<(offset != 0 && Detail::is_avx_split_cast<Return, SSE::Vector<T>>::value),
+              Return>
+    simd_cast(SSE::Vector<T> x)
+{
+    using V = SSE::Vector<T>;
+    constexpr int shift = sizeof(T) * offset * Return::Size;
+    static_assert(shift > 0 && shift < 16, "");
+    return simd_cast<Return>(V{AVX::avx_cast<typename V::VectorType>(
+        _mm_srli_si128(AVX::avx_cast<__m128i>(x.data()), shift))});
+}
 
 // Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
@@ -2677,6 +3035,30 @@ simd_cast(const AVX2::Mask<T> &k,
     return AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp));
 }
 
+// 8-bit AVX2::Mask to AVX2::Mask with 8 times fewer entries {{{2
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX2::Mask<T> &k,
+          enable_if<(AVX2::is_mask<Return>::value && offset != 0 &&
+                     AVX2::Mask<T>::Size == Return::Size * 8)> = nullarg)
+{
+    constexpr int shift = offset * Return::Size;
+    const auto lo = AVX::lo128(k.dataI());
+    const auto hi = AVX::hi128(k.dataI());
+    return Detail::int8_mask_expand<Return>(
+        shift < 16 ? _mm_alignr_epi8(hi, lo, shift & 15) : _mm_srli_si128(hi, shift & 15));
+}
+
+// 1 8-bit SSE::Mask to N AVX2::Mask {{{2
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST
+    enable_if<(offset != 0 && AVX2::is_mask<Return>::value && sizeof(T) == 1), Return>
+    simd_cast(SSE::Mask<T> k)
+{
+    return Detail::int8_mask_expand<Return>(
+        _mm_srli_si128(k.dataI(), (offset * Return::Size) & 15));
+}
+
 // 1 SSE::Mask to N AVX2::Mask {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
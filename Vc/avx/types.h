@@ -85,6 +85,12 @@ using    int_v = Vector<   int>;
 using   uint_v = Vector<  uint>;
 using  short_v = Vector< short>;
 using ushort_v = Vector<ushort>;
+using  llong_v = Vector< llong>;
+using ullong_v = Vector<ullong>;
+using   long_v = Vector<  long>;
+using  ulong_v = Vector< ulong>;
+using  schar_v = Vector< schar>;
+using  uchar_v = Vector< uchar>;
 
 template <typename T> using Mask = Vc::Mask<T, VectorAbi::Avx>;
 using double_m = Mask<double>;
@@ -27,7 +27,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "../common/x86_prefetches.h"
 #include "../common/gatherimplementation.h"
+#include "../common/maskedloadstore.h"
 #include "../common/scatterimplementation.h"
+#include "../common/tunedgatherscatter.h"
 #include "limits.h"
 #include "const.h"
 #include "../common/set.h"
@@ -76,6 +78,53 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8 (a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8 (a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmplt_epi8 (a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmplt_epu8 (a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8 (a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8 (a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmplt_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmplt_epu8 (a.data(), b.data()); }
+
+// 64-bit integer compares {{{1
+template <typename T>
+using enable_if_avx_int64 = enable_if<std::is_integral<T>::value && sizeof(T) == 8, AVX2::Mask<T>>;
+template <typename T>
+Vc_INTRINSIC enable_if_avx_int64<T> operator==(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return AVX::cmpeq_epi64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if_avx_int64<T> operator!=(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return not_(AVX::cmpeq_epi64(a.data(), b.data()));
+}
+template <typename T>
+Vc_INTRINSIC enable_if_avx_int64<T> operator>(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return std::is_signed<T>::value ? AVX::cmpgt_epi64(a.data(), b.data())
+                                    : AVX::cmpgt_epu64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if_avx_int64<T> operator<(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return b > a;
+}
+template <typename T>
+Vc_INTRINSIC enable_if_avx_int64<T> operator>=(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return !(a < b);
+}
+template <typename T>
+Vc_INTRINSIC enable_if_avx_int64<T> operator<=(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return !(a > b);
+}
 #endif  // Vc_IMPL_AVX2
 
 // bitwise operators {{{1
@@ -112,10 +161,18 @@ Vc_INTRINSIC AVX2::Vector<T> operator*(AVX2::Vector<T> a, AVX2::Vector<T> b)
     return mul(a.data(), b.data(), T());
 }
 template <typename T>
-Vc_INTRINSIC AVX2::Vector<T> operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
+Vc_INTRINSIC enable_if<!(std::is_integral<T>::value && sizeof(T) == 8), AVX2::Vector<T>>
+operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
 {
     return div(a.data(), b.data(), T());
 }
+// there is no 64-bit integer division in AVX2 and the double round trip loses precision
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && sizeof(T) == 8, AVX2::Vector<T>>
+operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    return AVX2::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
+}
 Vc_INTRINSIC AVX2::Vector<ushort> operator/(AVX2::Vector<ushort> a,
                                             AVX2::Vector<ushort> b)
 {
@@ -140,6 +197,40 @@ Vc_INTRINSIC enable_if<std::is_integral<T>::value, AVX2::Vector<T>> operator%(
 {
     return a - a / b * b;
 }
+
+// masked loads {{{1
+// vmaskmov/vpmaskmov never access the memory of inactive lanes; everything else goes
+// through Common::masked_load
+template <typename V, typename T, typename Flags>
+Vc_INTRINSIC void masked_load(V &v, const T *mem, typename V::MaskArgument k, Flags f)
+{
+    Common::masked_load(v, mem, k, f);
+}
+template <typename Flags>
+Vc_INTRINSIC void masked_load(AVX2::float_v &v, const float *mem, AVX2::float_m k, Flags)
+{
+    v.data() = blend(v.data(), _mm256_maskload_ps(mem, k.dataI()), k.data());
+}
+template <typename Flags>
+Vc_INTRINSIC void masked_load(AVX2::double_v &v, const double *mem, AVX2::double_m k,
+                              Flags)
+{
+    v.data() = blend(v.data(), _mm256_maskload_pd(mem, k.dataI()), k.dataD());
+}
+#ifdef Vc_IMPL_AVX2
+template <typename Flags>
+Vc_INTRINSIC void masked_load(AVX2::int_v &v, const int *mem, AVX2::int_m k, Flags)
+{
+    v.data() = blend(v.data(), _mm256_maskload_epi32(mem, k.dataI()), k.dataI());
+}
+template <typename Flags>
+Vc_INTRINSIC void masked_load(AVX2::uint_v &v, const uint *mem, AVX2::uint_m k, Flags)
+{
+    v.data() = blend(v.data(),
+                     _mm256_maskload_epi32(reinterpret_cast<const int *>(mem), k.dataI()),
+                     k.dataI());
+}
+#endif
 // }}}1
 }  // namespace Detail
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -229,6 +320,116 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+template <> template <typename G> Vc_INTRINSIC AVX2::llong_v AVX2::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::long_v AVX2::long_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::ulong_v AVX2::ulong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                            tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19,
+                            tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28,
+                            tmp29, tmp30, tmp31);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                            tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19,
+                            tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28,
+                            tmp29, tmp30, tmp31);
+}
 #endif
 
 // constants {{{1
@@ -243,6 +444,10 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector< llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector<  long, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector< ulong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
 #endif
 
 template <typename T>
@@ -262,6 +467,28 @@ Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx>::Vector(VectorSpecialInitializer
     : Vector(AVX::IndexesFromZeroData<int>::address(), Vc::Aligned)
 {
 }
+#ifdef Vc_IMPL_AVX2
+template <>
+Vc_ALWAYS_INLINE Vector<llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<long, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<ulong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // load member functions {{{1
@@ -278,6 +505,19 @@ load_concept<SrcT, Flags>::type Vector<DstT, VectorAbi::Avx>::load(const SrcT *m
     d.v() = Detail::load<VectorType, DstT>(mem, flags);
 }
 
+// masked load {{{2
+template <typename DstT>
+template <typename SrcT, typename Flags>
+Vc_INTRINSIC typename Vector<DstT, VectorAbi::Avx>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<SrcT, Flags>::type Vector<DstT, VectorAbi::Avx>::load(const SrcT *mem, MaskArgument mask, Flags flags)
+{
+    Common::handleLoadPrefetches(mem, flags);
+    Detail::masked_load(*this, mem, mask, flags);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // zeroing {{{1
 template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::setZero()
@@ -329,7 +569,14 @@ template <typename U,
 Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store(U *mem, Mask mask, Flags flags) const
 {
     Common::handleStorePrefetches(mem, flags);
-    HV::template store<Flags>(mem, data(), AVX::avx_cast<VectorType>(mask.data()));
+    // vmaskmov suppresses faults on inactive lanes, maskmovdqu (used for 16-bit entries)
+    // does not
+    if (sizeof(U) >= 4 ||
+        Common::is_full_width_access_safe<Size * sizeof(U)>(mem, mask)) {
+        HV::template store<Flags>(mem, data(), AVX::avx_cast<VectorType>(mask.data()));
+    } else {
+        Common::masked_store_per_lane(*this, mem, mask);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -343,6 +590,18 @@ template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<  long> Vector<  long, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< ulong> Vector< ulong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<  long> Vector<  long, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< ulong> Vector< ulong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
 template <typename T>
 Vc_ALWAYS_INLINE AVX2::Vector<T> &Vector<T, VectorAbi::Avx>::operator<<=(AsArg x)
 {
@@ -410,34 +669,113 @@ inline void AVX2::float_v::gatherImplementation(const MT *mem, const IT &indexes
 #ifdef Vc_IMPL_AVX2
 #ifndef Vc_MSVC
 // skip this code for MSVC because it fails to do overload resolution correctly
+namespace Detail
+{
+Vc_INTRINSIC __m256d hardware_gather(const double *mem, SSE::int_v indexes)
+{
+    return _mm256_i32gather_pd(mem, indexes.data(), sizeof(double));
+}
+Vc_INTRINSIC __m256 hardware_gather(const float *mem, AVX2::int_v indexes)
+{
+    return _mm256_i32gather_ps(mem, indexes.data(), sizeof(float));
+}
+Vc_INTRINSIC __m256i hardware_gather(const int *mem, AVX2::int_v indexes)
+{
+    return _mm256_i32gather_epi32(mem, indexes.data(), sizeof(int));
+}
+Vc_INTRINSIC __m256i hardware_gather(const uint *mem, AVX2::int_v indexes)
+{
+    return _mm256_i32gather_epi32(aliasing_cast<int>(mem), indexes.data(),
+                                  sizeof(unsigned));
+}
+}  // namespace Detail
+
+#ifdef Vc_USE_TUNED_GATHERS
+namespace Common
+{
+/**\internal
+ * Times the AVX2 gather instruction against scalar loads for the unmasked gathers of
+ * \p V. The gather instruction, the default, is only replaced if scalar loads are
+ * clearly faster.
+ */
+template <class V> int calibrateHardwareGather()
+{
+    using IT = typename std::conditional<V::Size == 8, AVX2::int_v, SSE::int_v>::type;
+    GatherCalibrationData<V> d;
+    double best[2] = {1e9, 1e9};
+    V sum = V::Zero();
+    for (int pass = 0; pass < d.Passes; ++pass) {
+        best[0] = std::min(best[0], timeGatherStrategy([&]() {
+            for (std::size_t i = 0; i < d.Count; ++i) {
+                const IT indexes = simd_cast<IT>(d.index(i));
+                sum += V::generate([&](int k) { return d.table[indexes[k]]; });
+            }
+        }));
+        best[1] = std::min(best[1], timeGatherStrategy([&]() {
+            for (std::size_t i = 0; i < d.Count; ++i) {
+                const IT indexes = simd_cast<IT>(d.index(i));
+                sum += V(Vc::Detail::hardware_gather(d.table.get(), indexes));
+            }
+        }));
+    }
+    d.sink = sum.sum();
+    return int(best[0] < 0.95 * best[1] ? GatherScatterImplementation::SimpleLoop
+                                        : GatherScatterImplementation::HardwareGather);
+}
+
+template <class V> bool tunedHardwareGather()
+{
+    using Op = Vc::Detail::GatherTuningOperation;
+    static const bool hardware =
+        Vc::Detail::tuned_gather_implementation(Vc::Detail::gatherTuningKey<V>(Op::Gather),
+                                                &calibrateHardwareGather<V>) ==
+        int(GatherScatterImplementation::HardwareGather);
+    return hardware;
+}
+}  // namespace Common
+
+// with Vc_USE_TUNED_GATHERS the gather instruction is only used if it beats scalar loads
+#define Vc_TUNED_HARDWARE_GATHER(V_, MT_, IT_)                                           \
+    if (!Common::tunedHardwareGather<V_>()) {                                            \
+        gatherImplementation<MT_, IT_>(mem, indexes);                                    \
+        return;                                                                          \
+    }
+#else
+#define Vc_TUNED_HARDWARE_GATHER(V_, MT_, IT_)
+#endif  // Vc_USE_TUNED_GATHERS
+
 template <>
 Vc_INTRINSIC void AVX2::double_v::gatherImplementation(const double *mem,
                                                        SSE::int_v indexes)
 {
-    d.v() = _mm256_i32gather_pd(mem, indexes.data(), sizeof(double));
+    Vc_TUNED_HARDWARE_GATHER(AVX2::double_v, double, SSE::int_v);
+    d.v() = Detail::hardware_gather(mem, indexes);
 }
 
 template <>
 Vc_INTRINSIC void AVX2::float_v::gatherImplementation(const float *mem,
                                                       AVX2::int_v indexes)
 {
-    d.v() = _mm256_i32gather_ps(mem, indexes.data(), sizeof(float));
+    Vc_TUNED_HARDWARE_GATHER(AVX2::float_v, float, AVX2::int_v);
+    d.v() = Detail::hardware_gather(mem, indexes);
 }
 
 template <>
 Vc_INTRINSIC void AVX2::int_v::gatherImplementation(const int *mem,
                                                     AVX2::int_v indexes)
 {
-    d.v() = _mm256_i32gather_epi32(mem, indexes.data(), sizeof(int));
+    Vc_TUNED_HARDWARE_GATHER(AVX2::int_v, int, AVX2::int_v);
+    d.v() = Detail::hardware_gather(mem, indexes);
 }
 
 template <>
 Vc_INTRINSIC void AVX2::uint_v::gatherImplementation(const uint *mem,
                                                      AVX2::int_v indexes)
 {
-    d.v() =
-        _mm256_i32gather_epi32(aliasing_cast<int>(mem), indexes.data(), sizeof(unsigned));
+    Vc_TUNED_HARDWARE_GATHER(AVX2::uint_v, uint, AVX2::int_v);
+    d.v() = Detail::hardware_gather(mem, indexes);
 }
+#undef Vc_TUNED_HARDWARE_GATHER
 #endif  // !Vc_MSVC
 
 template <>
@@ -481,12 +819,77 @@ inline void AVX2::ushort_v::gatherImplementation(const MT *mem, const IT &indexe
                               mem[indexes[12]], mem[indexes[13]], mem[indexes[14]],
                               mem[indexes[15]]);
 }
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::llong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::ullong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::long_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::ulong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::schar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi8(
+        mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+        mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+        mem[indexes[8]], mem[indexes[9]], mem[indexes[10]], mem[indexes[11]],
+        mem[indexes[12]], mem[indexes[13]], mem[indexes[14]], mem[indexes[15]],
+        mem[indexes[16]], mem[indexes[17]], mem[indexes[18]], mem[indexes[19]],
+        mem[indexes[20]], mem[indexes[21]], mem[indexes[22]], mem[indexes[23]],
+        mem[indexes[24]], mem[indexes[25]], mem[indexes[26]], mem[indexes[27]],
+        mem[indexes[28]], mem[indexes[29]], mem[indexes[30]], mem[indexes[31]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::uchar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm256_setr_epi8(
+        mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+        mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+        mem[indexes[8]], mem[indexes[9]], mem[indexes[10]], mem[indexes[11]],
+        mem[indexes[12]], mem[indexes[13]], mem[indexes[14]], mem[indexes[15]],
+        mem[indexes[16]], mem[indexes[17]], mem[indexes[18]], mem[indexes[19]],
+        mem[indexes[20]], mem[indexes[21]], mem[indexes[22]], mem[indexes[23]],
+        mem[indexes[24]], mem[indexes[25]], mem[indexes[26]], mem[indexes[27]],
+        mem[indexes[28]], mem[indexes[29]], mem[indexes[30]], mem[indexes[31]]);
+}
 #endif
 
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Avx>::gatherImplementation(const MT *mem, const IT &indexes, MaskArgument mask)
 {
+#ifdef Vc_USE_TUNED_GATHERS
+    Common::executeTunedGather(*this, mem, indexes, mask);
+#else
     using Selector = std::integral_constant < Common::GatherScatterImplementation,
 #ifdef Vc_USE_SET_GATHERS
           Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
@@ -500,6 +903,7 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(const MT *mem, const
 #endif
                                                 > ;
     Common::executeGather(Selector(), *this, mem, indexes, mask);
+#endif
 }
 
 template <typename T>
@@ -513,6 +917,9 @@ template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&indexes, MaskArgument mask) const
 {
+#ifdef Vc_USE_TUNED_GATHERS
+    Common::executeTunedScatter(*this, mem, indexes, mask);
+#else
     using Selector = std::integral_constant < Common::GatherScatterImplementation,
 #ifdef Vc_USE_SET_GATHERS
           Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
@@ -526,6 +933,7 @@ inline void Vector<T, VectorAbi::Avx>::scatterImplementation(MT *mem, IT &&index
 #endif
                                                 > ;
     Common::executeScatter(Selector(), *this, mem, std::forward<IT>(indexes), mask);
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -907,6 +1315,54 @@ template <> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::interleaveHigh(AVX2::ush
     return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi16(data(), x.data()),
                                    _mm256_unpackhi_epi16(data(), x.data()));
 }
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveLow ( AVX2::llong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveHigh( AVX2::llong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveLow (AVX2::ullong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveHigh(AVX2::ullong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC   AVX2::long_v   AVX2::long_v::interleaveLow (  AVX2::long_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC   AVX2::long_v   AVX2::long_v::interleaveHigh(  AVX2::long_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::ulong_v  AVX2::ulong_v::interleaveLow ( AVX2::ulong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::ulong_v  AVX2::ulong_v::interleaveHigh( AVX2::ulong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveLow ( AVX2::schar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveHigh( AVX2::schar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveLow ( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveHigh( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
 #endif
 // permutation via operator[] {{{1
 template <> Vc_INTRINSIC Vc_PURE AVX2::double_v AVX2::double_v::operator[](Permutation::ReversedTag) const
@@ -944,6 +1400,42 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::llong_v AVX2::llong_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::ullong_v AVX2::ullong_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::long_v AVX2::long_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::ulong_v AVX2::ulong_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](Permutation::ReversedTag) const
+{
+    const __m256i reverse16 = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+                                               1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+                                               4, 3, 2, 1, 0);
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(d.v(), reverse16));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](Permutation::ReversedTag) const
+{
+    const __m256i reverse16 = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+                                               1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+                                               4, 3, 2, 1, 0);
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(d.v(), reverse16));
+}
 #endif
 template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
 {
@@ -984,6 +1476,30 @@ template <> template <int Index> Vc_INTRINSIC AVX2::double_v AVX2::double_v::bro
     return Mem::permute<Inner, Inner>(Mem::permute128<Outer, Outer>(d.v()));
 }
 // }}}1
+
+namespace Common
+{
+// transpose_impl {{{1
+Vc_ALWAYS_INLINE void transpose_impl(
+    TransposeTag<4, 4>, AVX2::double_v *Vc_RESTRICT r[],
+    const TransposeProxy<AVX2::double_v, AVX2::double_v, AVX2::double_v, AVX2::double_v>
+        &proxy)
+{
+    const auto in0 = std::get<0>(proxy.in).data();
+    const auto in1 = std::get<1>(proxy.in).data();
+    const auto in2 = std::get<2>(proxy.in).data();
+    const auto in3 = std::get<3>(proxy.in).data();
+    const auto tmp0 = _mm256_unpacklo_pd(in0, in1);  // a0 b0 a2 b2
+    const auto tmp1 = _mm256_unpackhi_pd(in0, in1);  // a1 b1 a3 b3
+    const auto tmp2 = _mm256_unpacklo_pd(in2, in3);  // c0 d0 c2 d2
+    const auto tmp3 = _mm256_unpackhi_pd(in2, in3);  // c1 d1 c3 d3
+    *r[0] = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+    *r[1] = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+    *r[2] = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+    *r[3] = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+}
+// }}}1
+}  // namespace Common
 }  // namespace Vc
 
 // vim: foldmethod=marker
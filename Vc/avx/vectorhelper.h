@@ -51,6 +51,13 @@ namespace AVX
 
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if<!Flags::IsStreaming, void *>::type = nullptr) { _mm256_maskstore(mem, m, x); }
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if< Flags::IsStreaming, void *>::type = nullptr) { AvxIntrinsics::stream_store(mem, x, m); }
+
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfAligned               = nullptr) { _mm_store_si128(reinterpret_cast<__m128i *>(mem), cvtps_ph(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfUnalignedNotStreaming = nullptr) { _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), cvtps_ph(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfStreaming             = nullptr) { _mm_stream_si128(reinterpret_cast<__m128i *>(mem), cvtps_ph(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, typename Flags::EnableIfUnalignedAndStreaming = nullptr) { AvxIntrinsics::stream_store(mem, cvtps_ph(x), _mm_set1_epi32(-1)); }
+
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VTArg x, VTArg m) { _mm_maskmoveu_si128(cvtps_ph(x), _mm_packs_epi32(_mm256_castsi256_si128(_mm256_castps_si256(m)), extract128<1>(_mm256_castps_si256(m))), reinterpret_cast<char *>(mem)); }
         };
 
         template<> struct VectorHelper<__m256d>
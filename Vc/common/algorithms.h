@@ -28,7 +28,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include "simdize.h"
+#include "compress.h"
+#include "multiplyadd.h"
+#include "parallel.h"
+#include "prefetch.h"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -76,6 +83,166 @@ template<typename Mask> constexpr bool some_of(const Mask &m) { return m.isMix()
 constexpr bool some_of(bool) { return false; }
 //@}
 
+///////////////////////////////////////////////////////////////////////////////
+// masked simd_for_each {{{
+namespace Common
+{
+/**\internal
+ * Whether \p F can be called with a vector \p V and its mask type. simd_for_each then
+ * processes the remainder of the range with a single masked iteration.
+ */
+template <class F, class V, class = void> struct accepts_mask_argument : std::false_type {
+};
+template <class F, class V>
+struct accepts_mask_argument<
+    F, V, decltype(void(std::declval<F &>()(std::declval<V &>(),
+                                            std::declval<typename V::mask_type>())))>
+    : std::true_type {
+};
+
+/**\internal
+ * Defers the immutability check until the functor is known to take one argument.
+ */
+template <class F, class V, bool Immutable>
+struct functor_immutability_is
+    : std::integral_constant<
+          bool, Traits::is_functor_argument_immutable<F, V>::value == Immutable> {
+};
+
+/**\internal
+ * Selects the simd_for_each overloads for functors that take one vector argument.
+ */
+template <class F, class ValueType, bool Immutable>
+struct is_unmasked_functor
+    : std::conditional<accepts_mask_argument<F, simdize<ValueType>>::value,
+                       std::false_type,
+                       functor_immutability_is<F, simdize<ValueType>, Immutable>>::type {
+};
+
+/**\internal
+ * Selects the simd_for_each overloads for functors that take a vector and a mask.
+ */
+template <class F, class ValueType>
+struct is_masked_functor
+    : std::integral_constant<bool, std::is_arithmetic<ValueType>::value &&
+                                       accepts_mask_argument<F, simdize<ValueType>>::value> {
+};
+
+/**\internal
+ * Calls \p f for the \p count contiguous elements at \p ptr. The last call covers the
+ * remaining `count % V::Size` elements with a masked load (and store), instead of falling
+ * back to single-element vectors. The inactive lanes are zero.
+ */
+template <class V, class T, class F, class P>
+inline void simd_for_each_masked(T *ptr, std::size_t count, F &f, std::true_type,
+                                 const P &prefetcher)
+{
+    const typename V::mask_type full(true);
+    for (; count >= V::Size; count -= V::Size, ptr += V::Size) {
+        prefetcher.issue(ptr, V::Size * sizeof(T));
+        V tmp(ptr, Vc::Unaligned);
+        f(tmp, full);
+    }
+    if (count > 0) {
+        const typename V::mask_type k =
+            V::IndexesFromZero() < V(static_cast<typename V::EntryType>(count));
+        V tmp = V::Zero();
+        tmp.load(ptr, k, Vc::Unaligned);
+        f(tmp, k);
+    }
+}
+template <class V, class T, class F, class P>
+inline void simd_for_each_masked(T *ptr, std::size_t count, F &f, std::false_type,
+                                 const P &prefetcher)
+{
+    const typename V::mask_type full(true);
+    for (; count >= V::Size; count -= V::Size, ptr += V::Size) {
+        prefetcher.issue(ptr, V::Size * sizeof(T));
+        V tmp(ptr, Vc::Unaligned);
+        f(tmp, full);
+        tmp.store(ptr, Vc::Unaligned);
+    }
+    if (count > 0) {
+        const typename V::mask_type k =
+            V::IndexesFromZero() < V(static_cast<typename V::EntryType>(count));
+        V tmp = V::Zero();
+        tmp.load(ptr, k, Vc::Unaligned);
+        f(tmp, k);
+        tmp.store(ptr, k, Vc::Unaligned);
+    }
+}
+
+/**\internal
+ * Calls \p f for the \p count elements starting at \p first, with vectors of
+ * `simdize<ValueType>` and the remaining elements with single-element vectors. Functors
+ * that take their argument by non-const reference have it stored back.
+ */
+template <class ValueType, class It, class F, class P>
+inline void simd_for_each_unmasked(It first, std::size_t count, F &f, std::true_type,
+                                   const P &prefetcher)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    for (; count >= V::Size; count -= V::Size, first += V::Size) {
+        prefetcher.issue(std::addressof(*first), V::Size * sizeof(ValueType));
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        f(tmp);
+    }
+    for (; count != 0; --count, ++first) {
+        V1 tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        f(tmp);
+    }
+}
+template <class ValueType, class It, class F, class P>
+inline void simd_for_each_unmasked(It first, std::size_t count, F &f, std::false_type,
+                                   const P &prefetcher)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    for (; count >= V::Size; count -= V::Size, first += V::Size) {
+        prefetcher.issue(std::addressof(*first), V::Size * sizeof(ValueType));
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        f(tmp);
+        store_interleaved(tmp, std::addressof(*first));
+    }
+    for (; count != 0; --count, ++first) {
+        V1 tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        f(tmp);
+        store_interleaved(tmp, std::addressof(*first));
+    }
+}
+
+/**\internal
+ * Dispatches to simd_for_each_masked or simd_for_each_unmasked, depending on the
+ * signature of \p f.
+ */
+template <class ValueType, class It, class F, class P>
+inline void simd_for_each_dispatch(It first, std::size_t count, F &f, const P &prefetcher,
+                                   std::true_type /*masked*/)
+{
+    typedef simdize<ValueType> V;
+    if (count > 0) {
+        simd_for_each_masked<V>(
+            std::addressof(*first), count, f,
+            Traits::is_masked_functor_argument_immutable<F, V, typename V::mask_type>(),
+            prefetcher);
+    }
+}
+template <class ValueType, class It, class F, class P>
+inline void simd_for_each_dispatch(It first, std::size_t count, F &f, const P &prefetcher,
+                                   std::false_type /*masked*/)
+{
+    simd_for_each_unmasked<ValueType>(
+        first, count, f, Traits::is_functor_argument_immutable<F, simdize<ValueType>>(),
+        prefetcher);
+}
+}  // namespace Common
+// }}}
+
 #ifdef DOXYGEN
 /**
  * \ingroup Utilities
@@ -103,55 +270,53 @@ constexpr bool some_of(bool) { return false; }
  *   });
  * }
  * \endcode
+ *
+ * If \p f can also be called with a second argument of type `V::mask_type` and the
+ * iterator value type is arithmetic, all calls use the same vector type `V`. The last
+ * call then covers the remainder of the range with a masked load (and store, if \p f
+ * modifies its argument). The mask argument tells \p f which entries are valid; inactive
+ * entries are zero and are not written back.
+ *
+ * \code
+ * void scale(std::vector<float> &data, float factor) {
+ *   Vc::simd_for_each(data.begin(), data.end(), [&](auto &v, auto) {
+ *      v *= factor;
+ *   });
+ * }
+ * \endcode
  */
 template <class InputIt, class UnaryFunction>
 UnaryFunction simd_for_each(InputIt first, InputIt last, UnaryFunction f);
 #else
 template <class InputIt, class UnaryFunction,
           class ValueType = typename std::iterator_traits<InputIt>::value_type>
-inline enable_if<
-    Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>::value,
-    UnaryFunction>
+inline enable_if<Common::is_unmasked_functor<UnaryFunction, ValueType, true>::value,
+                 UnaryFunction>
 simd_for_each(InputIt first, InputIt last, UnaryFunction f)
 {
-    typedef simdize<ValueType> V;
-    typedef simdize<ValueType, 1> V1;
-    const auto lastV = last - V::Size + 1;
-    for (; first < lastV; first += V::Size) {
-        V tmp;
-        load_interleaved(tmp, std::addressof(*first));
-        f(tmp);
-    }
-    for (; first != last; ++first) {
-        V1 tmp;
-        load_interleaved(tmp, std::addressof(*first));
-        f(tmp);
-    }
+    Common::simd_for_each_unmasked<ValueType>(first, std::distance(first, last), f,
+                                              std::true_type(), Common::NoPrefetcher());
     return std::move(f);
 }
 
 template <typename InputIt, typename UnaryFunction,
           class ValueType = typename std::iterator_traits<InputIt>::value_type>
-inline enable_if<
-        !Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>::value,
-    UnaryFunction>
+inline enable_if<Common::is_unmasked_functor<UnaryFunction, ValueType, false>::value,
+                 UnaryFunction>
 simd_for_each(InputIt first, InputIt last, UnaryFunction f)
 {
-    typedef simdize<ValueType> V;
-    typedef simdize<ValueType, 1> V1;
-    const auto lastV = last - V::size() + 1;
-    for (; first < lastV; first += V::size()) {
-        V tmp;
-        load_interleaved(tmp, std::addressof(*first));
-        f(tmp);
-        store_interleaved(tmp, std::addressof(*first));
-    }
-    for (; first != last; ++first) {
-        V1 tmp;
-        load_interleaved(tmp, std::addressof(*first));
-        f(tmp);
-        store_interleaved(tmp, std::addressof(*first));
-    }
+    Common::simd_for_each_unmasked<ValueType>(first, std::distance(first, last), f,
+                                              std::false_type(), Common::NoPrefetcher());
+    return std::move(f);
+}
+
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline enable_if<Common::is_masked_functor<UnaryFunction, ValueType>::value, UnaryFunction>
+simd_for_each(InputIt first, InputIt last, UnaryFunction f)
+{
+    Common::simd_for_each_dispatch<ValueType>(first, std::distance(first, last), f,
+                                              Common::NoPrefetcher(), std::true_type());
     return std::move(f);
 }
 #endif
@@ -159,52 +324,847 @@ simd_for_each(InputIt first, InputIt last, UnaryFunction f)
 ///////////////////////////////////////////////////////////////////////////////
 template <typename InputIt, typename UnaryFunction,
           class ValueType = typename std::iterator_traits<InputIt>::value_type>
-inline enable_if<
-    Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>::value,
-    UnaryFunction>
+inline enable_if<Common::is_unmasked_functor<UnaryFunction, ValueType, true>::value,
+                 UnaryFunction>
 simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
 {
-    typename std::make_signed<size_t>::type len = count;
-    typedef simdize<ValueType> V;
-    typedef simdize<ValueType, 1> V1;
-    for (; len >= int(V::size()); len -= V::Size, first += V::Size) {
-        V tmp;
-        load_interleaved(tmp, std::addressof(*first));
-        f(tmp);
-    }
-    for (; len != 0; --len, ++first) {
-        V1 tmp;
-        load_interleaved(tmp, std::addressof(*first));
-        f(tmp);
-    }
+    Common::simd_for_each_unmasked<ValueType>(first, count, f, std::true_type(),
+                                              Common::NoPrefetcher());
     return std::move(f);
 }
 
 template <typename InputIt, typename UnaryFunction,
           class ValueType = typename std::iterator_traits<InputIt>::value_type>
-inline enable_if<
-    !Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>::value,
-    UnaryFunction>
+inline enable_if<Common::is_unmasked_functor<UnaryFunction, ValueType, false>::value,
+                 UnaryFunction>
 simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
 {
-    typename std::make_signed<size_t>::type len = count;
-    typedef simdize<ValueType> V;
-    typedef simdize<ValueType, 1> V1;
-    for (; len >= int(V::size()); len -= V::Size, first += V::Size) {
+    Common::simd_for_each_unmasked<ValueType>(first, count, f, std::false_type(),
+                                              Common::NoPrefetcher());
+    return std::move(f);
+}
+
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline enable_if<Common::is_masked_functor<UnaryFunction, ValueType>::value, UnaryFunction>
+simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
+{
+    Common::simd_for_each_dispatch<ValueType>(first, count, f, Common::NoPrefetcher(),
+                                              std::true_type());
+    return std::move(f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// prefetching simd_for_each {{{
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Variant of simd_for_each that issues software prefetches ahead of the iteration,
+ * according to \p policy (see Vc::prefetch_policy). The range must be contiguous.
+ *
+ * \code
+ * void scale(std::vector<float> &data, float factor) {
+ *   Vc::simd_for_each(Vc::prefetch, data.begin(), data.end(), [&](auto &v) {
+ *      v *= factor;
+ *   });
+ * }
+ * \endcode
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline UnaryFunction simd_for_each(const prefetch_policy &policy, InputIt first,
+                                   InputIt last, UnaryFunction f)
+{
+    Common::simd_for_each_dispatch<ValueType>(
+        first, std::distance(first, last), f, Common::StreamPrefetcher(policy),
+        Common::is_masked_functor<UnaryFunction, ValueType>());
+    return std::move(f);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Variant of simd_for_each_n that issues software prefetches ahead of the iteration,
+ * according to \p policy (see Vc::prefetch_policy). The range must be contiguous.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline UnaryFunction simd_for_each_n(const prefetch_policy &policy, InputIt first,
+                                     std::size_t count, UnaryFunction f)
+{
+    Common::simd_for_each_dispatch<ValueType>(
+        first, count, f, Common::StreamPrefetcher(policy),
+        Common::is_masked_functor<UnaryFunction, ValueType>());
+    return std::move(f);
+}
+// }}}
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel simd_for_each {{{
+namespace Common
+{
+/**\internal
+ * Calls \p f for the \p count elements starting at \p first, packed into objects of type
+ * \p V. \p count must be a multiple of V::Size.
+ */
+template <class V, class It, class F>
+Vc_INTRINSIC void simd_for_each_packed(It first, std::size_t count, F &f, std::true_type)
+{
+    for (; count != 0; count -= V::Size, first += V::Size) {
         V tmp;
         load_interleaved(tmp, std::addressof(*first));
         f(tmp);
-        store_interleaved(tmp, std::addressof(*first));
     }
-    for (; len != 0; --len, ++first) {
-        V1 tmp;
+}
+template <class V, class It, class F>
+Vc_INTRINSIC void simd_for_each_packed(It first, std::size_t count, F &f, std::false_type)
+{
+    for (; count != 0; count -= V::Size, first += V::Size) {
+        V tmp;
         load_interleaved(tmp, std::addressof(*first));
         f(tmp);
         store_interleaved(tmp, std::addressof(*first));
     }
-    return std::move(f);
 }
 
+/**\internal
+ * The number of elements before \p first is aligned to V::MemoryAlignment, capped at \p
+ * count. Non-arithmetic value types (simdized structures) get no alignment prologue.
+ */
+template <class V, class It>
+inline std::size_t simd_for_each_prologue(It first, std::size_t count, std::true_type)
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    const auto addr = reinterpret_cast<std::uintptr_t>(std::addressof(*first));
+    if (addr % sizeof(T) != 0) {
+        return 0;
+    }
+    const std::size_t misalignment = addr % V::MemoryAlignment;
+    const std::size_t n =
+        misalignment == 0 ? 0 : (V::MemoryAlignment - misalignment) / sizeof(T);
+    return n < count ? n : count;
+}
+template <class V, class It>
+inline std::size_t simd_for_each_prologue(It, std::size_t, std::false_type)
+{
+    return 0;
+}
+
+/**\internal
+ * The state shared by the threads of a parallel simd_for_each. Every chunk consists of
+ * full vectors only.
+ */
+template <class V, class It, class F> struct ParallelForEach {
+    It first;
+    std::size_t count;
+    std::size_t chunkSize;
+    F &f;
+
+    static void run(void *context, std::size_t chunk)
+    {
+        auto &self = *static_cast<ParallelForEach *>(context);
+        const std::size_t offset = chunk * self.chunkSize;
+        const std::size_t n = std::min(self.chunkSize, self.count - offset);
+        simd_for_each_packed<V>(
+            self.first + offset, n, self.f,
+            Traits::is_functor_argument_immutable<typename std::decay<F>::type, V>());
+    }
+};
+
+template <class It, class F, class ValueType>
+inline void parallel_simd_for_each(const parallel_policy &policy, It first,
+                                   std::size_t count, F &f)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    using Immutable1 = Traits::is_functor_argument_immutable<F, V1>;
+
+    // the scalar prologue and epilogue are only needed at the global ends of the range
+    const std::size_t prologue = simd_for_each_prologue<V>(
+        first, count, std::integral_constant<bool, std::is_arithmetic<ValueType>::value>());
+    simd_for_each_packed<V1>(first, prologue, f, Immutable1());
+    first += prologue;
+    count -= prologue;
+    const std::size_t epilogue = count % V::Size;
+    count -= epilogue;
+    simd_for_each_packed<V1>(first + count, epilogue, f, Immutable1());
+
+    std::size_t chunkSize = policy.chunk_size == 0 ? 16384 : policy.chunk_size;
+    chunkSize = (chunkSize + V::Size - 1) / V::Size * V::Size;
+    ParallelForEach<V, It, F> state = {first, count, chunkSize, f};
+    Vc::Detail::parallel_for_chunks((count + chunkSize - 1) / chunkSize, policy.threads,
+                                &ParallelForEach<V, It, F>::run, &state);
+}
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_for_each.
+ *
+ * The range is split into chunks of `policy.chunk_size` elements (full vectors only),
+ * which are processed by the libVc work-stealing thread pool. Elements before the first
+ * aligned address and the remainder after the last full vector are processed on the
+ * calling thread with single-element vectors, so that all chunks are full-width loops.
+ *
+ * \p f is called concurrently from several threads. In contrast to the sequential
+ * overload, the function object is not returned.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline void simd_for_each(const parallel_policy &policy, InputIt first, InputIt last,
+                          UnaryFunction f)
+{
+    Common::parallel_simd_for_each<InputIt, UnaryFunction, ValueType>(
+        policy, first, std::distance(first, last), f);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_for_each_n. See the parallel simd_for_each overload.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline void simd_for_each_n(const parallel_policy &policy, InputIt first,
+                            std::size_t count, UnaryFunction f)
+{
+    Common::parallel_simd_for_each<InputIt, UnaryFunction, ValueType>(policy, first, count,
+                                                                       f);
+}
+// }}}
+
+///////////////////////////////////////////////////////////////////////////////
+// reductions and scans {{{
+namespace Common
+{
+/**\internal
+ * The default operation of the reductions and scans.
+ */
+struct simd_plus {
+    template <class T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a + b;
+    }
+};
+
+/**\internal
+ * Whether the reductions and scans can load from \p It into Vc::Vector. Random access
+ * iterators are assumed to be contiguous.
+ */
+template <class It>
+using is_simd_range = std::integral_constant<
+    bool,
+    Traits::is_valid_vector_argument<
+        typename std::iterator_traits<It>::value_type>::value &&
+        std::is_base_of<std::random_access_iterator_tag,
+                        typename std::iterator_traits<It>::iterator_category>::value>;
+
+/**\internal
+ * Whether the reductions with the result type \p T can load from \p It into Vc::Vector.
+ */
+template <class It, class T>
+using is_simd_reduce =
+    std::integral_constant<bool, is_simd_range<It>::value &&
+                                     Traits::is_valid_vector_argument<T>::value>;
+
+/**\internal
+ * The vector type the reductions accumulate in: Vector<U> for an \p init of the element
+ * type \p U, otherwise a SimdArray<T> with as many lanes. Thus, as with std::reduce, the
+ * partial results have the type of \p init and a wider \p init does not overflow.
+ */
+template <class U, class T>
+using reduce_vector = typename std::conditional<std::is_same<U, T>::value, Vector<U>,
+                                                SimdArray<T, Vector<U>::Size>>::type;
+
+/**\internal
+ * Converts the loaded vector \p x to the accumulator type \p V of the reductions.
+ * (simd_cast to a SimdArray returns the derived fixed_size_simd.)
+ */
+template <class V, class X> Vc_INTRINSIC V reduce_cast(const X &x)
+{
+    return V(simd_cast<V>(x));
+}
+
+/**\internal
+ * Whether the scans can load from \p In and store to \p Out with Vc::Vector.
+ */
+template <class In, class Out>
+using is_simd_scan = std::integral_constant<
+    bool, is_simd_range<In>::value &&
+              std::is_same<typename std::iterator_traits<In>::value_type,
+                           typename std::iterator_traits<Out>::value_type>::value>;
+
+/**\internal
+ * Loads the \p count < V::Size elements at \p p into a vector. The remaining lanes are
+ * filled with \p p[0].
+ */
+template <class V, class T>
+Vc_INTRINSIC V simd_load_partial(const T *p, std::size_t count)
+{
+    alignas(V::MemoryAlignment) T tmp[V::Size];
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        tmp[i] = p[i < count ? i : 0];
+    }
+    return V(&tmp[0], Vc::Aligned);
+}
+
+/**\internal
+ * Reduces the first \p count lanes of \p v with \p op.
+ */
+template <class V, class Op>
+Vc_INTRINSIC typename V::EntryType simd_reduce_lanes(const V &v, std::size_t count, Op &op)
+{
+    using T = typename V::EntryType;
+    alignas(V::MemoryAlignment) T tmp[V::Size];
+    v.store(&tmp[0], Vc::Aligned);
+    T r = tmp[0];
+    for (std::size_t i = 1; i < count; ++i) {
+        r = op(r, tmp[i]);
+    }
+    return r;
+}
+
+/**\internal
+ * Reduces \p n > 0 elements. \p load(i) returns the (transformed) vector of the elements
+ * at offset i, \p load_partial(i, k) the same for the k < V::Size elements at offset i,
+ * and \p step(acc, i) returns \p acc combined with the vector at offset i.
+ *
+ * Four independent accumulators hide the latency of \p op. The tail is combined with a
+ * masked \p op, so no identity element of \p op is required.
+ */
+template <class V, class Op, class Load, class LoadPartial, class Step>
+inline typename V::EntryType simd_reduce_impl(std::size_t n, Op &op, Load &&load,
+                                              LoadPartial &&load_partial, Step &&step)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t W = V::Size;
+    if (n < W) {
+        return simd_reduce_lanes(load_partial(0, n), n, op);
+    }
+    V acc0 = load(0);
+    std::size_t i = W;
+    if (n >= 4 * W) {
+        V acc1 = load(W);
+        V acc2 = load(2 * W);
+        V acc3 = load(3 * W);
+        for (i = 4 * W; i + 4 * W <= n; i += 4 * W) {
+            acc0 = step(acc0, i);
+            acc1 = step(acc1, i + W);
+            acc2 = step(acc2, i + 2 * W);
+            acc3 = step(acc3, i + 3 * W);
+        }
+        acc0 = op(op(acc0, acc1), op(acc2, acc3));
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = step(acc0, i);
+    }
+    if (i < n) {
+        const std::size_t k = n - i;
+        acc0 = iif(V::IndexesFromZero() < V(T(k)), V(op(acc0, load_partial(i, k))), acc0);
+    }
+    return simd_reduce_lanes(acc0, W, op);
+}
+
+template <class It, class T, class Op>
+inline T simd_reduce(It first, std::size_t n, T init, Op &op, std::true_type)
+{
+    using U = typename std::iterator_traits<It>::value_type;
+    using UV = Vector<U>;
+    using V = reduce_vector<U, T>;
+    if (n == 0) {
+        return init;
+    }
+    const U *p = std::addressof(*first);
+    const auto load = [&](std::size_t i) {
+        return reduce_cast<V>(UV(p + i, Vc::Unaligned));
+    };
+    return op(init, simd_reduce_impl<V>(
+                        n, op, load,
+                        [&](std::size_t i, std::size_t k) {
+                            return reduce_cast<V>(simd_load_partial<UV>(p + i, k));
+                        },
+                        [&](const V &acc, std::size_t i) { return V(op(acc, load(i))); }));
+}
+template <class It, class T, class Op>
+inline T simd_reduce(It first, std::size_t n, T init, Op &op, std::false_type)
+{
+    for (; n; --n, ++first) {
+        init = op(init, *first);
+    }
+    return init;
+}
+
+template <class It, class T, class ReduceOp, class TransformOp>
+inline T simd_transform_reduce(It first, std::size_t n, T init, ReduceOp &reduce,
+                               TransformOp &transform, std::true_type)
+{
+    using U = typename std::iterator_traits<It>::value_type;
+    using UV = Vector<U>;
+    using V = reduce_vector<U, T>;
+    if (n == 0) {
+        return init;
+    }
+    const U *p = std::addressof(*first);
+    const auto load = [&](std::size_t i) {
+        return V(transform(reduce_cast<V>(UV(p + i, Vc::Unaligned))));
+    };
+    return reduce(init, simd_reduce_impl<V>(
+                            n, reduce, load,
+                            [&](std::size_t i, std::size_t k) {
+                                return V(transform(
+                                    reduce_cast<V>(simd_load_partial<UV>(p + i, k))));
+                            },
+                            [&](const V &acc, std::size_t i) {
+                                return V(reduce(acc, load(i)));
+                            }));
+}
+template <class It, class T, class ReduceOp, class TransformOp>
+inline T simd_transform_reduce(It first, std::size_t n, T init, ReduceOp &reduce,
+                               TransformOp &transform, std::false_type)
+{
+    for (; n; --n, ++first) {
+        init = reduce(init, transform(*first));
+    }
+    return init;
+}
+
+template <class It1, class It2, class T, class ReduceOp, class TransformOp>
+inline T simd_transform_reduce(It1 first1, std::size_t n, It2 first2, T init,
+                               ReduceOp &reduce, TransformOp &transform, std::true_type)
+{
+    using U = typename std::iterator_traits<It1>::value_type;
+    using UV = Vector<U>;
+    using V = reduce_vector<U, T>;
+    if (n == 0) {
+        return init;
+    }
+    const U *p1 = std::addressof(*first1);
+    const auto *p2 = std::addressof(*first2);
+    const auto load = [&](std::size_t i) {
+        return V(transform(reduce_cast<V>(UV(p1 + i, Vc::Unaligned)),
+                           reduce_cast<V>(UV(p2 + i, Vc::Unaligned))));
+    };
+    return reduce(init, simd_reduce_impl<V>(
+                            n, reduce, load,
+                            [&](std::size_t i, std::size_t k) {
+                                return V(transform(
+                                    reduce_cast<V>(simd_load_partial<UV>(p1 + i, k)),
+                                    reduce_cast<V>(simd_load_partial<UV>(p2 + i, k))));
+                            },
+                            [&](const V &acc, std::size_t i) {
+                                return V(reduce(acc, load(i)));
+                            }));
+}
+template <class It1, class It2, class T, class ReduceOp, class TransformOp>
+inline T simd_transform_reduce(It1 first1, std::size_t n, It2 first2, T init,
+                               ReduceOp &reduce, TransformOp &transform, std::false_type)
+{
+    for (; n; --n, ++first1, ++first2) {
+        init = reduce(init, transform(*first1, *first2));
+    }
+    return init;
+}
+
+/**\internal
+ * Dot product: the default operations of the binary simd_transform_reduce use fma in the
+ * accumulation step.
+ */
+template <class It1, class It2, class T>
+inline T simd_dot(It1 first1, std::size_t n, It2 first2, T init, std::true_type)
+{
+    using U = typename std::iterator_traits<It1>::value_type;
+    using UV = Vector<U>;
+    using V = reduce_vector<U, T>;
+    if (n == 0) {
+        return init;
+    }
+    simd_plus plus;
+    const U *p1 = std::addressof(*first1);
+    const auto *p2 = std::addressof(*first2);
+    const auto load1 = [&](std::size_t i) {
+        return reduce_cast<V>(UV(p1 + i, Vc::Unaligned));
+    };
+    const auto load2 = [&](std::size_t i) {
+        return reduce_cast<V>(UV(p2 + i, Vc::Unaligned));
+    };
+    return init + simd_reduce_impl<V>(
+                      n, plus, [&](std::size_t i) { return V(load1(i) * load2(i)); },
+                      [&](std::size_t i, std::size_t k) {
+                          return V(reduce_cast<V>(simd_load_partial<UV>(p1 + i, k)) *
+                                   reduce_cast<V>(simd_load_partial<UV>(p2 + i, k)));
+                      },
+                      [&](const V &acc, std::size_t i) {
+                          return V(multiply_add(load1(i), load2(i), acc));
+                      });
+}
+template <class It1, class It2, class T>
+inline T simd_dot(It1 first1, std::size_t n, It2 first2, T init, std::false_type)
+{
+    for (; n; --n, ++first1, ++first2) {
+        init = init + *first1 * *first2;
+    }
+    return init;
+}
+
+/**\internal
+ * Inclusive scan of the lanes of \p x in log2(V::Size) steps.
+ */
+template <class V, class Op> Vc_INTRINSIC V simd_scan_register(V x, Op &op)
+{
+    using T = typename V::EntryType;
+    const V index = V::IndexesFromZero();
+    // unrolled, since the shifts need constant amounts to compile to single instructions
+    if (V::Size > 1) x = iif(index > V(T(0)), V(op(x, x.shifted(-1))), x);
+    if (V::Size > 2) x = iif(index > V(T(1)), V(op(x, x.shifted(-2))), x);
+    if (V::Size > 4) x = iif(index > V(T(3)), V(op(x, x.shifted(-4))), x);
+    if (V::Size > 8) x = iif(index > V(T(7)), V(op(x, x.shifted(-8))), x);
+    if (V::Size > 16) x = iif(index > V(T(15)), V(op(x, x.shifted(-16))), x);
+    return x;
+}
+
+/**\internal
+ * Scans the full vectors of the \p n elements at \p in, starting from the broadcast \p
+ * carry, and returns the number of elements processed. \p store(i, x, prev) receives the
+ * inclusive scan \p x of the vector at offset i and \p prev, whose last lane holds the
+ * result before offset i.
+ *
+ * Four vectors are scanned and combined with each other independently of \p carry, so
+ * that only one op and one broadcast per four vectors are on the critical path.
+ */
+template <class V, class Op, class Store>
+inline std::size_t simd_scan_vectors(const typename V::EntryType *in, std::size_t n,
+                                     Op &op, V &carry, Store &&store)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t W = V::Size;
+    std::size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        V x0 = simd_scan_register(V(in + i, Vc::Unaligned), op);
+        V x1 = simd_scan_register(V(in + i + W, Vc::Unaligned), op);
+        V x2 = simd_scan_register(V(in + i + 2 * W, Vc::Unaligned), op);
+        V x3 = simd_scan_register(V(in + i + 3 * W, Vc::Unaligned), op);
+        x1 = op(V(T(x0[W - 1])), x1);
+        x2 = op(V(T(x1[W - 1])), x2);
+        x3 = op(V(T(x2[W - 1])), x3);
+        const V c = carry;
+        x0 = op(c, x0);
+        x1 = op(c, x1);
+        x2 = op(c, x2);
+        x3 = op(c, x3);
+        store(i, x0, c);
+        store(i + W, x1, x0);
+        store(i + 2 * W, x2, x1);
+        store(i + 3 * W, x3, x2);
+        carry = V(T(x3[W - 1]));
+    }
+    for (; i + W <= n; i += W) {
+        const V c = carry;
+        const V x = op(c, simd_scan_register(V(in + i, Vc::Unaligned), op));
+        store(i, x, c);
+        carry = V(T(x[W - 1]));
+    }
+    return i;
+}
+
+template <class InputIt, class OutputIt, class Op, class T>
+inline OutputIt simd_inclusive_scan(InputIt first, std::size_t n, OutputIt d_first, Op &op,
+                                    T carry, bool hasCarry, std::true_type)
+{
+    using V = Vector<T>;
+    const T *in = std::addressof(*first);
+    T *out = std::addressof(*d_first);
+    std::size_t i = 0;
+    if (!hasCarry && n >= V::Size) {
+        const V x = simd_scan_register(V(in, Vc::Unaligned), op);
+        x.store(out, Vc::Unaligned);
+        carry = x[V::Size - 1];
+        hasCarry = true;
+        i = V::Size;
+    }
+    if (hasCarry) {
+        const std::size_t offset = i;
+        V carryV = carry;
+        i += simd_scan_vectors(in + offset, n - offset, op, carryV,
+                               [&](std::size_t j, const V &x, const V &) {
+                                   x.store(out + offset + j, Vc::Unaligned);
+                               });
+        carry = carryV[0];
+    }
+    for (; i < n; ++i) {
+        carry = hasCarry ? T(op(carry, in[i])) : in[i];
+        hasCarry = true;
+        out[i] = carry;
+    }
+    return d_first + n;
+}
+template <class InputIt, class OutputIt, class Op, class T>
+inline OutputIt simd_inclusive_scan(InputIt first, std::size_t n, OutputIt d_first, Op &op,
+                                    T carry, bool hasCarry, std::false_type)
+{
+    for (; n; --n, ++first, ++d_first) {
+        carry = hasCarry ? T(op(carry, *first)) : T(*first);
+        hasCarry = true;
+        *d_first = carry;
+    }
+    return d_first;
+}
+
+template <class InputIt, class OutputIt, class T, class Op>
+inline OutputIt simd_exclusive_scan(InputIt first, std::size_t n, OutputIt d_first,
+                                    T carry, Op &op, std::true_type)
+{
+    using V = Vector<T>;
+    const T *in = std::addressof(*first);
+    T *out = std::addressof(*d_first);
+    V carryV = carry;
+    std::size_t i = simd_scan_vectors(
+        in, n, op, carryV, [&](std::size_t j, const V &x, const V &prev) {
+            x.shifted(-1, prev).store(out + j, Vc::Unaligned);
+        });
+    carry = carryV[0];
+    for (; i < n; ++i) {
+        const T x = in[i];
+        out[i] = carry;
+        carry = op(carry, x);
+    }
+    return d_first + n;
+}
+template <class InputIt, class OutputIt, class T, class Op>
+inline OutputIt simd_exclusive_scan(InputIt first, std::size_t n, OutputIt d_first,
+                                    T carry, Op &op, std::false_type)
+{
+    for (; n; --n, ++first, ++d_first) {
+        const T x = *first;
+        *d_first = carry;
+        carry = op(carry, x);
+    }
+    return d_first;
+}
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::reduce`: returns \p init combined with all elements in [\p first,
+ * \p last) using \p op.
+ *
+ * For contiguous ranges of the types supported by Vc::Vector the range is reduced with
+ * four independent vector accumulators (hiding the latency of \p op) and a masked tail.
+ * Thus \p op must be associative and commutative and callable with two Vc::Vector
+ * arguments as well as with two scalars, e.g. a generic lambda. The accumulators use the
+ * type of \p init, so e.g. an \c int \p init sums \c short elements without overflow.
+ * Note that floating-point results differ from a sequential `std::accumulate` because of
+ * the reordering.
+ *
+ * \code
+ * float sum = Vc::simd_reduce(data.begin(), data.end(), 0.f);
+ * float max = Vc::simd_reduce(data.begin(), data.end(), data[0],
+ *                             [](auto a, auto b) { return Vc::iif(a < b, b, a); });
+ * \endcode
+ */
+template <class InputIt, class T, class BinaryOp>
+inline T simd_reduce(InputIt first, InputIt last, T init, BinaryOp op)
+{
+    return Common::simd_reduce(first, std::distance(first, last), init, op,
+                               Common::is_simd_reduce<InputIt, T>());
+}
+/// \copybrief simd_reduce \details Uses `operator+`.
+template <class InputIt, class T> inline T simd_reduce(InputIt first, InputIt last, T init)
+{
+    return simd_reduce(first, last, init, Common::simd_plus());
+}
+/// \copybrief simd_reduce \details Uses `operator+` and a value-initialized \c init.
+template <class InputIt>
+inline typename std::iterator_traits<InputIt>::value_type simd_reduce(InputIt first,
+                                                                      InputIt last)
+{
+    return simd_reduce(first, last, typename std::iterator_traits<InputIt>::value_type(),
+                       Common::simd_plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::transform_reduce`: the dot product of the ranges [\p first1, \p
+ * last1) and [\p first2, ...) plus \p init, vectorized with four independent
+ * accumulators (using fma if the target supports it).
+ */
+template <class InputIt1, class InputIt2, class T>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init)
+{
+    return Common::simd_dot(first1, std::distance(first1, last1), first2, init,
+                            Common::is_simd_reduce<InputIt1, T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::transform_reduce`: applies \p transform to pairs of elements of the
+ * two ranges and reduces the results with \p reduce. The elements are converted to the
+ * type of \p init before \p transform is applied. Same requirements as simd_reduce for
+ * \p reduce; \p transform must be callable with two vectors (returning a vector) and two
+ * scalars.
+ */
+template <class InputIt1, class InputIt2, class T, class ReduceOp, class TransformOp>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+                               ReduceOp reduce, TransformOp transform)
+{
+    return Common::simd_transform_reduce(first1, std::distance(first1, last1), first2,
+                                         init, reduce, transform,
+                                         Common::is_simd_reduce<InputIt1, T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::transform_reduce`: applies \p transform to each element and reduces
+ * the results with \p reduce. See the binary overload for the requirements.
+ */
+template <class InputIt, class T, class ReduceOp, class TransformOp>
+inline T simd_transform_reduce(InputIt first, InputIt last, T init, ReduceOp reduce,
+                               TransformOp transform)
+{
+    return Common::simd_transform_reduce(first, std::distance(first, last), init, reduce,
+                                         transform, Common::is_simd_reduce<InputIt, T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::inclusive_scan`: writes the prefix sums of [\p first, \p last)
+ * (combined with \p op, starting from \p init) to \p d_first and returns the end of the
+ * output range.
+ *
+ * If input and output are contiguous ranges of the same type supported by Vc::Vector,
+ * each vector is scanned in-register in log2(Size) shift steps and combined with the
+ * carry of the previous vector. \p op must be associative and callable with vectors and
+ * scalars. In-place operation (\p d_first == \p first) is supported.
+ */
+template <class InputIt, class OutputIt, class BinaryOp, class T>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                    BinaryOp op, T init)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    return Common::simd_inclusive_scan(first, std::distance(first, last), d_first, op,
+                                       U(init), true,
+                                       Common::is_simd_scan<InputIt, OutputIt>());
+}
+/// \copybrief simd_inclusive_scan \details Without initial value.
+template <class InputIt, class OutputIt, class BinaryOp>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                    BinaryOp op)
+{
+    return Common::simd_inclusive_scan(
+        first, std::distance(first, last), d_first, op,
+        typename std::iterator_traits<InputIt>::value_type(), false,
+        Common::is_simd_scan<InputIt, OutputIt>());
+}
+/// \copybrief simd_inclusive_scan \details Uses `operator+`.
+template <class InputIt, class OutputIt>
+inline OutputIt simd_inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    return simd_inclusive_scan(first, last, d_first, Common::simd_plus());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::exclusive_scan`: like simd_inclusive_scan, but the i-th output
+ * element does not include the i-th input element; the first output is \p init.
+ */
+template <class InputIt, class OutputIt, class T, class BinaryOp>
+inline OutputIt simd_exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init,
+                                    BinaryOp op)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    return Common::simd_exclusive_scan(first, std::distance(first, last), d_first, U(init),
+                                       op, Common::is_simd_scan<InputIt, OutputIt>());
+}
+/// \copybrief simd_exclusive_scan \details Uses `operator+`.
+template <class InputIt, class OutputIt, class T>
+inline OutputIt simd_exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init)
+{
+    return simd_exclusive_scan(first, last, d_first, init, Common::simd_plus());
+}
+// }}}
+
+///////////////////////////////////////////////////////////////////////////////
+// simd_copy_if {{{
+namespace Common
+{
+template <class InputIt, class OutputIt, class UnaryPredicate>
+inline OutputIt simd_copy_if(InputIt first, std::size_t n, OutputIt d_first,
+                             UnaryPredicate &pred, std::true_type)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    using V = Vector<T>;
+    const T *in = std::addressof(*first);
+    T *out = std::addressof(*d_first);
+    T *const out0 = out;
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        const V x(in + i, Vc::Unaligned);
+        out += compress_store(x, typename V::mask_type(pred(x)), out);
+    }
+    if (i < n) {
+        const V x = simd_load_partial<V>(in + i, n - i);
+        const typename V::mask_type valid =
+            V::IndexesFromZero() < V(static_cast<T>(n - i));
+        out += compress_store(x, typename V::mask_type(pred(x)) && valid, out);
+    }
+    return d_first + (out - out0);
+}
+template <class InputIt, class OutputIt, class UnaryPredicate>
+inline OutputIt simd_copy_if(InputIt first, std::size_t n, OutputIt d_first,
+                             UnaryPredicate &pred, std::false_type)
+{
+    for (; n; --n, ++first) {
+        if (pred(*first)) {
+            *d_first = *first;
+            ++d_first;
+        }
+    }
+    return d_first;
+}
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of `std::copy_if`: copies the elements of [\p first, \p last) for which \p
+ * pred returns \c true to the range starting at \p d_first and returns the end of the
+ * output range.
+ *
+ * For contiguous ranges of the same type supported by Vc::Vector, \p pred is called with
+ * vectors and must return a mask; the selected entries are written with compress_store.
+ * Otherwise \p pred is called with single elements. Thus a generic lambda works for both:
+ * \code
+ * auto end = Vc::simd_copy_if(in.begin(), in.end(), out.begin(),
+ *                             [](auto x) { return x > 0.f; });
+ * \endcode
+ * The output range must not overlap the input range.
+ */
+template <class InputIt, class OutputIt, class UnaryPredicate>
+inline OutputIt simd_copy_if(InputIt first, InputIt last, OutputIt d_first,
+                             UnaryPredicate pred)
+{
+    return Common::simd_copy_if(first, std::distance(first, last), d_first, pred,
+                                Common::is_simd_scan<InputIt, OutputIt>());
+}
+// }}}
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
@@ -0,0 +1,383 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_AOS_SOA_H_
+#define VC_COMMON_AOS_SOA_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "indexsequence.h"
+#include "streaming.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// transpose_square {{{1
+/**\internal
+ * One stage of the transpose network: interleaves the upper half of the rows with the
+ * lower half (a perfect shuffle of rows and columns).
+ */
+template <class V, std::size_t... K>
+Vc_INTRINSIC void transpose_stage(V *Vc_RESTRICT r, index_sequence<K...>)
+{
+    constexpr std::size_t H = sizeof...(K);
+    const V lo[H] = {r[K].interleaveLow(r[K + H])...};
+    const V hi[H] = {r[K].interleaveHigh(r[K + H])...};
+    const int unused0[] = {(r[2 * K] = lo[K], 0)...};
+    const int unused1[] = {(r[2 * K + 1] = hi[K], 0)...};
+    (void)unused0;
+    (void)unused1;
+}
+
+template <class V>
+Vc_INTRINSIC void transpose_stages(V *, std::integral_constant<std::size_t, 1>)
+{
+}
+template <class V, std::size_t N>
+Vc_INTRINSIC void transpose_stages(V *Vc_RESTRICT r, std::integral_constant<std::size_t, N>)
+{
+    transpose_stage(r, make_index_sequence<V::Size / 2>());
+    transpose_stages(r, std::integral_constant<std::size_t, N / 2>());
+}
+
+/**\internal
+ * Transposes the V::Size × V::Size matrix with rows \p r in place, using log2(V::Size)
+ * stages of interleaveLow/interleaveHigh.
+ */
+template <class V> Vc_INTRINSIC void transpose_square(V *Vc_RESTRICT r)
+{
+    transpose_stages(r, std::integral_constant<std::size_t, V::Size>());
+}
+
+// AosSoaTraits {{{1
+/**\internal
+ * Describes the conversion of V::Size structures of \p N members of type
+ * V::EntryType. The structures are processed in blocks of V::Size members, each
+ * transposed with transpose_square. The last block reads (and writes) `Spill` entries
+ * past the last structure if \p N is not a multiple of V::Size.
+ */
+template <class V, std::size_t N> struct AosSoaTraits {
+    static constexpr std::size_t Size = V::Size;
+    static constexpr std::size_t Blocks = (N + Size - 1) / Size;
+    static constexpr std::size_t Spill = Blocks * Size - N;
+    /// number of structures after a full chunk that the spill may touch
+    static constexpr std::size_t SpillStructs = (Spill + N - 1) / N;
+    /// number of entries accessed by one chunk
+    static constexpr std::size_t ChunkExtent = (Size - 1) * N + Blocks * Size;
+};
+
+// deinterleave_chunk {{{1
+template <class V, std::size_t N, std::size_t B, std::size_t... S>
+Vc_INTRINSIC void deinterleave_block(const typename V::EntryType *mem, V *Vc_RESTRICT out,
+                                     index_sequence<S...>)
+{
+    V r[V::Size] = {V(mem + S * N + B * V::Size, Vc::Unaligned)...};
+    transpose_square(r);
+    const int unused[] = {(B * V::Size + S < N ? (out[B * V::Size + S] = r[S], 0) : 0)...};
+    (void)unused;
+}
+
+template <class V, std::size_t N, std::size_t... B>
+Vc_INTRINSIC void deinterleave_chunk(const typename V::EntryType *mem, V *Vc_RESTRICT out,
+                                     index_sequence<B...>)
+{
+    const int unused[] = {
+        (deinterleave_block<V, N, B>(mem, out, make_index_sequence<V::Size>()), 0)...};
+    (void)unused;
+}
+
+/**\internal
+ * Loads V::Size structures at \p mem into the member vectors \p out.
+ */
+template <class V, std::size_t N>
+Vc_INTRINSIC void deinterleave_chunk(const typename V::EntryType *mem, V *Vc_RESTRICT out)
+{
+    deinterleave_chunk<V, N>(mem, out, make_index_sequence<AosSoaTraits<V, N>::Blocks>());
+}
+
+// interleave_chunk {{{1
+template <class V, std::size_t N, std::size_t B, std::size_t... J>
+Vc_INTRINSIC void interleave_block(const V *Vc_RESTRICT in, V *Vc_RESTRICT r,
+                                   index_sequence<J...>)
+{
+    const int unused[] = {(r[J] = B * V::Size + J < N ? in[B * V::Size + J] : V::Zero(), 0)...};
+    (void)unused;
+    transpose_square(r);
+}
+
+template <class V, std::size_t N, std::size_t S, std::size_t... B>
+Vc_INTRINSIC void store_structure(typename V::EntryType *mem,
+                                  const V (*Vc_RESTRICT r)[V::Size], index_sequence<B...>)
+{
+    const int unused[] = {(r[B][S].store(mem + S * N + B * V::Size, Vc::Unaligned), 0)...};
+    (void)unused;
+}
+
+template <class V, std::size_t N, std::size_t... S, std::size_t... B>
+Vc_INTRINSIC void interleave_chunk(typename V::EntryType *mem, const V *Vc_RESTRICT in,
+                                   index_sequence<S...>, index_sequence<B...> blocks)
+{
+    V r[sizeof...(B)][V::Size];
+    const int unused0[] = {
+        (interleave_block<V, N, B>(in, r[B], make_index_sequence<V::Size>()), 0)...};
+    // the stores of one structure clobber the first `Spill` entries of the next one;
+    // ascending order ensures they are overwritten afterwards
+    const int unused1[] = {(store_structure<V, N, S>(mem, r, blocks), 0)...};
+    (void)unused0;
+    (void)unused1;
+}
+
+/**\internal
+ * Stores the member vectors \p in as V::Size structures to \p mem, writing `Spill`
+ * entries past the last structure.
+ */
+template <class V, std::size_t N>
+Vc_INTRINSIC void interleave_chunk(typename V::EntryType *mem, const V *Vc_RESTRICT in)
+{
+    interleave_chunk<V, N>(mem, in, make_index_sequence<V::Size>(),
+                           make_index_sequence<AosSoaTraits<V, N>::Blocks>());
+}
+
+// member loads and stores {{{1
+template <class V, class U>
+Vc_INTRINSIC void store_member(const V &v, U *mem, std::true_type /*aligned*/)
+{
+    simd_cast<rebind_vector_type<V, U>>(v).store(mem, Vc::Aligned | Vc::Streaming);
+}
+template <class V, class U>
+Vc_INTRINSIC void store_member(const V &v, U *mem, std::false_type /*aligned*/)
+{
+    simd_cast<rebind_vector_type<V, U>>(v).store(mem, Vc::Unaligned);
+}
+
+template <class V, class U, class Streaming, std::size_t... M>
+Vc_INTRINSIC void store_members(const V *Vc_RESTRICT v, U *const *soa, std::size_t i,
+                                Streaming streaming, index_sequence<M...>)
+{
+    const int unused[] = {(store_member(v[M], soa[M] + i, streaming), 0)...};
+    (void)unused;
+}
+
+template <class V, class U, std::size_t... M>
+Vc_INTRINSIC void load_members(V *Vc_RESTRICT v, const U *const *soa, std::size_t i,
+                               index_sequence<M...>)
+{
+    using W = rebind_vector_type<V, U>;
+    const int unused[] = {(v[M] = simd_cast<V>(W(soa[M] + i, Vc::Unaligned)), 0)...};
+    (void)unused;
+}
+
+// aos_to_soa_impl {{{1
+template <class V, std::size_t N, class U, class Streaming>
+inline std::size_t aos_to_soa_loop(const typename V::EntryType *aos, std::size_t count,
+                                   U *const *soa, Streaming streaming)
+{
+    using Traits = AosSoaTraits<V, N>;
+    std::size_t i = 0;
+    for (; i + V::Size + Traits::SpillStructs <= count; i += V::Size) {
+        V v[N];
+        deinterleave_chunk<V, N>(aos + i * N, v);
+        store_members(v, soa, i, streaming, make_index_sequence<N>());
+    }
+    return i;
+}
+
+template <class V, std::size_t N, class U>
+inline void aos_to_soa_impl(const typename V::EntryType *aos, std::size_t count,
+                            U *const *soa)
+{
+    using T = typename V::EntryType;
+    using W = rebind_vector_type<V, U>;
+    std::size_t i = 0;
+    if (count * N * sizeof(U) >= streaming_threshold &&
+        std::all_of(soa, soa + N, [](const U *p) {
+            return reinterpret_cast<std::uintptr_t>(p) % W::MemoryAlignment == 0;
+        })) {
+        i = aos_to_soa_loop<V, N>(aos, count, soa, std::true_type());
+        store_fence();
+    } else {
+        i = aos_to_soa_loop<V, N>(aos, count, soa, std::false_type());
+    }
+
+    // the remaining structures go through buffers, so that neither the spill nor the
+    // padding lanes touch memory beyond the end of the arrays
+    while (i < count) {
+        const std::size_t n = std::min(V::Size, count - i);
+        T buffer[AosSoaTraits<V, N>::ChunkExtent] = {};
+        std::memcpy(buffer, aos + i * N, n * N * sizeof(T));
+        V v[N];
+        deinterleave_chunk<V, N>(buffer, v);
+        for (std::size_t m = 0; m < N; ++m) {
+            store_partial(simd_cast<W>(v[m]), soa[m] + i, n);
+        }
+        i += n;
+    }
+}
+
+// soa_to_aos_impl {{{1
+template <class V, std::size_t N, class U>
+inline void soa_to_aos_impl(const U *const *soa, std::size_t count,
+                            typename V::EntryType *aos)
+{
+    using T = typename V::EntryType;
+    using W = rebind_vector_type<V, U>;
+    using Traits = AosSoaTraits<V, N>;
+    std::size_t i = 0;
+    for (; i + V::Size + Traits::SpillStructs <= count; i += V::Size) {
+        V v[N];
+        load_members(v, soa, i, make_index_sequence<N>());
+        interleave_chunk<V, N>(aos + i * N, v);
+    }
+    while (i < count) {
+        const std::size_t n = std::min(V::Size, count - i);
+        V v[N];
+        for (std::size_t m = 0; m < N; ++m) {
+            v[m] = simd_cast<V>(load_partial<W>(soa[m] + i, n));
+        }
+        T buffer[Traits::ChunkExtent];
+        interleave_chunk<V, N>(buffer, v);
+        std::memcpy(aos + i * N, buffer, n * N * sizeof(T));
+        i += n;
+    }
+}
+//}}}1
+}  // namespace Common
+
+/**
+ * \ingroup Containers
+ * \headerfile aos_soa.h <Vc/Memory>
+ *
+ * Converts the array of \p count structures at \p aos into one array per member.
+ *
+ * \p aos points to \p count consecutive structures of \p N members of type \p T each, i.e.
+ * `count * N` objects of type \p T. On return, `soa[m][i]` is member \p m of structure
+ * \p i, converted to \p U.
+ *
+ * The structures are loaded with full vector loads and reordered with in-register
+ * transpose networks, instead of one gather per member. The last structures go through
+ * local buffers, so that no memory past `aos + count * N` is read and nothing past
+ * `soa[m] + count` is written.
+ *
+ * If \p U differs from \p T (e.g. `short` members into `float` arrays), the member vectors
+ * are converted with simd_cast before they are stored.
+ *
+ * If the output exceeds a few MiB and all \p soa pointers are suitably aligned, the
+ * output is written with non-temporal stores, followed by a store fence.
+ *
+ * \code
+ * struct Hit { float x, y, z, t, e, q, w; };
+ *
+ * void split(const std::vector<Hit> &hits, Vc::Memory<Vc::float_v> (&out)[7])
+ * {
+ *   float *soa[7];
+ *   for (int m = 0; m < 7; ++m) {
+ *     soa[m] = out[m];
+ *   }
+ *   Vc::aos_to_soa(hits.data(), hits.size(), soa);
+ * }
+ * \endcode
+ *
+ * \tparam T A vectorizable type (see Vc::Vector).
+ * \tparam N The number of members. The network is efficient up to 16 members.
+ * \tparam U A vectorizable type.
+ */
+template <class T, std::size_t N, class U>
+inline enable_if<std::is_arithmetic<T>::value, void> aos_to_soa(const T *aos,
+                                                                std::size_t count,
+                                                                U *const (&soa)[N])
+{
+    static_assert(Traits::is_valid_vector_argument<T>::value &&
+                      Traits::is_valid_vector_argument<U>::value,
+                  "aos_to_soa requires vectorizable member types");
+    Common::aos_to_soa_impl<Vector<T>, N>(aos, count, &soa[0]);
+}
+
+/**
+ * \ingroup Containers
+ * \headerfile aos_soa.h <Vc/Memory>
+ *
+ * Overload for structure types \p S that consist of \p N members of type \p U, without
+ * padding.
+ */
+template <class S, std::size_t N, class U>
+inline enable_if<std::is_class<S>::value, void> aos_to_soa(const S *aos, std::size_t count,
+                                                           U *const (&soa)[N])
+{
+    static_assert(sizeof(S) == N * sizeof(U),
+                  "the structure type must consist of N members of type U");
+    aos_to_soa(reinterpret_cast<const U *>(aos), count, soa);
+}
+
+/**
+ * \ingroup Containers
+ * \headerfile aos_soa.h <Vc/Memory>
+ *
+ * The inverse of aos_to_soa: writes `soa[m][i]`, converted to \p T, to member \p m of
+ * structure \p i at \p aos, for all \p i < \p count.
+ *
+ * No memory past `soa[m] + count` is read and no memory past `aos + count * N` is
+ * written.
+ */
+template <class T, std::size_t N, class P>
+inline enable_if<std::is_arithmetic<T>::value, void> soa_to_aos(P const (&soa)[N],
+                                                                std::size_t count, T *aos)
+{
+    using U = typename std::remove_cv<typename std::remove_pointer<P>::type>::type;
+    static_assert(std::is_pointer<P>::value, "soa must be an array of pointers");
+    static_assert(Traits::is_valid_vector_argument<T>::value &&
+                      Traits::is_valid_vector_argument<U>::value,
+                  "soa_to_aos requires vectorizable member types");
+    const U *ptrs[N];
+    std::copy(&soa[0], &soa[N], &ptrs[0]);
+    Common::soa_to_aos_impl<Vector<T>, N>(ptrs, count, aos);
+}
+
+/**
+ * \ingroup Containers
+ * \headerfile aos_soa.h <Vc/Memory>
+ *
+ * Overload for structure types \p S that consist of \p N members of the SoA element type,
+ * without padding.
+ */
+template <class S, std::size_t N, class P>
+inline enable_if<std::is_class<S>::value, void> soa_to_aos(P const (&soa)[N],
+                                                           std::size_t count, S *aos)
+{
+    using U = typename std::remove_cv<typename std::remove_pointer<P>::type>::type;
+    static_assert(sizeof(S) == N * sizeof(U),
+                  "the structure type must consist of N members of type U");
+    soa_to_aos(soa, count, reinterpret_cast<U *>(aos));
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_AOS_SOA_H_
+
+// vim: foldmethod=marker
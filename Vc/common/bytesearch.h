@@ -0,0 +1,601 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_BYTESEARCH_H_
+#define VC_COMMON_BYTESEARCH_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// UTF-8 sequences {{{1
+/**\internal
+ * Returns the length of the well-formed UTF-8 sequence starting at \p p, or 0 if it is
+ * ill-formed or truncated by \p end. Well-formed follows RFC 3629: overlong forms,
+ * surrogates, and code points above U+10FFFF are rejected.
+ */
+inline std::size_t utf8_sequence_length(const unsigned char *p, const unsigned char *end)
+{
+    const unsigned c = p[0];
+    if (c < 0x80u) {
+        return 1;
+    }
+    std::size_t n;
+    unsigned lo = 0x80u, hi = 0xbfu;  // valid range of the second byte
+    if (c < 0xc2u) {  // continuation byte or overlong 2-byte form
+        return 0;
+    } else if (c < 0xe0u) {
+        n = 2;
+    } else if (c < 0xf0u) {
+        n = 3;
+        if (c == 0xe0u) {
+            lo = 0xa0u;  // overlong
+        } else if (c == 0xedu) {
+            hi = 0x9fu;  // surrogates
+        }
+    } else if (c < 0xf5u) {
+        n = 4;
+        if (c == 0xf0u) {
+            lo = 0x90u;  // overlong
+        } else if (c == 0xf4u) {
+            hi = 0x8fu;  // above U+10FFFF
+        }
+    } else {
+        return 0;
+    }
+    if (std::size_t(end - p) < n || p[1] < lo || p[1] > hi) {
+        return 0;
+    }
+    for (std::size_t i = 2; i < n; ++i) {
+        if ((p[i] & 0xc0u) != 0x80u) {
+            return 0;
+        }
+    }
+    return n;
+}
+
+/**\internal
+ * Decodes sequences starting at \p p until \p stop (or \p end) is reached. Returns the
+ * position after the last sequence, or nullptr and the offending position in \p p if a
+ * sequence is ill-formed.
+ */
+inline const unsigned char *utf8_decode_until(const unsigned char *&p,
+                                              const unsigned char *stop,
+                                              const unsigned char *end)
+{
+    while (p < stop) {
+        const std::size_t n = utf8_sequence_length(p, end);
+        if (n == 0) {
+            return nullptr;
+        }
+        p += n;
+    }
+    return p;
+}
+
+#if defined Vc_IMPL_SSE2 && !defined Vc_IMPL_Scalar
+// ByteBlock {{{1
+/**\internal
+ * The byte operations the search kernels need, on the widest integer register of the
+ * target. Comparisons return byte masks (0xff / 0x00); bits() packs them to one bit per
+ * byte with `pmovmskb`.
+ */
+struct ByteBlock {
+#ifdef Vc_IMPL_AVX2
+    typedef __m256i type;
+    static constexpr std::size_t Size = 32;
+
+    static Vc_INTRINSIC type load(const char *p)
+    {
+        return _mm256_load_si256(reinterpret_cast<const __m256i *>(p));
+    }
+    static Vc_INTRINSIC type loadu(const char *p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+    static Vc_INTRINSIC type broadcast(char c) { return _mm256_set1_epi8(c); }
+    static Vc_INTRINSIC type zero() { return _mm256_setzero_si256(); }
+    static Vc_INTRINSIC type cmpeq(type a, type b) { return _mm256_cmpeq_epi8(a, b); }
+    static Vc_INTRINSIC type or_(type a, type b) { return _mm256_or_si256(a, b); }
+    static Vc_INTRINSIC type and_(type a, type b) { return _mm256_and_si256(a, b); }
+    static Vc_INTRINSIC type sub8(type a, type b) { return _mm256_sub_epi8(a, b); }
+    static Vc_INTRINSIC std::uint32_t bits(type k)
+    {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(k));
+    }
+    /// The sum of the unsigned bytes of \p a.
+    static Vc_INTRINSIC std::size_t sum8(type a)
+    {
+        const __m256i s = _mm256_sad_epu8(a, zero());
+        const __m128i s2 = _mm_add_epi64(_mm256_castsi256_si128(s),
+                                         _mm256_extracti128_si256(s, 1));
+        return std::size_t(_mm_cvtsi128_si32(s2)) +
+               std::size_t(_mm_cvtsi128_si32(_mm_unpackhi_epi64(s2, s2)));
+    }
+#else
+    typedef __m128i type;
+    static constexpr std::size_t Size = 16;
+
+    static Vc_INTRINSIC type load(const char *p)
+    {
+        return _mm_load_si128(reinterpret_cast<const __m128i *>(p));
+    }
+    static Vc_INTRINSIC type loadu(const char *p)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    }
+    static Vc_INTRINSIC type broadcast(char c) { return _mm_set1_epi8(c); }
+    static Vc_INTRINSIC type zero() { return _mm_setzero_si128(); }
+    static Vc_INTRINSIC type cmpeq(type a, type b) { return _mm_cmpeq_epi8(a, b); }
+    static Vc_INTRINSIC type or_(type a, type b) { return _mm_or_si128(a, b); }
+    static Vc_INTRINSIC type and_(type a, type b) { return _mm_and_si128(a, b); }
+    static Vc_INTRINSIC type sub8(type a, type b) { return _mm_sub_epi8(a, b); }
+    static Vc_INTRINSIC std::uint32_t bits(type k)
+    {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(k));
+    }
+    /// The sum of the unsigned bytes of \p a.
+    static Vc_INTRINSIC std::size_t sum8(type a)
+    {
+        const __m128i s = _mm_sad_epu8(a, zero());
+        return std::size_t(_mm_cvtsi128_si32(s)) +
+               std::size_t(_mm_cvtsi128_si32(_mm_unpackhi_epi64(s, s)));
+    }
+#endif
+
+    /// The mask with the lowest \p n bits set, for 0 <= \p n <= Size.
+    static Vc_INTRINSIC std::uint32_t low_bits(std::size_t n)
+    {
+        return static_cast<std::uint32_t>((std::uint64_t(1) << n) - 1);
+    }
+    static Vc_INTRINSIC const char *align_down(const char *p)
+    {
+        return reinterpret_cast<const char *>(reinterpret_cast<std::uintptr_t>(p) &
+                                              ~std::uintptr_t(Size - 1));
+    }
+};
+
+// scan_aligned {{{1
+/**\internal
+ * Calls `f(block, bits)` for the aligned blocks covering [\p first, \p last), where
+ * `bits` is `match(block)` with the bits of the bytes outside the range cleared. Returns
+ * the block for which \p f first returned true, or nullptr.
+ *
+ * Only aligned loads are issued. The bytes before \p first in the first block and after
+ * \p last in the last block are read but never reported; an aligned block never crosses
+ * a page boundary, so these reads cannot fault.
+ */
+template <class Match, class F>
+Vc_INTRINSIC const char *scan_aligned(const char *first, const char *last,
+                                      const Match &match, F &&f)
+{
+    typedef ByteBlock B;
+    if (first == last) {
+        return nullptr;
+    }
+    const char *block = B::align_down(first);
+    std::uint32_t bits = match(block) & ~B::low_bits(first - block);
+    for (;;) {
+        const std::size_t available = last - block;
+        if (available <= B::Size) {
+            return f(block, bits & B::low_bits(available)) ? block : nullptr;
+        }
+        if (f(block, bits)) {
+            return block;
+        }
+        block += B::Size;
+        bits = match(block);
+    }
+}
+
+// find_byte {{{1
+/**\internal
+ * memchr on [\p first, \p last). The main loop compares four blocks and tests their
+ * combined mask with a single `pmovmskb`.
+ */
+inline const char *find_byte(const char *first, const char *last, char c)
+{
+    typedef ByteBlock B;
+    const B::type needle = B::broadcast(c);
+    const auto match = [&](const char *p) {
+        return B::bits(B::cmpeq(B::load(p), needle));
+    };
+    std::uint32_t found = 0;
+    const auto any = [&](const char *, std::uint32_t bits) {
+        found = bits;
+        return bits != 0;
+    };
+    if (std::size_t(last - first) <= 5 * B::Size) {
+        const char *block = scan_aligned(first, last, match, any);
+        return block ? block + _bit_scan_forward(found) : last;
+    }
+    // the first block is unaligned: handle it (and align) with scan_aligned
+    const char *block = B::align_down(first) + B::Size;
+    if (const char *hit = scan_aligned(first, block, match, any)) {
+        return hit + _bit_scan_forward(found);
+    }
+    for (; std::size_t(last - block) > 4 * B::Size; block += 4 * B::Size) {
+        const B::type k0 = B::cmpeq(B::load(block), needle);
+        const B::type k1 = B::cmpeq(B::load(block + B::Size), needle);
+        const B::type k2 = B::cmpeq(B::load(block + 2 * B::Size), needle);
+        const B::type k3 = B::cmpeq(B::load(block + 3 * B::Size), needle);
+        if (B::bits(B::or_(B::or_(k0, k1), B::or_(k2, k3)))) {
+            if (const std::uint32_t b0 = B::bits(k0)) {
+                return block + _bit_scan_forward(b0);
+            }
+            if (const std::uint32_t b1 = B::bits(k1)) {
+                return block + B::Size + _bit_scan_forward(b1);
+            }
+            if (const std::uint32_t b2 = B::bits(k2)) {
+                return block + 2 * B::Size + _bit_scan_forward(b2);
+            }
+            return block + 3 * B::Size + _bit_scan_forward(B::bits(k3));
+        }
+    }
+    const char *hit = scan_aligned(block, last, match, any);
+    return hit ? hit + _bit_scan_forward(found) : last;
+}
+
+// find_first_of {{{1
+/**\internal
+ * Up to this many needles are compared in registers; larger sets use a 256-bit lookup
+ * table.
+ */
+constexpr std::size_t MaxNeedleRegisters = 8;
+
+inline const char *find_first_of(const char *first, const char *last, const char *s_first,
+                                 const char *s_last)
+{
+    typedef ByteBlock B;
+    const std::size_t n = s_last - s_first;
+    if (n == 0) {
+        return last;
+    } else if (n == 1) {
+        return find_byte(first, last, *s_first);
+    } else if (n > MaxNeedleRegisters) {
+        bool table[256] = {};
+        for (const char *s = s_first; s != s_last; ++s) {
+            table[static_cast<unsigned char>(*s)] = true;
+        }
+        return std::find_if(first, last, [&](char c) {
+            return table[static_cast<unsigned char>(c)];
+        });
+    }
+    B::type needles[MaxNeedleRegisters];
+    for (std::size_t i = 0; i < n; ++i) {
+        needles[i] = B::broadcast(s_first[i]);
+    }
+    const auto match = [&](const char *p) {
+        const B::type data = B::load(p);
+        B::type k = B::or_(B::cmpeq(data, needles[0]), B::cmpeq(data, needles[1]));
+        for (std::size_t i = 2; i < n; ++i) {
+            k = B::or_(k, B::cmpeq(data, needles[i]));
+        }
+        return B::bits(k);
+    };
+    std::uint32_t found = 0;
+    const auto any = [&](const char *, std::uint32_t bits) {
+        found = bits;
+        return bits != 0;
+    };
+    const char *block = scan_aligned(first, last, match, any);
+    return block ? block + _bit_scan_forward(found) : last;
+}
+
+// search {{{1
+/**\internal
+ * Substring search: a candidate position must match the first and the last byte of the
+ * needle, which is tested for a whole block of positions with two unaligned loads. Only
+ * the candidates are verified with memcmp.
+ */
+inline const char *search(const char *first, const char *last, const char *s_first,
+                          const char *s_last)
+{
+    typedef ByteBlock B;
+    const std::size_t k = s_last - s_first;
+    if (k == 0) {
+        return first;
+    } else if (std::size_t(last - first) < k) {
+        return last;
+    } else if (k == 1) {
+        return find_byte(first, last, *s_first);
+    }
+    const B::type head = B::broadcast(s_first[0]);
+    const B::type tail = B::broadcast(s_last[-1]);
+    const char *p = first;
+    // all candidate positions are < end; the second load reads up to p + k - 2 + Size
+    const char *const end = last - (k - 1);
+    for (; std::size_t(end - p) >= B::Size; p += B::Size) {
+        std::uint32_t bits = B::bits(B::and_(B::cmpeq(B::loadu(p), head),
+                                             B::cmpeq(B::loadu(p + k - 1), tail)));
+        while (bits) {
+            const std::size_t i = _bit_scan_forward(bits);
+            if (std::memcmp(p + i + 1, s_first + 1, k - 2) == 0) {
+                return p + i;
+            }
+            bits &= bits - 1;
+        }
+    }
+    return std::search(p, last, s_first, s_last);
+}
+
+// count_byte {{{1
+/**\internal
+ * Counts \p c in [\p first, \p last). The body subtracts the compare masks (-1 per match)
+ * from byte counters, which are summed with `psadbw` every 255 blocks before they could
+ * overflow.
+ */
+inline std::size_t count_byte(const char *first, const char *last, char c)
+{
+    typedef ByteBlock B;
+    const B::type needle = B::broadcast(c);
+    const auto match = [&](const char *p) {
+        return B::bits(B::cmpeq(B::load(p), needle));
+    };
+    std::size_t n = 0;
+    const auto count = [&](const char *, std::uint32_t bits) {
+        n += Vc::Detail::popcnt32(bits);
+        return false;
+    };
+    const char *body = B::align_down(first) + B::Size;
+    const char *const body_end = B::align_down(last);
+    if (body >= body_end) {
+        scan_aligned(first, last, match, count);
+        return n;
+    }
+    scan_aligned(first, body, match, count);
+    while (body < body_end) {
+        const std::size_t blocks =
+            std::min<std::size_t>((body_end - body) / B::Size, 255);
+        B::type counters = B::zero();
+        for (std::size_t i = 0; i < blocks; ++i, body += B::Size) {
+            counters = B::sub8(counters, B::cmpeq(B::load(body), needle));
+        }
+        n += B::sum8(counters);
+    }
+    scan_aligned(body_end, last, match, count);
+    return n;
+}
+
+// utf8_find_invalid {{{1
+/**\internal
+ * Skips blocks of ASCII bytes with one unaligned load and `pmovmskb` each. A block with a
+ * non-ASCII byte is decoded sequence by sequence from that byte to the end of the block.
+ */
+inline const char *utf8_find_invalid(const char *first, const char *last)
+{
+    typedef ByteBlock B;
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(first);
+    const unsigned char *const end = reinterpret_cast<const unsigned char *>(last);
+    while (std::size_t(end - p) >= B::Size) {
+        const std::uint32_t bits = B::bits(B::loadu(reinterpret_cast<const char *>(p)));
+        if (bits == 0) {
+            p += B::Size;
+            continue;
+        }
+        const unsigned char *const stop = p + B::Size;
+        p += _bit_scan_forward(bits);
+        if (!utf8_decode_until(p, stop, end)) {
+            return reinterpret_cast<const char *>(p);
+        }
+    }
+    if (!utf8_decode_until(p, end, end)) {
+        return reinterpret_cast<const char *>(p);
+    }
+    return last;
+}
+
+// for_each_byte {{{1
+/**\internal
+ * Calls \p f with the position of every \p c in [\p first, \p last), in order.
+ */
+template <class F>
+Vc_INTRINSIC void for_each_byte(const char *first, const char *last, char c, F &&f)
+{
+    typedef ByteBlock B;
+    const B::type needle = B::broadcast(c);
+    scan_aligned(first, last,
+                 [&](const char *p) { return B::bits(B::cmpeq(B::load(p), needle)); },
+                 [&](const char *block, std::uint32_t bits) {
+                     for (; bits; bits &= bits - 1) {
+                         f(block + _bit_scan_forward(bits));
+                     }
+                     return false;
+                 });
+}
+#else   // Vc_IMPL_SSE2
+// scalar fallbacks {{{1
+inline const char *find_byte(const char *first, const char *last, char c)
+{
+    return std::find(first, last, c);
+}
+inline const char *find_first_of(const char *first, const char *last, const char *s_first,
+                                 const char *s_last)
+{
+    return std::find_first_of(first, last, s_first, s_last);
+}
+inline const char *search(const char *first, const char *last, const char *s_first,
+                          const char *s_last)
+{
+    return std::search(first, last, s_first, s_last);
+}
+inline std::size_t count_byte(const char *first, const char *last, char c)
+{
+    return std::count(first, last, c);
+}
+inline const char *utf8_find_invalid(const char *first, const char *last)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(first);
+    const unsigned char *const end = reinterpret_cast<const unsigned char *>(last);
+    return utf8_decode_until(p, end, end) ? last : reinterpret_cast<const char *>(p);
+}
+template <class F>
+Vc_INTRINSIC void for_each_byte(const char *first, const char *last, char c, F &&f)
+{
+    for (; first != last; ++first) {
+        if (*first == c) {
+            f(first);
+        }
+    }
+}
+#endif  // Vc_IMPL_SSE2
+//}}}1
+}  // namespace Common
+
+// simd_memchr {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Returns a pointer to the first byte equal to \p c in [\p first, \p last), or \p last if
+ * there is none.
+ *
+ * The byte search functions compare a whole SSE2 (16 bytes) or AVX2 (32 bytes) register
+ * of bytes per instruction. They only issue aligned loads outside of the given range:
+ * the first and last block are loaded from their aligned address and the bytes outside
+ * the range are masked off. Such a load never crosses a page boundary, but memory
+ * checkers may report it. Without SSE2 the functions forward to the standard algorithms.
+ */
+inline const char *simd_memchr(const char *first, const char *last, char c)
+{
+    return Common::find_byte(first, last, c);
+}
+
+// simd_find_first_of {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Returns a pointer to the first byte in [\p first, \p last) that is equal to any of the
+ * bytes in [\p s_first, \p s_last), or \p last if there is none. Up to 8 needles are
+ * compared in registers; larger needle sets use a lookup table.
+ */
+inline const char *simd_find_first_of(const char *first, const char *last,
+                                      const char *s_first, const char *s_last)
+{
+    return Common::find_first_of(first, last, s_first, s_last);
+}
+
+// simd_search {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Returns a pointer to the first occurrence of [\p s_first, \p s_last) in [\p first,
+ * \p last), or \p last if there is none (like std::search). Positions are filtered by
+ * comparing the first and the last byte of the needle for a whole register of candidate
+ * positions at once.
+ */
+inline const char *simd_search(const char *first, const char *last, const char *s_first,
+                               const char *s_last)
+{
+    return Common::search(first, last, s_first, s_last);
+}
+
+// simd_count {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Returns the number of bytes equal to \p c in [\p first, \p last), e.g. the number of
+ * lines when \p c is `'\n'`.
+ */
+inline std::size_t simd_count(const char *first, const char *last, char c)
+{
+    return Common::count_byte(first, last, c);
+}
+
+// simd_split {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Calls `f(begin, end)` for every field of [\p first, \p last) delimited by \p delimiter,
+ * in order. Like Python's `str.split(delimiter)`, `n` delimiters yield `n + 1` fields,
+ * some of which may be empty.
+ *
+ * In contrast to repeated calls to simd_memchr, every block is loaded and compared only
+ * once, which matters for short fields such as log lines.
+ *
+ * \code
+ * std::size_t longest = 0;
+ * Vc::simd_split(log.data(), log.data() + log.size(), '\n',
+ *                [&](const char *b, const char *e) {
+ *                    longest = std::max<std::size_t>(longest, e - b);
+ *                });
+ * \endcode
+ */
+template <class F>
+inline void simd_split(const char *first, const char *last, char delimiter, F &&f)
+{
+    const char *begin = first;
+    Common::for_each_byte(first, last, delimiter, [&](const char *p) {
+        f(begin, p);
+        begin = p + 1;
+    });
+    f(begin, last);
+}
+
+// simd_utf8_validate {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Returns a pointer to the first byte of the first ill-formed UTF-8 sequence in
+ * [\p first, \p last), or \p last if the range is valid UTF-8 (RFC 3629: overlong
+ * encodings, surrogates, and code points above U+10FFFF are ill-formed).
+ *
+ * Runs of ASCII are skipped a register at a time; multi-byte sequences are decoded one
+ * by one.
+ */
+inline const char *simd_utf8_find_invalid(const char *first, const char *last)
+{
+    return Common::utf8_find_invalid(first, last);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile bytesearch.h <Vc/Vc>
+ *
+ * Returns whether [\p first, \p last) is valid UTF-8.
+ * \see simd_utf8_find_invalid
+ */
+inline bool simd_utf8_validate(const char *first, const char *last)
+{
+    return Common::utf8_find_invalid(first, last) == last;
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_BYTESEARCH_H_
+
+// vim: foldmethod=marker
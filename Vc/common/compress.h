@@ -0,0 +1,480 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPRESS_H_
+#define VC_COMMON_COMPRESS_H_
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "maskedloadstore.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// generic {{{1
+/**\internal
+ * Element-wise compress_store for all vector types without a specialized implementation.
+ */
+template <class V, class M>
+Vc_INTRINSIC std::size_t compress_store_generic(const V &v, const M &m,
+                                                typename V::EntryType *ptr)
+{
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        if (m[i]) {
+            ptr[n++] = v[i];
+        }
+    }
+    return n;
+}
+
+/**\internal
+ * Element-wise expand_load for all vector types without a specialized implementation.
+ */
+template <class V, class M>
+Vc_INTRINSIC V expand_load_generic(const typename V::EntryType *ptr, const M &m)
+{
+    V r(0);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        if (m[i]) {
+            r[i] = ptr[n++];
+        }
+    }
+    return r;
+}
+
+template <class V, class M>
+Vc_INTRINSIC std::size_t compress_store(const V &v, const M &m, typename V::EntryType *ptr)
+{
+    return compress_store_generic(v, m, ptr);
+}
+template <class V, class M>
+Vc_INTRINSIC V expand_load(const typename V::EntryType *ptr, const M &m, V *)
+{
+    return expand_load_generic<V>(ptr, m);
+}
+
+#ifdef Vc_IMPL_SSSE3
+// SSE {{{1
+template <std::size_t N> using entry_size = std::integral_constant<std::size_t, N>;
+
+/**\internal
+ * Moves the lanes selected by \p bits to the front of \p v, using a shuffle mask from
+ * SSE::c_compress. The remaining lanes are zeroed.
+ */
+Vc_INTRINSIC __m128i sse_compress(__m128i v, unsigned bits, entry_size<8>)
+{
+    return _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::compress2[bits])));
+}
+Vc_INTRINSIC __m128i sse_compress(__m128i v, unsigned bits, entry_size<4>)
+{
+    return _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::compress4[bits])));
+}
+Vc_INTRINSIC __m128i sse_compress(__m128i v, unsigned bits, entry_size<2>)
+{
+    return _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::compress8[bits])));
+}
+/**\internal
+ * A table for 16 byte lanes would need 1 MiB. Instead the two halves are widened to 16-bit
+ * lanes, compressed with the 8-lane table, and the upper half is moved behind the \c
+ * popcnt8(bits & 0xff) lanes of the lower half.
+ */
+Vc_INTRINSIC __m128i sse_compress(__m128i v, unsigned bits, entry_size<1>)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = sse_compress(_mm_unpacklo_epi8(v, zero), bits & 0xffu, entry_size<2>());
+    const __m128i hi = sse_compress(_mm_unpackhi_epi8(v, zero), bits >> 8, entry_size<2>());
+    const __m128i nlo = _mm_set1_epi8(static_cast<char>(popcnt8(bits & 0xffu)));
+    const __m128i iota =
+        _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::_IndexesFromZero16));
+    // lane i < nlo is zeroed, lane i >= nlo reads lane i - nlo of hi in the upper half
+    const __m128i shift = _mm_or_si128(
+        _mm_sub_epi8(_mm_add_epi8(iota, _mm_set1_epi8(8)), nlo), _mm_cmpgt_epi8(nlo, iota));
+    return _mm_or_si128(_mm_packus_epi16(lo, zero),
+                        _mm_shuffle_epi8(_mm_packus_epi16(zero, hi), shift));
+}
+
+/**\internal
+ * The inverse of sse_compress: moves the front lanes of \p v to the lanes selected by \p
+ * bits. The remaining lanes are zeroed.
+ */
+Vc_INTRINSIC __m128i sse_expand(__m128i v, unsigned bits, entry_size<8>)
+{
+    return _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::expand2[bits])));
+}
+Vc_INTRINSIC __m128i sse_expand(__m128i v, unsigned bits, entry_size<4>)
+{
+    return _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::expand4[bits])));
+}
+Vc_INTRINSIC __m128i sse_expand(__m128i v, unsigned bits, entry_size<2>)
+{
+    return _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::expand8[bits])));
+}
+Vc_INTRINSIC __m128i sse_expand(__m128i v, unsigned bits, entry_size<1>)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i iota =
+        _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::_IndexesFromZero16));
+    // the upper half starts behind the popcnt8(bits & 0xff) entries of the lower half
+    const __m128i hi = _mm_shuffle_epi8(
+        v, _mm_add_epi8(iota, _mm_set1_epi8(static_cast<char>(popcnt8(bits & 0xffu)))));
+    return _mm_packus_epi16(
+        sse_expand(_mm_unpacklo_epi8(v, zero), bits & 0xffu, entry_size<2>()),
+        sse_expand(_mm_unpacklo_epi8(hi, zero), bits >> 8, entry_size<2>()));
+}
+
+/**\internal
+ * Stores the low \p bytes Bytes of \p v to \p ptr in at most four pieces of 8, 4, 2 and 1
+ * Bytes. Requires \p bytes < 16.
+ */
+Vc_INTRINSIC void store_bytes(char *ptr, __m128i v, std::size_t bytes)
+{
+    if (bytes & 8) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), v);
+        v = _mm_srli_si128(v, 8);
+        ptr += 8;
+    }
+    int x = _mm_cvtsi128_si32(v);
+    if (bytes & 4) {
+        std::memcpy(ptr, &x, 4);
+        x = _mm_cvtsi128_si32(_mm_srli_si128(v, 4));
+        ptr += 4;
+    }
+    if (bytes & 2) {
+        const short s = static_cast<short>(x);
+        std::memcpy(ptr, &s, 2);
+        x >>= 16;
+        ptr += 2;
+    }
+    if (bytes & 1) {
+        *ptr = static_cast<char>(x);
+    }
+}
+
+/**\internal
+ * Loads \p bytes Bytes from \p ptr into the low Bytes of the returned vector, in at most
+ * four pieces of 8, 4, 2 and 1 Bytes. The remaining Bytes are zero. Requires \p bytes < 16.
+ */
+Vc_INTRINSIC __m128i load_bytes(const char *ptr, std::size_t bytes)
+{
+    // start with the piece at the highest address and shift it up for each lower piece
+    __m128i r = _mm_setzero_si128();
+    ptr += bytes;
+    if (bytes & 1) {
+        ptr -= 1;
+        r = _mm_cvtsi32_si128(static_cast<unsigned char>(*ptr));
+    }
+    if (bytes & 2) {
+        ptr -= 2;
+        unsigned short s;
+        std::memcpy(&s, ptr, 2);
+        r = _mm_or_si128(_mm_slli_si128(r, 2), _mm_cvtsi32_si128(s));
+    }
+    if (bytes & 4) {
+        ptr -= 4;
+        int x;
+        std::memcpy(&x, ptr, 4);
+        r = _mm_or_si128(_mm_slli_si128(r, 4), _mm_cvtsi32_si128(x));
+    }
+    if (bytes & 8) {
+        ptr -= 8;
+        r = _mm_or_si128(_mm_slli_si128(r, 8),
+                         _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr)));
+    }
+    return r;
+}
+
+/**\internal
+ * Stores the first \p n entries of \p v to \p ptr without touching the memory behind: a
+ * full store if all entries are stored, `maskmovdqu` if the vector lies within one page,
+ * and otherwise store_bytes.
+ */
+template <class T> Vc_INTRINSIC void store_front(T *ptr, __m128i v, std::size_t n)
+{
+    const std::size_t bytes = n * sizeof(T);
+    if (bytes == 16) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), v);
+    } else if (bytes == 0) {
+        return;
+    } else if (Common::is_within_one_page<16>(ptr)) {
+        // maskmovdqu may fault on the inactive Bytes if they cross into the next page
+        const __m128i mask = _mm_cmplt_epi8(
+            _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            _mm_set1_epi8(static_cast<char>(bytes)));
+        _mm_maskmoveu_si128(v, mask, reinterpret_cast<char *>(ptr));
+    } else {
+        store_bytes(reinterpret_cast<char *>(ptr), v, bytes);
+    }
+}
+
+/**\internal
+ * Loads \p n entries from \p ptr into the front of a vector without a read that could
+ * fault: a full load if the vector lies within one page, otherwise load_bytes. The entries
+ * behind \p n are unspecified.
+ */
+template <class T> Vc_INTRINSIC __m128i load_front(const T *ptr, std::size_t n)
+{
+    const std::size_t bytes = n * sizeof(T);
+    if (bytes == 16 || (bytes > 0 && Common::is_overread_safe<16>(ptr))) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+    }
+    return load_bytes(reinterpret_cast<const char *>(ptr), bytes);
+}
+
+template <class T>
+Vc_INTRINSIC std::size_t sse_compress_store(__m128i v, unsigned bits, T *ptr)
+{
+    const std::size_t n = popcnt16(bits);
+    store_front(ptr, sse_compress(v, bits, entry_size<sizeof(T)>()), n);
+    return n;
+}
+template <class T> Vc_INTRINSIC __m128i sse_expand_load(const T *ptr, unsigned bits)
+{
+    return sse_expand(load_front(ptr, popcnt16(bits)), bits, entry_size<sizeof(T)>());
+}
+
+template <class T>
+Vc_INTRINSIC std::size_t compress_store(const Vector<T, VectorAbi::Sse> &v,
+                                        const Vc::Mask<T, VectorAbi::Sse> &m, T *ptr)
+{
+    return sse_compress_store(SSE::sse_cast<__m128i>(v.data()), m.toInt(), ptr);
+}
+template <class T>
+Vc_INTRINSIC Vector<T, VectorAbi::Sse> expand_load(const T *ptr,
+                                                   const Vc::Mask<T, VectorAbi::Sse> &m,
+                                                   Vector<T, VectorAbi::Sse> *)
+{
+    using V = Vector<T, VectorAbi::Sse>;
+    return SSE::sse_cast<typename V::VectorType>(sse_expand_load(ptr, m.toInt()));
+}
+#endif  // Vc_IMPL_SSSE3
+
+#ifdef Vc_IMPL_AVX
+// AVX {{{1
+/**\internal
+ * The mask bits of an AVX mask. For 16 lanes the two halves are packed to bytes, which
+ * does not require BMI2 (in contrast to Mask::toInt).
+ */
+template <class T> Vc_INTRINSIC unsigned avx_mask_bits(const Vc::Mask<T, VectorAbi::Avx> &m)
+{
+    return m.toInt();
+}
+Vc_INTRINSIC unsigned avx_mask_bits16(__m256i k)
+{
+    return _mm_movemask_epi8(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k)));
+}
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC unsigned avx_mask_bits(const Vc::Mask<short, VectorAbi::Avx> &m)
+{
+    return avx_mask_bits16(AVX::avx_cast<__m256i>(m.data()));
+}
+Vc_INTRINSIC unsigned avx_mask_bits(const Vc::Mask<unsigned short, VectorAbi::Avx> &m)
+{
+    return avx_mask_bits16(AVX::avx_cast<__m256i>(m.data()));
+}
+#endif
+
+/**\internal
+ * Compresses the two 128-bit halves separately with the SSE shuffle masks.
+ */
+template <class T>
+Vc_INTRINSIC std::size_t avx_compress_store(__m256i v, unsigned bits, T *ptr, std::false_type)
+{
+    constexpr unsigned HalfSize = 16 / sizeof(T);
+    const unsigned lo = bits & ((1u << HalfSize) - 1);
+    const std::size_t n = sse_compress_store(AVX::lo128(v), lo, ptr);
+    return n + sse_compress_store(AVX::hi128(v), bits >> HalfSize, ptr + n);
+}
+template <class T>
+Vc_INTRINSIC __m256i avx_expand_load(const T *ptr, unsigned bits, __m256i, std::false_type)
+{
+    constexpr unsigned HalfSize = 16 / sizeof(T);
+    const unsigned lo = bits & ((1u << HalfSize) - 1);
+    return AVX::concat(sse_expand_load(ptr, lo),
+                       sse_expand_load(ptr + popcnt16(lo), bits >> HalfSize));
+}
+
+#ifdef Vc_IMPL_AVX2
+/**\internal
+ * Converts a 4-bit mask of 64-bit lanes to the 8-bit mask of the corresponding 32-bit
+ * lanes.
+ */
+Vc_INTRINSIC unsigned avx2_bits8(unsigned bits, entry_size<4>) { return bits; }
+Vc_INTRINSIC unsigned avx2_bits8(unsigned bits, entry_size<8>)
+{
+    bits = (bits | (bits << 2)) & 0x33u;
+    bits = (bits | (bits << 1)) & 0x55u;
+    return bits | (bits << 1);
+}
+
+/**\internal
+ * Expands 8 packed 4-bit indexes to the 32-bit lanes of a _mm256_permutevar8x32 control.
+ * The permutation ignores the upper bits of each lane.
+ */
+Vc_INTRINSIC __m256i avx2_unpack_nibbles(unsigned idx)
+{
+    return _mm256_srlv_epi32(_mm256_set1_epi32(idx),
+                             _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+}
+
+/**\internal
+ * The 32-bit lane mask for the first \p n32 lanes, for maskload/maskstore.
+ */
+Vc_INTRINSIC __m256i avx2_front_mask(unsigned n32)
+{
+    return _mm256_cmpgt_epi32(
+        _mm256_set1_epi32(n32),
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(AVX::_IndexesFromZero32)));
+}
+
+/**\internal
+ * Permutes 32-bit lanes: with BMI2 the indexes of the selected lanes are extracted from
+ * 0x76543210 with PEXT, otherwise they are looked up in AVX::c_compress.
+ */
+template <class T>
+Vc_INTRINSIC std::size_t avx_compress_store(__m256i v, unsigned bits, T *ptr, std::true_type)
+{
+    const unsigned bits8 = avx2_bits8(bits, entry_size<sizeof(T)>());
+#ifdef Vc_IMPL_BMI2
+    const unsigned idx = _pext_u32(0x76543210u, _pdep_u32(bits8, 0x11111111u) * 0xfu);
+#else
+    const unsigned idx = AVX::c_compress::compress8[bits8];
+#endif
+    const unsigned n32 = popcnt8(bits8);
+    _mm256_maskstore_epi32(reinterpret_cast<int *>(ptr), avx2_front_mask(n32),
+                           _mm256_permutevar8x32_epi32(v, avx2_unpack_nibbles(idx)));
+    return n32 * 4 / sizeof(T);
+}
+template <class T>
+Vc_INTRINSIC __m256i avx_expand_load(const T *ptr, unsigned bits, __m256i k, std::true_type)
+{
+    const unsigned bits8 = avx2_bits8(bits, entry_size<sizeof(T)>());
+#ifdef Vc_IMPL_BMI2
+    const unsigned idx = _pdep_u32(0x76543210u, _pdep_u32(bits8, 0x11111111u) * 0xfu);
+#else
+    const unsigned idx = AVX::c_compress::expand8[bits8];
+#endif
+    const __m256i v = _mm256_maskload_epi32(reinterpret_cast<const int *>(ptr),
+                                            avx2_front_mask(popcnt8(bits8)));
+    return _mm256_and_si256(_mm256_permutevar8x32_epi32(v, avx2_unpack_nibbles(idx)), k);
+}
+template <class T>
+using avx_uses_permute = std::integral_constant<bool, (sizeof(T) >= 4)>;
+#else
+template <class T> using avx_uses_permute = std::false_type;
+#endif  // Vc_IMPL_AVX2
+
+template <class T>
+Vc_INTRINSIC std::size_t compress_store(const Vector<T, VectorAbi::Avx> &v,
+                                        const Vc::Mask<T, VectorAbi::Avx> &m, T *ptr)
+{
+    return avx_compress_store(AVX::avx_cast<__m256i>(v.data()), avx_mask_bits(m), ptr,
+                              avx_uses_permute<T>());
+}
+template <class T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx> expand_load(const T *ptr,
+                                                   const Vc::Mask<T, VectorAbi::Avx> &m,
+                                                   Vector<T, VectorAbi::Avx> *)
+{
+    using V = Vector<T, VectorAbi::Avx>;
+    return AVX::avx_cast<typename V::VectorType>(
+        avx_expand_load(ptr, avx_mask_bits(m), AVX::avx_cast<__m256i>(m.data()),
+                        avx_uses_permute<T>()));
+}
+#endif  // Vc_IMPL_AVX
+// }}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile compress.h <Vc/Vc>
+ *
+ * Stores the entries of \p v where \p mask is \c true contiguously to \p ptr (stream
+ * compaction) and returns their number. Memory behind the stored entries is not
+ * touched.
+ *
+ * With SSSE3 the entries are moved with a byte shuffle from a precomputed table indexed
+ * by the mask bits. With AVX2 32- and 64-bit entries use a lane permutation whose indexes
+ * are computed with PEXT (if BMI2 is available) or looked up from a table.
+ *
+ * \code
+ * float *out = ...;
+ * for (...) {
+ *     float_v x = ...;
+ *     out += Vc::compress_store(x, x > 0.f, out);
+ * }
+ * \endcode
+ */
+template <class T, class Abi>
+Vc_INTRINSIC std::size_t compress_store(const Vector<T, Abi> &v, const Mask<T, Abi> &mask,
+                                        T *ptr)
+{
+    return Detail::compress_store(v, mask, ptr);
+}
+/// \copydoc compress_store
+template <class T, std::size_t N, class V, std::size_t Wt>
+Vc_INTRINSIC std::size_t compress_store(const SimdArray<T, N, V, Wt> &v,
+                                        const SimdMaskArray<T, N, V, Wt> &mask, T *ptr)
+{
+    return Detail::compress_store_generic(v, mask, ptr);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile compress.h <Vc/Vc>
+ *
+ * The inverse of compress_store: returns a vector with the consecutive entries from \p
+ * ptr in the lanes where \p mask is \c true and zero in the other lanes. Exactly
+ * `mask.count()` entries are read from \p ptr.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> expand_load(const T *ptr, const Mask<T, Abi> &mask)
+{
+    return Detail::expand_load(ptr, mask, static_cast<Vector<T, Abi> *>(nullptr));
+}
+/// \copydoc expand_load
+template <class T, std::size_t N, class V, std::size_t Wt>
+Vc_INTRINSIC SimdArray<T, N, V, Wt> expand_load(const T *ptr,
+                                                const SimdMaskArray<T, N, V, Wt> &mask)
+{
+    return Detail::expand_load_generic<SimdArray<T, N, V, Wt>>(ptr, mask);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPRESS_H_
+
+// vim: foldmethod=marker
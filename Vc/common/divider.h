@@ -0,0 +1,544 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DIVIDER_H_
+#define VC_COMMON_DIVIDER_H_
+
+#include <cstdint>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+template <class T> class divider;
+
+namespace Common
+{
+// mulhi {{{1
+/**\internal
+ * The upper half of the double-width product of \p a and \p b.
+ */
+template <class T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && (sizeof(T) < 8), T> mulhi(T a, T b)
+{
+    using W = typename std::conditional<std::is_signed<T>::value, std::int64_t,
+                                        std::uint64_t>::type;
+    return static_cast<T>((W(a) * W(b)) >> (8 * sizeof(T)));
+}
+
+/**\internal
+ * Unsigned 64-bit mul-high from the four 32x32-bit partial products.
+ */
+Vc_INTRINSIC std::uint64_t mulhi_u64(std::uint64_t a, std::uint64_t b)
+{
+    const std::uint64_t lo = 0xffffffffu;
+    const std::uint64_t ll = (a & lo) * (b & lo);
+    const std::uint64_t hl = (a >> 32) * (b & lo);
+    const std::uint64_t lh = (a & lo) * (b >> 32);
+    const std::uint64_t hh = (a >> 32) * (b >> 32);
+    const std::uint64_t cross = (ll >> 32) + (hl & lo) + lh;
+    return hh + (hl >> 32) + (cross >> 32);
+}
+template <class T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && (sizeof(T) == 8), T> mulhi(T a, T b)
+{
+    const std::uint64_t hi = mulhi_u64(std::uint64_t(a), std::uint64_t(b));
+    if (!std::is_signed<T>::value) {
+        return T(hi);
+    }
+    // the signed high half differs from the unsigned one by b for negative a and by a
+    // for negative b
+    return T(hi - (a < 0 ? std::uint64_t(b) : 0u) - (b < 0 ? std::uint64_t(a) : 0u));
+}
+
+/**\internal
+ * Lane-wise fallback for vector types without a mul-high instruction.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> mulhi(const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Vector<T, Abi>::generate([&](int i) { return mulhi(T(a[i]), T(b[i])); });
+}
+
+#ifdef Vc_IMPL_SSE2
+/**\internal
+ * Unsigned 32-bit mul-high from the two `pmuludq` of the even and the odd lanes.
+ */
+Vc_INTRINSIC __m128i sse_mulhi_epu32(__m128i a, __m128i b)
+{
+    const __m128i hi02 = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+    const __m128i hi13 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_or_si128(hi02, _mm_and_si128(hi13, _mm_setr_epi32(0, -1, 0, -1)));
+}
+Vc_INTRINSIC __m128i sse_mulhi_epi32(__m128i a, __m128i b)
+{
+#ifdef Vc_IMPL_SSE4_1
+    const __m128i hi02 = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+    const __m128i hi13 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_or_si128(hi02, _mm_and_si128(hi13, _mm_setr_epi32(0, -1, 0, -1)));
+#else
+    // the signed high half differs from the unsigned one by b for negative a and by a
+    // for negative b
+    const __m128i correction =
+        _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                      _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi32(sse_mulhi_epu32(a, b), correction);
+#endif
+}
+
+/**\internal
+ * 8-bit mul-high via the 16-bit products of the widened lanes.
+ */
+Vc_INTRINSIC __m128i sse_mulhi_epi8(__m128i a, __m128i b)
+{
+    const __m128i lo = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(a, a), 8),
+                                       _mm_srai_epi16(_mm_unpacklo_epi8(b, b), 8));
+    const __m128i hi = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(a, a), 8),
+                                       _mm_srai_epi16(_mm_unpackhi_epi8(b, b), 8));
+    return _mm_packs_epi16(_mm_srai_epi16(lo, 8), _mm_srai_epi16(hi, 8));
+}
+Vc_INTRINSIC __m128i sse_mulhi_epu8(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo =
+        _mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    const __m128i hi =
+        _mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+Vc_INTRINSIC SSE::Vector<int> mulhi(const SSE::Vector<int> &a, const SSE::Vector<int> &b)
+{
+    return sse_mulhi_epi32(a.data(), b.data());
+}
+Vc_INTRINSIC SSE::Vector<uint> mulhi(const SSE::Vector<uint> &a,
+                                     const SSE::Vector<uint> &b)
+{
+    return sse_mulhi_epu32(a.data(), b.data());
+}
+Vc_INTRINSIC SSE::Vector<short> mulhi(const SSE::Vector<short> &a,
+                                      const SSE::Vector<short> &b)
+{
+    return _mm_mulhi_epi16(a.data(), b.data());
+}
+Vc_INTRINSIC SSE::Vector<ushort> mulhi(const SSE::Vector<ushort> &a,
+                                       const SSE::Vector<ushort> &b)
+{
+    return _mm_mulhi_epu16(a.data(), b.data());
+}
+Vc_INTRINSIC SSE::Vector<schar> mulhi(const SSE::Vector<schar> &a,
+                                      const SSE::Vector<schar> &b)
+{
+    return sse_mulhi_epi8(a.data(), b.data());
+}
+Vc_INTRINSIC SSE::Vector<uchar> mulhi(const SSE::Vector<uchar> &a,
+                                      const SSE::Vector<uchar> &b)
+{
+    return sse_mulhi_epu8(a.data(), b.data());
+}
+#endif  // Vc_IMPL_SSE2
+
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i avx2_mulhi_epu32(__m256i a, __m256i b)
+{
+    const __m256i hi02 = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    const __m256i hi13 =
+        _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(hi02, hi13, 0xaa);
+}
+Vc_INTRINSIC __m256i avx2_mulhi_epi32(__m256i a, __m256i b)
+{
+    const __m256i hi02 = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    const __m256i hi13 =
+        _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(hi02, hi13, 0xaa);
+}
+// unpack and pack work per 128-bit lane, thus the lane order is preserved
+Vc_INTRINSIC __m256i avx2_mulhi_epi8(__m256i a, __m256i b)
+{
+    const __m256i lo =
+        _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpacklo_epi8(a, a), 8),
+                           _mm256_srai_epi16(_mm256_unpacklo_epi8(b, b), 8));
+    const __m256i hi =
+        _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpackhi_epi8(a, a), 8),
+                           _mm256_srai_epi16(_mm256_unpackhi_epi8(b, b), 8));
+    return _mm256_packs_epi16(_mm256_srai_epi16(lo, 8), _mm256_srai_epi16(hi, 8));
+}
+Vc_INTRINSIC __m256i avx2_mulhi_epu8(__m256i a, __m256i b)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lo =
+        _mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+    const __m256i hi =
+        _mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+    return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+Vc_INTRINSIC AVX2::Vector<int> mulhi(const AVX2::Vector<int> &a,
+                                     const AVX2::Vector<int> &b)
+{
+    return avx2_mulhi_epi32(a.data(), b.data());
+}
+Vc_INTRINSIC AVX2::Vector<uint> mulhi(const AVX2::Vector<uint> &a,
+                                      const AVX2::Vector<uint> &b)
+{
+    return avx2_mulhi_epu32(a.data(), b.data());
+}
+Vc_INTRINSIC AVX2::Vector<short> mulhi(const AVX2::Vector<short> &a,
+                                       const AVX2::Vector<short> &b)
+{
+    return _mm256_mulhi_epi16(a.data(), b.data());
+}
+Vc_INTRINSIC AVX2::Vector<ushort> mulhi(const AVX2::Vector<ushort> &a,
+                                        const AVX2::Vector<ushort> &b)
+{
+    return _mm256_mulhi_epu16(a.data(), b.data());
+}
+Vc_INTRINSIC AVX2::Vector<schar> mulhi(const AVX2::Vector<schar> &a,
+                                       const AVX2::Vector<schar> &b)
+{
+    return avx2_mulhi_epi8(a.data(), b.data());
+}
+Vc_INTRINSIC AVX2::Vector<uchar> mulhi(const AVX2::Vector<uchar> &a,
+                                       const AVX2::Vector<uchar> &b)
+{
+    return avx2_mulhi_epu8(a.data(), b.data());
+}
+#endif  // Vc_IMPL_AVX2
+
+// DividerAlgorithm {{{1
+/**\internal
+ * The instruction sequence a divider evaluates. All three are branch-free per lane; the
+ * choice depends only on the divisor.
+ */
+enum class DividerAlgorithm : unsigned char {
+    Shift,       ///< the divisor is a power of two (or its negation)
+    Multiply,    ///< mulhi with a magic number that fits into T, then shift
+    MultiplyAdd  ///< the magic number needs one more bit: add the numerator back in
+};
+
+/**\internal
+ * The index of the most significant set bit of \p x (x > 0).
+ */
+template <class U> Vc_INTRINSIC int floor_log2(U x)
+{
+    int l = 0;
+    while (x >>= 1) {
+        ++l;
+    }
+    return l;
+}
+
+/**\internal
+ * Returns `2^p / d` and stores the remainder in \p rem. The quotient must fit into \p U.
+ */
+template <class U>
+Vc_INTRINSIC U divide_pow2(int p, U d, U &rem, std::false_type /*is 64-bit*/)
+{
+    const std::uint64_t num = std::uint64_t(1) << p;
+    const U q = U(num / d);
+    rem = U(num - std::uint64_t(q) * d);
+    return q;
+}
+template <class U> inline U divide_pow2(int p, U d, U &rem, std::true_type /*is 64-bit*/)
+{
+    // 2^p does not fit into 64 bits: long division one bit at a time (requires d > 1)
+    U q = 0;
+    U r = 1;
+    for (int i = 0; i < p; ++i) {
+        const bool carry = (r >> 63) != 0;
+        r <<= 1;
+        q <<= 1;
+        if (carry || r >= d) {
+            r -= d;
+            q |= 1;
+        }
+    }
+    rem = r;
+    return q;
+}
+
+// divide {{{1
+/**\internal
+ * The quotient \p n / \p d for unsigned entry types, following the round-up method of
+ * Granlund & Montgomery as implemented in libdivide. \p V is T or a vector of T.
+ */
+template <class V, class T>
+Vc_INTRINSIC V divide(const V &n, const divider<T> &d, std::false_type /*is_signed*/)
+{
+    switch (d.algorithm()) {
+    case DividerAlgorithm::Shift:
+        return n >> d.shift();
+    case DividerAlgorithm::Multiply:
+        return mulhi(n, V(d.magic())) >> d.shift();
+    default: {
+        const V q = mulhi(n, V(d.magic()));
+        return (((n - q) >> 1) + q) >> d.shift();
+    }
+    }
+}
+
+/**\internal
+ * The quotient \p n / \p d for signed entry types, rounding toward zero.
+ */
+template <class V, class T>
+Vc_INTRINSIC V divide(const V &n, const divider<T> &d, std::true_type /*is_signed*/)
+{
+    constexpr int Bits = 8 * sizeof(T);
+    const V sign = V(d.sign());  // 0 or -1
+    if (d.algorithm() == DividerAlgorithm::Shift) {
+        // bias negative numerators by 2^shift - 1 so that the shift rounds toward zero
+        const V bias = (n >> (Bits - 1)) & V(d.magic());
+        const V q = (n + bias) >> d.shift();
+        return (q ^ sign) - sign;
+    }
+    V q = mulhi(n, V(d.magic()));
+    if (d.algorithm() == DividerAlgorithm::MultiplyAdd) {
+        q += (n ^ sign) - sign;
+    }
+    q = q >> d.shift();
+    return q - (q >> (Bits - 1));  // +1 for negative quotients
+}
+//}}}1
+}  // namespace Common
+
+// divider {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile divider.h <Vc/Vc>
+ *
+ * Division by a runtime-invariant integer.
+ *
+ * Hardware division is not vectorized for integers, and `operator/` of the integer
+ * vector types therefore divides lane by lane or via floating-point conversions. A
+ * divider precomputes a magic multiplier and shift for the divisor (the method of
+ * Granlund & Montgomery, in the variant of libdivide), so that `v / d` and `v % d`
+ * compile to a mul-high, a shift, and a few additions for every integer vector type, for
+ * SimdArray, and for scalars. The quotient rounds toward zero, exactly like the built-in
+ * operator.
+ *
+ * Constructing a divider costs about as much as a few scalar divisions; it pays off as
+ * soon as it is reused:
+ * \code
+ * const Vc::divider<Vc::uint> buckets(bucketCount);
+ * for (std::size_t i = 0; i < n; i += Vc::uint_v::size()) {
+ *   const Vc::uint_v h(hashes + i, Vc::Aligned);
+ *   (h % buckets).store(bucketIndex + i, Vc::Aligned);
+ * }
+ * \endcode
+ *
+ * \tparam T An integer type of 8 to 64 bits.
+ */
+template <class T> class divider
+{
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                      sizeof(T) <= 8,
+                  "Vc::divider<T> requires an integer type of at most 64 bits");
+    using U = typename std::make_unsigned<T>::type;
+    static constexpr int Bits = 8 * sizeof(T);
+    using Is64 = std::integral_constant<bool, Bits == 64>;
+
+public:
+    /// Precomputes the division by \p d, which must not be zero.
+    explicit divider(T d) : divisor_(d)
+    {
+        Vc_ASSERT(d != 0);
+        init(std::is_signed<T>());
+    }
+
+    /// Returns the divisor.
+    Vc_INTRINSIC T divisor() const { return divisor_; }
+
+    ///\internal The magic multiplier, or for powers of two the rounding bias.
+    Vc_INTRINSIC T magic() const { return magic_; }
+    ///\internal The final right shift.
+    Vc_INTRINSIC int shift() const { return shift_; }
+    ///\internal -1 for negative divisors, 0 otherwise.
+    Vc_INTRINSIC T sign() const { return divisor_ < 0 ? T(-1) : T(0); }
+    ///\internal
+    Vc_INTRINSIC Common::DividerAlgorithm algorithm() const { return algorithm_; }
+
+private:
+    void init(std::false_type /*is_signed*/)
+    {
+        const int l = Common::floor_log2(U(divisor_));
+        shift_ = l;
+        if ((divisor_ & (divisor_ - 1)) == 0) {
+            magic_ = 0;
+            algorithm_ = Common::DividerAlgorithm::Shift;
+            return;
+        }
+        U rem;
+        U m = Common::divide_pow2(Bits + l, U(divisor_), rem, Is64());
+        if (U(divisor_ - rem) < (U(1) << l)) {
+            algorithm_ = Common::DividerAlgorithm::Multiply;
+        } else {
+            // 2^(Bits + l + 1) / d does not fit into Bits: keep the lower bits and
+            // add the numerator in divide()
+            m = U(m + m);
+            const U twiceRem = U(rem + rem);
+            if (twiceRem >= U(divisor_) || twiceRem < rem) {
+                ++m;
+            }
+            algorithm_ = Common::DividerAlgorithm::MultiplyAdd;
+        }
+        magic_ = T(m + 1);
+    }
+
+    void init(std::true_type /*is_signed*/)
+    {
+        const U absD = divisor_ < 0 ? U(U(0) - U(divisor_)) : U(divisor_);
+        const int l = Common::floor_log2(absD);
+        if ((absD & (absD - 1)) == 0) {
+            shift_ = l;
+            magic_ = T((U(1) << l) - 1);
+            algorithm_ = Common::DividerAlgorithm::Shift;
+            return;
+        }
+        U rem;
+        U m = Common::divide_pow2(Bits + l - 1, absD, rem, Is64());
+        if (U(absD - rem) < (U(1) << l)) {
+            shift_ = l - 1;
+            algorithm_ = Common::DividerAlgorithm::Multiply;
+        } else {
+            m = U(m + m);
+            const U twiceRem = U(rem + rem);
+            if (twiceRem >= absD || twiceRem < rem) {
+                ++m;
+            }
+            shift_ = l;
+            algorithm_ = Common::DividerAlgorithm::MultiplyAdd;
+        }
+        ++m;
+        magic_ = T(divisor_ < 0 ? U(U(0) - m) : m);
+    }
+
+    T divisor_;
+    T magic_;
+    int shift_;
+    Common::DividerAlgorithm algorithm_;
+};
+
+// operator/ and operator% {{{1
+/**
+ * \ingroup Utilities
+ * Returns \p n / \p d.divisor(), rounded toward zero.
+ */
+template <class T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, T> operator/(T n, const divider<T> &d)
+{
+    return Common::divide(n, d, std::is_signed<T>());
+}
+/**
+ * \ingroup Utilities
+ * Returns the remainder of \p n / \p d.divisor(), with the sign of \p n.
+ */
+template <class T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, T> operator%(T n, const divider<T> &d)
+{
+    return n - (n / d) * d.divisor();
+}
+
+/**
+ * \ingroup Utilities
+ * Divides every lane of \p n by \p d.divisor(), rounding toward zero.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> operator/(const Vector<T, Abi> &n, const divider<T> &d)
+{
+    return Common::divide(n, d, std::is_signed<T>());
+}
+/**
+ * \ingroup Utilities
+ * The remainder of every lane of \p n divided by \p d.divisor().
+ */
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> operator%(const Vector<T, Abi> &n, const divider<T> &d)
+{
+    return n - (n / d) * Vector<T, Abi>(d.divisor());
+}
+
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> &operator/=(Vector<T, Abi> &n, const divider<T> &d)
+{
+    return n = n / d;
+}
+template <class T, class Abi>
+Vc_INTRINSIC Vector<T, Abi> &operator%=(Vector<T, Abi> &n, const divider<T> &d)
+{
+    return n = n % d;
+}
+
+namespace Common
+{
+/**\internal
+ * Applies the division to the native chunks of a SimdArray.
+ */
+struct DivideByDivider {
+    template <class V, class D> Vc_INTRINSIC void operator()(V &r, const V &n, const D &d)
+    {
+        r = n / d;
+    }
+};
+struct ModuloByDivider {
+    template <class V, class D> Vc_INTRINSIC void operator()(V &r, const V &n, const D &d)
+    {
+        r = n % d;
+    }
+};
+}  // namespace Common
+
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC fixed_size_simd<T, N> operator/(const SimdArray<T, N, V, M> &n,
+                                             const divider<T> &d)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::DivideByDivider(), n, d);
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC fixed_size_simd<T, N> operator%(const SimdArray<T, N, V, M> &n,
+                                             const divider<T> &d)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::ModuloByDivider(), n, d);
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> &operator/=(SimdArray<T, N, V, M> &n,
+                                               const divider<T> &d)
+{
+    return n = n / d;
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> &operator%=(SimdArray<T, N, V, M> &n,
+                                               const divider<T> &d)
+{
+    return n = n % d;
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_DIVIDER_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,179 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Common
+{
+/**\internal
+ * Polynomial approximations of erf and erfc accurate enough for results of type \p T. They
+ * are evaluated in double precision:
+ * - erf(x) = x · P(x²) for |x| < ½,
+ * - erfc(x) = e^(-x²) / (1 + 2x) · G(t) for x ≥ ½, where G is a Chebyshev series in
+ *   t = (x - 3) / (x + 3) (cf. Shepherd and Laframboise, Math. Comp. 36 (1981)), which
+ *   covers the whole range up to the underflow of erfc.
+ */
+template <typename T> struct ErfKernel;
+template <> struct ErfKernel<float>
+{
+    template <typename V> static Vc_ALWAYS_INLINE V erf_small(const V &x)
+    {
+        const V x2 = x * x;
+        return x * (((( 4.71908256723097e-03   * x2
+                       - 2.6757732735022178e-02) * x2
+                       + 1.1282831428465978e-01) * x2
+                       - 3.7612609007469811e-01) * x2
+                       + 1.1283791656017914e+00);
+    }
+    static constexpr std::size_t tail_size = 10;
+    static const double *tail_coefficients()
+    {
+        static const double c[tail_size] = {
+             1.2235164400426055e+00, -5.9547297928120253e-02, -2.8450637719154879e-02,
+             1.6976347559935542e-02, -5.1132650547660386e-03,  1.0138966134669229e-03,
+            -1.2540368425366415e-04,  4.9768742496804442e-06,  1.2808132621263476e-06,
+            -2.1230594699142698e-07};
+        return c;
+    }
+};
+template <> struct ErfKernel<double>
+{
+    template <typename V> static Vc_ALWAYS_INLINE V erf_small(const V &x)
+    {
+        const V x2 = x * x;
+        return x * (((((((( 1.4726214835213291e-06   * x2
+                           - 1.4845870383497742e-05) * x2
+                           + 1.2053335123912095e-04) * x2
+                           - 8.5482977262548354e-04) * x2
+                           + 5.2239773722130662e-03) * x2
+                           - 2.6866170632788719e-02) * x2
+                           + 1.1283791670924810e-01) * x2
+                           - 3.7612638903183465e-01) * x2
+                           + 1.1283791670955126e+00);
+    }
+    static constexpr std::size_t tail_size = 22;
+    static const double *tail_coefficients()
+    {
+        static const double c[tail_size] = {
+             1.2235164400426057e+00, -5.9547297928118727e-02, -2.8450637719154716e-02,
+             1.6976347559878899e-02, -5.1132650548290914e-03,  1.0138966156301344e-03,
+            -1.2540368117207814e-04,  4.9767822322781922e-06,  1.2807484172276232e-06,
+            -2.0793441204127811e-07, -6.5113529019024223e-09,  4.3715349520393179e-09,
+            -6.4844894344219089e-11, -9.2017397292403318e-11,  3.0815915190109628e-12,
+             2.1632165016421576e-12, -6.3049697644000021e-14, -5.6641730151671399e-14,
+             1.6772114789181442e-16,  1.5690869531711808e-15,  6.7814381793121747e-17,
+            -4.3509156386635622e-17};
+        return c;
+    }
+};
+
+/**\internal
+ * Returns erfc(x) for x ∈ [½, 27.3]; erfc(27.3) underflows to zero.
+ */
+template <typename T, typename V> Vc_ALWAYS_INLINE V erfc_tail(const V &x)
+{
+    using K = ErfKernel<T>;
+    const double *c = K::tail_coefficients();
+    // t ∈ [t(½), t(27.3)] mapped to u ∈ [-1, 1], summed with Clenshaw's recurrence
+    const V u = (x - 3.) / (x + 3.) * 1.3190298507462686 - 5.7835820895522388e-02;
+    const V u2 = u + u;
+    V b1 = 0., b2 = 0.;
+    for (std::size_t k = K::tail_size - 1; k > 0; --k) {
+        const V b = u2 * b1 - b2 + c[k];
+        b2 = b1;
+        b1 = b;
+    }
+    const V g = u * b1 - b2 + c[0];
+    // e^(-x²) with x² = p + dp in extended precision
+    const V p = x * x;
+    const V dp = fma(x, x, -p);
+    return exp_kernel(-p, -dp) * g / (x * 2. + 1.);
+}
+
+template <typename T, typename V> Vc_ALWAYS_INLINE V erf_impl(const V &x)
+{
+    const V ax = abs(x);
+    V r = copysign(1. - erfc_tail<T>(min(max(ax, V(0.5)), V(27.3))), x);
+    r(ax < 0.5) = ErfKernel<T>::erf_small(x);
+    r(isnan(x)) = x;
+    return r;
+}
+
+template <typename T, typename V> Vc_ALWAYS_INLINE V erfc_impl(const V &x)
+{
+    const V ax = abs(x);
+    V r = erfc_tail<T>(min(max(ax, V(0.5)), V(27.3)));
+    r(x < 0.) = 2. - r;
+    r(ax < 0.5) = 1. - ErfKernel<T>::erf_small(x);
+    r(isnan(x)) = x;
+    return r;
+}
+}  // namespace Common
+
+/**
+ * \ingroup Math
+ * Returns the error function of all input values in \p x.
+ *
+ * The single-precision implementation evaluates in double precision.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp.
+ * \note The double-precision implementation has an error of max. 3 ulp.
+ */
+template <typename Abi, typename = Common::enable_if_vectorized_math<float, Abi>>
+inline Vector<float, detail::not_fixed_size_abi<Abi>> erf(const Vector<float, Abi> &x)
+{
+    using V = Vector<float, Abi>;
+    return simd_cast<V>(Common::erf_impl<float>(simd_cast<SimdArray<double, V::Size>>(x)));
+}
+template <typename Abi, typename = Common::enable_if_vectorized_math<double, Abi>>
+inline Vector<double, detail::not_fixed_size_abi<Abi>> erf(const Vector<double, Abi> &x)
+{
+    return Common::erf_impl<double>(x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the complementary error function \f$1 - \mathrm{erf}(x)\f$ of all input values
+ * in \p x. The result keeps its relative precision for large \p x, where it underflows
+ * only at \f$x \approx 10\f$ (`float`) and \f$x \approx 27\f$ (`double`).
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp.
+ * \note The double-precision implementation has an error of max. 4 ulp.
+ */
+template <typename Abi, typename = Common::enable_if_vectorized_math<float, Abi>>
+inline Vector<float, detail::not_fixed_size_abi<Abi>> erfc(const Vector<float, Abi> &x)
+{
+    using V = Vector<float, Abi>;
+    return simd_cast<V>(Common::erfc_impl<float>(simd_cast<SimdArray<double, V::Size>>(x)));
+}
+template <typename Abi, typename = Common::enable_if_vectorized_math<double, Abi>>
+inline Vector<double, detail::not_fixed_size_abi<Abi>> erfc(const Vector<double, Abi> &x)
+{
+    return Common::erfc_impl<double>(x);
+}
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
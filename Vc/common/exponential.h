@@ -81,4 +81,384 @@ inline Vector<float, detail::not_fixed_size_abi<Abi>> exp(Vector<float, Abi> x)
         return x;
     }
 
+namespace Common
+{
+/**\internal
+ * Polynomial approximations of \f$e^r - 1\f$ for \f$|r| \le \frac{\ln 2}{2}\f$ (Chebyshev
+ * fits of \f$(e^r - 1 - r - \frac{r^2}{2}) / r^3\f$) and the input ranges outside of which
+ * the exponential functions saturate.
+ */
+template <typename T> struct ExpKernel;
+template <> struct ExpKernel<float>
+{
+    static constexpr float exp2_min() { return -152.f; }  // 2ˣ rounds to 0
+    static constexpr float exp2_max() { return 129.f; }   // 2ˣ overflows
+    static constexpr float exp10_min() { return -46.f; }
+    static constexpr float exp10_max() { return 39.5f; }
+    static constexpr float expm1_min() { return -20.f; }  // eˣ - 1 rounds to -1
+    static constexpr float expm1_max() { return 89.f; }   // eˣ overflows
+    static constexpr float log_max() { return 88.f; }     // eˣ is finite
+    // log₁₀(2) split such that n * log10_2_large() is exact
+    static constexpr float log10_2_large() { return 3.01025391e-01f; }
+    static constexpr float log10_2_small() { return 4.60503907e-06f; }
+
+    // max. relative error: 1.2 ulp
+    template <typename V> static Vc_ALWAYS_INLINE V expm1(const V &r)
+    {
+        const V q = ((( 1.98826965e-4f  * r
+                      + 1.39261817e-3f) * r
+                      + 8.33332073e-3f) * r
+                      + 4.16665561e-2f) * r
+                      + 1.66666672e-1f;
+        const V r2 = r * r;
+        return r + (r2 * 0.5f + r2 * r * q);
+    }
+};
+template <> struct ExpKernel<double>
+{
+    static constexpr double exp2_min() { return -1080.; }
+    static constexpr double exp2_max() { return 1025.; }
+    static constexpr double exp10_min() { return -330.; }
+    static constexpr double exp10_max() { return 310.; }
+    static constexpr double expm1_min() { return -40.; }
+    static constexpr double expm1_max() { return 710.; }
+    static constexpr double log_max() { return 709.; }
+    static constexpr double log10_2_large() { return 3.0102999554947019e-01; }
+    static constexpr double log10_2_small() { return 1.1451100899212592e-10; }
+
+    // max. relative error: 1.3 ulp
+    template <typename V> static Vc_ALWAYS_INLINE V expm1(const V &r)
+    {
+        const V q = (((((((( 2.0906111573169974e-09  * r
+                           + 2.5101433758014278e-08) * r
+                           + 2.7557296586365981e-07) * r
+                           + 2.7557265526933688e-06) * r
+                           + 2.4801587307907905e-05) * r
+                           + 1.9841269865869494e-04) * r
+                           + 1.3888888888885689e-03) * r
+                           + 8.3333333333289773e-03) * r
+                           + 4.1666666666666685e-02) * r
+                           + 1.6666666666666669e-01;
+        const V r2 = r * r;
+        return r + (r2 * 0.5 + r2 * r * q);
+    }
+};
+
+/**\internal
+ * Returns \p x · 2ⁿ for \p n in twice the exponent range of `V::EntryType`. The scaling
+ * uses two normalized factors so that results in the subnormal range are rounded
+ * correctly (unlike `ldexp`).
+ */
+template <typename V>
+Vc_ALWAYS_INLINE V scale_by_pow2(const V &x, const SimdArray<int, V::Size> &n)
+{
+    const SimdArray<int, V::Size> n1 = n >> 1;
+    return x * ldexp(V(1), n1) * ldexp(V(1), n - n1);
+}
+
+/**\internal
+ * Splits \p x into n · ln(2) + r with |r| ≤ ln(2)/2, stores n in \p n, and returns r.
+ */
+template <typename V> Vc_ALWAYS_INLINE V exp_reduce(const V &x, V &n)
+{
+    using T = typename V::EntryType;
+    // ln(2) split such that n * ln2_large is exact
+    const T ln2_large = 6.93359375e-1;
+    const T ln2_small = -2.12194440054690582e-4;
+    n = round(x * T(1.44269504088896340736));
+    return x - n * ln2_large - n * ln2_small;
+}
+
+/**\internal
+ * Returns e^(x + dx) where \p dx is a small correction to \p x (e.g. the low part of an
+ * extended precision argument). \p x must be finite and within the range where the
+ * result neither overflows by more than a factor of two nor underflows below half the
+ * smallest subnormal.
+ */
+template <typename V> Vc_ALWAYS_INLINE V exp_kernel(const V &x, const V &dx)
+{
+    using T = typename V::EntryType;
+    V n;
+    const V r = exp_reduce(x, n) + dx;
+    return scale_by_pow2(ExpKernel<T>::expm1(r) + T(1),
+                         static_cast<SimdArray<int, V::Size>>(n));
+}
+}  // namespace Common
+
+/**
+ * \ingroup Math
+ * Returns 2 raised to the power of all input values in \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp.
+ * \note The double-precision implementation has an error of max. 1 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> exp2(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using K = Common::ExpKernel<T>;
+    // 2ˣ = 2ⁿ · e^((x - n) · ln(2)) with n = round(x)
+    const V xc = min(max(x, V(K::exp2_min())), V(K::exp2_max()));
+    const V n = round(xc);
+    V r = Common::scale_by_pow2(K::expm1((xc - n) * T(0.693147180559945309417)) + T(1),
+                                static_cast<SimdArray<int, V::Size>>(n));
+    r(isnan(x)) = x;
+    return r;
+}
+
+/**
+ * \ingroup Math
+ * Returns 10 raised to the power of all input values in \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp.
+ * \note The double-precision implementation has an error of max. 1 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> exp10(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using K = Common::ExpKernel<T>;
+    // 10ˣ = 2ⁿ · e^((x - n · log₁₀(2)) · ln(10)) with n = round(x · log₂(10))
+    const V xc = min(max(x, V(K::exp10_min())), V(K::exp10_max()));
+    const V n = round(xc * T(3.32192809488736234787));
+    const V y = (xc - n * K::log10_2_large()) - n * K::log10_2_small();
+    V r = Common::scale_by_pow2(K::expm1(y * T(2.30258509299404568402)) + T(1),
+                                static_cast<SimdArray<int, V::Size>>(n));
+    r(isnan(x)) = x;
+    return r;
+}
+
+/**
+ * \ingroup Math
+ * Returns \f$e^x - 1\f$ for all input values in \p x. The result is accurate also for
+ * values of \p x close to zero, where `exp(x) - 1` suffers from cancellation.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> expm1(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using K = Common::ExpKernel<T>;
+    const V xc = min(max(x, V(K::expm1_min())), V(K::expm1_max()));
+    V n;
+    const V em = K::expm1(Common::exp_reduce(xc, n));
+    // eˣ - 1 = 2ⁿ · (eʳ - 1) + 2ⁿ - 1 = 2 · (2ⁿ⁻¹ · (eʳ - 1) + (2ⁿ⁻¹ - ½))
+    // 2ⁿ⁻¹ does not overflow for x ≤ expm1_max
+    const V u = ldexp(V::One(), static_cast<SimdArray<int, V::Size>>(n - V::One()));
+    V r = (u * em + (u - T(0.5))) * T(2);
+    // for n = 0 the result is eʳ - 1, and u · em would lose subnormal results
+    r(n == V::Zero()) = em;
+    r(isnan(x) || x == V::Zero()) = x;
+    return r;
+}
+
+/**
+ * \ingroup Math
+ * Returns the hyperbolic sine of all input values in \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> sinh(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    const V ax = abs(x);
+    // beyond log_max eˣ overflows while sinh(x) does not yet: use (e^(x/2))² / 2
+    const M large = ax > Common::ExpKernel<T>::log_max();
+    V arg = ax;
+    arg(large) *= T(0.5);
+    const V t = expm1(arg);
+    // sinh(x) = ½ (t + t / (t + 1)) with t = eˣ - 1
+    V r = T(0.5) * (t + t / (t + T(1)));
+    r(ax < V::One()) = T(0.5) * (T(2) * t - t * t / (t + T(1)));
+    r(large) = (T(0.5) * (t + T(1))) * (t + T(1));
+    return copysign(r, x);
+}
+
+/**
+ * \ingroup Math
+ * Returns the hyperbolic cosine of all input values in \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> cosh(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    const V ax = abs(x);
+    const M large = ax > Common::ExpKernel<T>::log_max();
+    V arg = ax;
+    arg(large) *= T(0.5);
+    const V w = expm1(arg) + T(1);
+    // cosh(x) = ½ (w + 1 / w) with w = eˣ
+    V r = T(0.5) * w + T(0.5) / w;
+    // = 1 + t² / 2w with t = eˣ - 1, avoiding the loss of the small t² term
+    r(ax < T(0.346573590279972654709)) = T(1) + (w - T(1)) * (w - T(1)) / (w + w);
+    r(large) = (T(0.5) * w) * w;
+    return r;
+}
+
+/**
+ * \ingroup Math
+ * Returns the hyperbolic tangent of all input values in \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> tanh(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    const V ax = abs(x);
+    const M small = ax < V::One();
+    // tanh(x) = 1 - 2 / (e²ˣ + 1) saturates to 1 long before e²ˣ overflows
+    V arg = min(ax, V(40)) * T(2);
+    arg(small) = -arg;
+    const V t = expm1(arg);
+    V r = T(1) - T(2) / (t + T(2));
+    // = -t / (t + 2) with t = e⁻²ˣ - 1 for small x
+    r(small) = -t / (t + T(2));
+    r = copysign(r, x);
+    r(isnan(x)) = x;
+    return r;
+}
+
+namespace Common
+{
+/**\internal
+ * Stores ln(x) as the unevaluated sum \p hi + \p lo with a relative error of about
+ * 2⁻⁶⁸ for positive, finite \p x (including subnormals).
+ */
+template <typename Abi>
+Vc_ALWAYS_INLINE void log_extended(Vector<double, Abi> x, Vector<double, Abi> &hi,
+                                   Vector<double, Abi> &lo)
+{
+    using V = Vector<double, Abi>;
+    using M = typename V::Mask;
+    using C = Vc::Detail::Const<double, Abi>;
+
+    const M denormal = x < C::min();
+    x(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+    V e = Vc::Detail::exponent(x.data());
+    e(denormal) -= 54;
+    x.setZero(C::exponentMask());
+    x = Vc::Detail::operator|(x, C::_1_2());  // x ∈ [½, 1[
+    const M smallX = x < C::_1_sqrt2();
+    x(smallX) += x;  // x ∈ [√½, √2[
+    e(!smallX) += V::One();
+
+    // ln(1 + f) = 2 artanh(s) = 2s + ⅔s³ + ⅖s⁵ + … with s = f / (2 + f), |s| < 0.172
+    // f is exact and s + s_lo approximates f / (2 + f) to twice the working precision
+    const V f = x - V::One();
+    const V d = f + 2.;
+    const V s = f / d;
+    const V sf = s * f;
+    const V s_lo = (((f - s * 2.) - sf) - fma(s, f, -sf)) / d;
+    // the ⅔s³ term is evaluated in twice the working precision, otherwise its rounding
+    // error dominates for large |y| in pow(x, y)
+    const V s2 = s * s;
+    const V s3 = s2 * s;
+    const V s3_lo = fma(s2, s, -s3) + fma(s, s, -s2) * s;
+    const double c3 = 2. / 3.;
+    const double c3_lo = 3.7007434154171883e-17;  // ⅔ - c3
+    const V t = s3 * c3;
+    const V t_lo = fma(s3, V(c3), -t) + (s3_lo * c3 + s3 * c3_lo);
+    V tail = 2. / 23.;
+    Vc::Common::unrolled_loop<int, 1, 10>(
+        [&](int i) { tail = tail * s2 + 2. / (23 - 2 * i); });
+    tail *= s2 * s3;
+
+    // ln(2) split such that e * ln2_large is exact
+    const double ln2_large = 6.93147180369123816490e-01;
+    const double ln2_small = 1.90821492927058770002e-10;
+    const V a = e * ln2_large;
+    const V b = s * 2.;
+    // ln(x) = a + b + t + lo, where the rounding errors of both sums go into lo
+    const V ab = a + b;
+    const V ab_b = ab - a;
+    hi = ab + t;
+    const V abt_t = hi - ab;
+    lo = ((a - (ab - ab_b)) + (b - ab_b)) + ((ab - (hi - abt_t)) + (t - abt_t)) +
+         (e * ln2_small + ((s_lo * 2. + s2 * s_lo * 2.) + (t_lo + tail)));
+    const V h = hi + lo;
+    lo -= h - hi;
+    hi = h;
+}
+
+/**\internal
+ * Applies the special cases of `pow` (C99 Annex F) to \p r, the result of \f$|x|^y\f$ for
+ * finite, positive \p x.
+ */
+template <typename V> Vc_ALWAYS_INLINE V pow_special_cases(V r, const V &x, const V &y)
+{
+    using T = typename V::EntryType;
+    using M = typename V::Mask;
+    const T inf = std::numeric_limits<T>::infinity();
+    const M zero = x == V::Zero();
+    r(zero) = V::Zero();
+    r(zero && y < V::Zero()) = inf;
+    const M infinite = isinf(x);
+    r(infinite) = V::Zero();
+    r(infinite && y > V::Zero()) = inf;
+    r(isnan(x) || isnan(y)) = x + y;
+    // for negative x the parity of an integral y determines the sign, otherwise the
+    // result is NaN (±∞ count as even integers)
+    const M integral = trunc(y) == y;
+    const V half_y = y * T(0.5);
+    r(isnegative(x) && integral && trunc(half_y) != half_y) = -r;
+    r(x < V::Zero() && isfinite(x) && !integral) = std::numeric_limits<T>::quiet_NaN();
+    r(x == V::One() || y == V::Zero() || (x == T(-1) && isinf(y))) = V::One();
+    return r;
+}
+}  // namespace Common
+
+/**
+ * \ingroup Math
+ * Returns \p x raised to the power of \p y for all input values in \p x and \p y. The
+ * special cases (zero, infinite, and negative bases, infinite exponents) are handled
+ * as specified for `std::pow`.
+ *
+ * The single-precision implementation evaluates the logarithm and exponential in double
+ * precision, the double-precision implementation uses a logarithm in extended precision.
+ * Therefore large results (where \f$|y \log_2 x|\f$ is large) are as accurate as small
+ * ones.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename Abi, typename = Common::enable_if_vectorized_math<float, Abi>>
+inline Vector<float, detail::not_fixed_size_abi<Abi>> pow(const Vector<float, Abi> &x,
+                                                          const Vector<float, Abi> &y)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    const V r = simd_cast<V>(exp2(simd_cast<D>(y) * log2(simd_cast<D>(abs(x)))));
+    return Common::pow_special_cases(r, x, y);
+}
+
+template <typename Abi, typename = Common::enable_if_vectorized_math<double, Abi>>
+inline Vector<double, detail::not_fixed_size_abi<Abi>> pow(const Vector<double, Abi> &x,
+                                                           const Vector<double, Abi> &y)
+{
+    using V = Vector<double, Abi>;
+    V lhi, llo;
+    Common::log_extended(abs(x), lhi, llo);
+    // y · ln|x| = z + dz in extended precision
+    const V p = y * lhi;
+    V dp = fma(y, lhi, -p) + y * llo;
+    dp.setZero(!isfinite(p));
+    const V z = p + dp;
+    V dz = dp - (z - p);
+    const V zc = min(max(z, V(-746.)), V(710.));
+    dz.setZero(zc != z);
+    return Common::pow_special_cases(Common::exp_kernel(zc, dz), x, y);
+}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
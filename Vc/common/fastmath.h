@@ -0,0 +1,516 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FASTMATH_H_
+#define VC_COMMON_FASTMATH_H_
+
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * Inherits the first of \p Tiers (ordered from cheapest to most precise) whose `max_ulp`
+ * does not exceed \p Ulp.
+ */
+template <int Ulp, typename... Tiers> struct select_fast_tier;
+template <int Ulp, typename T0, typename... Tiers>
+struct select_fast_tier<Ulp, T0, Tiers...>
+    : public std::conditional<(T0::max_ulp <= Ulp), T0,
+                              select_fast_tier<Ulp, Tiers...>>::type {
+};
+template <int Ulp> struct select_fast_tier<Ulp> {
+    static_assert(Ulp < 0, "Vc::fast does not provide the requested precision. Use the "
+                           "full-precision function from namespace Vc instead.");
+};
+
+// polynomial kernels {{{1
+// The coefficients are near-minimax (Chebyshev) fits for the reduced argument ranges
+// below. max_ulp is the measured max. error of the complete function.
+
+/**\internal
+ * \f$e^r\f$ for \f$|r| \le \frac{\ln 2}{2}\f$, evaluated as \f$1 + r + r^2 P(r)\f$.
+ */
+template <typename T, int Degree> struct FastExpPoly;
+template <> struct FastExpPoly<float, 2> {
+    static constexpr int max_ulp = 192;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &r)
+    {
+        const V p = (4.179198667e-02f  * r
+                   + 1.674189866e-01f) * r
+                   + 5.000000000e-01f;
+        return (r * r) * p + r + 1.f;
+    }
+};
+template <> struct FastExpPoly<float, 3> {
+    static constexpr int max_ulp = 8;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &r)
+    {
+        const V p = ((8.357199840e-03f  * r
+                    + 4.183380306e-02f) * r
+                    + 1.666663140e-01f) * r
+                    + 4.999974966e-01f;
+        return (r * r) * p + r + 1.f;
+    }
+};
+template <> struct FastExpPoly<float, 4> {
+    static constexpr int max_ulp = 2;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &r)
+    {
+        const V p = (((1.392617589e-03f  * r
+                     + 8.363173343e-03f) * r
+                     + 4.166655615e-02f) * r
+                     + 1.666657776e-01f) * r
+                     + 5.000000000e-01f;
+        return (r * r) * p + r + 1.f;
+    }
+};
+template <> struct FastExpPoly<double, 5> {
+    static constexpr int max_ulp = 1 << 21;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &r)
+    {
+        const V p = ((((1.98909808697503266e-04  * r
+                      + 1.39336410319867011e-03) * r
+                      + 8.33331093444886900e-03) * r
+                      + 4.16664650060400502e-02) * r
+                      + 1.66666666816142561e-01) * r
+                      + 5.00000001345772715e-01;
+        return (r * r) * p + r + 1.;
+    }
+};
+template <> struct FastExpPoly<double, 7> {
+    static constexpr int max_ulp = 512;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &r)
+    {
+        const V p = ((((((2.76175647858760863e-06  * r
+                        + 2.48678701796877271e-05) * r
+                        + 1.98412245996560114e-04) * r
+                        + 1.38888391105720086e-03) * r
+                        + 8.33333334420298041e-03) * r
+                        + 4.16666667862657311e-02) * r
+                        + 1.66666666666625857e-01) * r
+                        + 4.99999999999551081e-01;
+        return (r * r) * p + r + 1.;
+    }
+};
+template <> struct FastExpPoly<double, 9> {
+    static constexpr int max_ulp = 2;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &r)
+    {
+        const V p = ((((((((2.51003758325612340e-08  * r
+                          + 2.76200758799833672e-07) * r
+                          + 2.75572684803100238e-06) * r
+                          + 2.48015213223686919e-05) * r
+                          + 1.98412698630405450e-04) * r
+                          + 1.38888889171967186e-03) * r
+                          + 8.33333333333006500e-03) * r
+                          + 4.16666666666241636e-02) * r
+                          + 1.66666666666666685e-01) * r
+                          + 5.00000000000000111e-01;
+        return (r * r) * p + r + 1.;
+    }
+};
+template <typename T, int Ulp> struct FastExp;
+template <int Ulp>
+struct FastExp<float, Ulp>
+    : public select_fast_tier<Ulp, FastExpPoly<float, 2>, FastExpPoly<float, 3>,
+                              FastExpPoly<float, 4>> {
+};
+template <int Ulp>
+struct FastExp<double, Ulp>
+    : public select_fast_tier<Ulp, FastExpPoly<double, 5>, FastExpPoly<double, 7>,
+                              FastExpPoly<double, 9>> {
+};
+
+/**\internal
+ * \f$\ln(1 + f)\f$ for \f$f \in [\sqrt{\frac12} - 1, \sqrt2 - 1[\f$. The float kernels
+ * evaluate \f$f + f^2 P(f)\f$, the double kernels \f$f - s (f - s^2 R(s^2))\f$ with
+ * \f$s = \frac{f}{2 + f}\f$, which needs far fewer terms for double precision.
+ */
+template <typename T, int Degree> struct FastLogPoly;
+template <> struct FastLogPoly<float, 3> {
+    static constexpr int max_ulp = 2048;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &f)
+    {
+        const V p = ((1.784898788e-01f  * f
+                    - 2.669345438e-01f) * f
+                    + 3.352615237e-01f) * f
+                    - 4.997762144e-01f;
+        return (f * f) * p + f;
+    }
+};
+template <> struct FastLogPoly<float, 5> {
+    static constexpr int max_ulp = 32;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &f)
+    {
+        const V p = ((((1.200124547e-01f  * f
+                      - 1.838960946e-01f) * f
+                      + 2.037788182e-01f) * f
+                      - 2.494093329e-01f) * f
+                      + 3.332414329e-01f) * f
+                      - 5.000032783e-01f;
+        return (f * f) * p + f;
+    }
+};
+template <> struct FastLogPoly<float, 7> {
+    static constexpr int max_ulp = 2;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &f)
+    {
+        const V p = ((((((8.787265420e-02f  * f
+                        - 1.415964663e-01f) * f
+                        + 1.483478695e-01f) * f
+                        - 1.658848822e-01f) * f
+                        + 1.997205019e-01f) * f
+                        - 2.500114739e-01f) * f
+                        + 3.333367109e-01f) * f
+                        - 4.999999702e-01f;
+        return (f * f) * p + f;
+    }
+};
+template <> struct FastLogPoly<double, 2> {
+    static constexpr int max_ulp = 1 << 25;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &f)
+    {
+        const V s = f / (f + 2.);
+        const V u = s * s;
+        const V r = (2.95799493919727874e-01  * u
+                   + 3.99887805660219808e-01) * u
+                   + 6.66666850395758570e-01;
+        return f - s * (f - u * r);
+    }
+};
+template <> struct FastLogPoly<double, 4> {
+    static constexpr int max_ulp = 1024;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &f)
+    {
+        const V s = f / (f + 2.);
+        const V u = s * s;
+        const V r = (((1.93626537142020078e-01  * u
+                     + 2.21914008303085025e-01) * u
+                     + 2.85717545359144898e-01) * u
+                     + 3.99999987973375881e-01) * u
+                     + 6.66666666673750852e-01;
+        return f - s * (f - u * r);
+    }
+};
+template <> struct FastLogPoly<double, 6> {
+    static constexpr int max_ulp = 2;
+    template <typename V> static Vc_ALWAYS_INLINE V eval(const V &f)
+    {
+        const V s = f / (f + 2.);
+        const V u = s * s;
+        const V r = (((((1.46164496850434061e-01  * u
+                       + 1.53317216005560419e-01) * u
+                       + 1.81828891252617225e-01) * u
+                       + 2.22222111347950807e-01) * u
+                       + 2.85714286259754868e-01) * u
+                       + 3.99999999998995048e-01) * u
+                       + 6.66666666666666963e-01;
+        return f - s * (f - u * r);
+    }
+};
+template <typename T, int Ulp> struct FastLog;
+template <int Ulp>
+struct FastLog<float, Ulp>
+    : public select_fast_tier<Ulp, FastLogPoly<float, 3>, FastLogPoly<float, 5>,
+                              FastLogPoly<float, 7>> {
+};
+template <int Ulp>
+struct FastLog<double, Ulp>
+    : public select_fast_tier<Ulp, FastLogPoly<double, 2>, FastLogPoly<double, 4>,
+                              FastLogPoly<double, 6>> {
+};
+
+/**\internal
+ * \f$\sin(r)\f$ and \f$\cos(r)\f$ for \f$|r| \le \frac\pi4\f$, evaluated as
+ * \f$r + r^3 P(r^2)\f$ and \f$1 + r^2 Q(r^2)\f$. The tiers pair a sine and a cosine kernel
+ * of similar precision.
+ */
+template <typename T, int Degree> struct FastSinCosPoly;
+template <> struct FastSinCosPoly<float, 1> {
+    static constexpr int max_ulp = 1024;
+    template <typename V> static Vc_ALWAYS_INLINE V sin(const V &r, const V &r2)
+    {
+        return (r2 * r) * (8.211855777e-03f * r2 - 1.666573137e-01f) + r;
+    }
+    template <typename V> static Vc_ALWAYS_INLINE V cos(const V &, const V &r2)
+    {
+        return r2 * (4.081813991e-02f * r2 - 4.999346733e-01f) + 1.f;
+    }
+};
+template <> struct FastSinCosPoly<float, 2> {
+    static constexpr int max_ulp = 4;
+    template <typename V> static Vc_ALWAYS_INLINE V sin(const V &r, const V &r2)
+    {
+        const V p = (-1.958789071e-04f  * r2
+                    + 8.332747966e-03f) * r2
+                    - 1.666666418e-01f;
+        return (r2 * r) * p + r;
+    }
+    template <typename V> static Vc_ALWAYS_INLINE V cos(const V &, const V &r2)
+    {
+        const V q = ((2.446378858e-05f  * r2
+                    - 1.388758887e-03f) * r2
+                    + 4.166664928e-02f) * r2
+                    - 5.000000000e-01f;
+        return r2 * q + 1.f;
+    }
+};
+template <> struct FastSinCosPoly<double, 3> {
+    static constexpr int max_ulp = 1 << 21;
+    template <typename V> static Vc_ALWAYS_INLINE V sin(const V &r, const V &r2)
+    {
+        const V p = ((2.72499258030597915e-06  * r2
+                    - 1.98400867353848464e-04) * r2
+                    + 8.33333187471020816e-03) * r2
+                    - 1.66666666638552896e-01;
+        return (r2 * r) * p + r;
+    }
+    template <typename V> static Vc_ALWAYS_INLINE V cos(const V &, const V &r2)
+    {
+        const V q = ((2.44637882932657457e-05  * r2
+                    - 1.38875891556005759e-03) * r2
+                    + 4.16666506445170295e-02) * r2
+                    - 4.99999999691193131e-01;
+        return r2 * q + 1.;
+    }
+};
+template <> struct FastSinCosPoly<double, 5> {
+    static constexpr int max_ulp = 2;
+    template <typename V> static Vc_ALWAYS_INLINE V sin(const V &r, const V &r2)
+    {
+        const V p = ((((1.59181292948666079e-10  * r2
+                      - 2.50511318450036243e-08) * r2
+                      + 2.75573161025524389e-06) * r2
+                      - 1.98412698367585736e-04) * r2
+                      + 8.33333333333094797e-03) * r2
+                      - 1.66666666666666657e-01;
+        return (r2 * r) * p + r;
+    }
+    template <typename V> static Vc_ALWAYS_INLINE V cos(const V &, const V &r2)
+    {
+        const V q = (((((-1.13679986540224937e-11  * r2
+                        + 2.08758867380470521e-09) * r2
+                        - 2.75573155663418950e-07) * r2
+                        + 2.48015872936934593e-05) * r2
+                        - 1.38888888888807752e-03) * r2
+                        + 4.16666666666666366e-02) * r2
+                        - 5.00000000000000000e-01;
+        return r2 * q + 1.;
+    }
+};
+template <typename T, int Ulp> struct FastSinCos;
+template <int Ulp>
+struct FastSinCos<float, Ulp>
+    : public select_fast_tier<Ulp, FastSinCosPoly<float, 1>, FastSinCosPoly<float, 2>> {
+};
+template <int Ulp>
+struct FastSinCos<double, Ulp>
+    : public select_fast_tier<Ulp, FastSinCosPoly<double, 3>, FastSinCosPoly<double, 5>> {
+};
+
+// argument reduction constants {{{1
+template <typename T> struct FastConst;
+template <> struct FastConst<float> {
+    static constexpr float exp_min() { return -87.f; }  // eˣ stays a normal number
+    static constexpr float exp_max() { return 88.f; }   // eˣ stays finite
+    // ln(2) split such that n * ln2_hi() is exact
+    static constexpr float ln2_hi() { return 6.93359375e-1f; }
+    static constexpr float ln2_lo() { return -2.12194440e-4f; }
+    // π/2 split in three parts such that n * pio2_1() and n * pio2_2() are exact
+    static constexpr float pio2_1() { return 1.5703125f; }
+    static constexpr float pio2_2() { return 4.837512969970703125e-4f; }
+    static constexpr float pio2_3() { return 7.54978995489e-8f; }
+};
+template <> struct FastConst<double> {
+    static constexpr double exp_min() { return -708.; }
+    static constexpr double exp_max() { return 709.; }
+    static constexpr double ln2_hi() { return 6.93147180369123816490e-01; }
+    static constexpr double ln2_lo() { return 1.90821492927058770002e-10; }
+    static constexpr double pio2_1() { return 1.57079632673412561417e+00; }
+    static constexpr double pio2_2() { return 6.07710050630396597660e-11; }
+    static constexpr double pio2_3() { return 2.02226624879595063154e-21; }
+};
+
+/**\internal
+ * Returns sin(r + q · π/2) for the reduced argument \p r and the integral \p q.
+ */
+template <int Ulp, typename V> Vc_ALWAYS_INLINE V fast_sin_quadrant(const V &r, const V &q)
+{
+    using T = typename V::EntryType;
+    using K = FastSinCos<T, Ulp>;
+    const V quadrant = q - floor(q * T(0.25)) * T(4);  // q mod 4
+    const V r2 = r * r;
+    V y = K::sin(r, r2);
+    y(quadrant == T(1) || quadrant == T(3)) = K::cos(r, r2);
+    y(quadrant >= T(2)) = -y;
+    return y;
+}
+//}}}1
+}  // namespace Common
+
+/**
+ * \ingroup Math
+ * Reduced-precision variants of the math functions, trading accuracy for speed.
+ *
+ * Each function takes the admissible error in ulp as template argument and uses the
+ * cheapest implementation that stays within this bound; e.g. `Vc::fast::exp<256>(x)`.
+ * The default of 4 ulp selects the most precise variant of every function. Smaller budgets fail to
+ * compile; use the full-precision functions in namespace Vc for those.
+ *
+ * The functions skip the special case handling of their full-precision counterparts:
+ * The result for NaN, infinite, zero, negative (log) and subnormal inputs is
+ * unspecified unless stated otherwise. All ABIs, including Scalar, use the same
+ * polynomials, so results are reproducible across targets.
+ */
+namespace fast
+{
+/**
+ * Returns \f$e^x\f$.
+ *
+ * Inputs are clamped to [-87, 88] (`float`) or [-708, 709] (`double`), i.e. the results
+ * saturate at a small normal and a large finite value instead of reaching 0 and ∞.
+ *
+ * | `MaxUlp`    | `float` error | `double` error |
+ * |------------:|--------------:|---------------:|
+ * | 2 … 7       | 2 ulp         | 2 ulp          |
+ * | 8 … 191     | 8 ulp         | 2 ulp          |
+ * | 192 … 511   | 192 ulp       | 2 ulp          |
+ * | 512 … 2²¹-1 | 192 ulp       | 512 ulp        |
+ * | ≥ 2²¹       | 192 ulp       | 2²¹ ulp        |
+ */
+template <int MaxUlp = 4, typename T, typename Abi>
+inline enable_if<std::is_floating_point<T>::value,
+                 Vector<T, detail::not_fixed_size_abi<Abi>>>
+exp(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using C = Common::FastConst<T>;
+    const V xc = min(max(x, V(C::exp_min())), V(C::exp_max()));
+    // eˣ = 2ⁿ · eʳ with n = round(x · log₂(e)) and r = x - n · ln(2)
+    const V n = round(xc * T(1.44269504088896340736));
+    const V r = (xc - n * C::ln2_hi()) - n * C::ln2_lo();
+    return ldexp(Common::FastExp<T, MaxUlp>::eval(r),
+                 static_cast<SimdArray<int, V::Size>>(n));
+}
+
+/**
+ * Returns \f$\ln(x)\f$ for positive, normal \p x.
+ *
+ * | `MaxUlp`     | `float` error | `double` error |
+ * |-------------:|--------------:|---------------:|
+ * | 2 … 31       | 2 ulp         | 2 ulp          |
+ * | 32 … 1023    | 32 ulp        | 2 ulp          |
+ * | 1024 … 2047  | 32 ulp        | 1024 ulp       |
+ * | 2048 … 2²⁵-1 | 2048 ulp      | 1024 ulp       |
+ * | ≥ 2²⁵        | 2048 ulp      | 2²⁵ ulp        |
+ */
+template <int MaxUlp = 4, typename T, typename Abi>
+inline enable_if<std::is_floating_point<T>::value,
+                 Vector<T, detail::not_fixed_size_abi<Abi>>>
+log(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using C = Common::FastConst<T>;
+    typename V::IndexType e;
+    V m = frexp(x, &e);  // x = m · 2ᵉ with m ∈ [½, 1[
+    V n = simd_cast<V>(e);
+    const auto small = m < T(0.70710678118654752440);
+    m(small) += m;  // m ∈ [√½, √2[
+    n(small) -= V(1);
+    const V f = m - V(1);
+    return (Common::FastLog<T, MaxUlp>::eval(f) + n * C::ln2_lo()) + n * C::ln2_hi();
+}
+
+/**
+ * Returns \f$\sin(x)\f$.
+ *
+ * The documented errors hold for \f$|x| \le 128\f$ (`float`) and \f$|x| \le 10^6\f$
+ * (`double`). Beyond that the three-part reduction by π/2 loses precision near the zeros
+ * of the function.
+ *
+ * | `MaxUlp`     | `float` error | `double` error |
+ * |-------------:|--------------:|---------------:|
+ * | 4 … 1023     | 4 ulp         | 2 ulp          |
+ * | 1024 … 2²¹-1 | 1024 ulp      | 2 ulp          |
+ * | ≥ 2²¹        | 1024 ulp      | 2²¹ ulp        |
+ */
+template <int MaxUlp = 4, typename T, typename Abi>
+inline enable_if<std::is_floating_point<T>::value,
+                 Vector<T, detail::not_fixed_size_abi<Abi>>>
+sin(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using C = Common::FastConst<T>;
+    const V n = round(x * T(0.636619772367581343076));  // 2/π
+    const V r = ((x - n * C::pio2_1()) - n * C::pio2_2()) - n * C::pio2_3();
+    return Common::fast_sin_quadrant<MaxUlp>(r, n);
+}
+
+/**
+ * Returns \f$\cos(x)\f$. The range and precision are the same as for fast::sin.
+ */
+template <int MaxUlp = 4, typename T, typename Abi>
+inline enable_if<std::is_floating_point<T>::value,
+                 Vector<T, detail::not_fixed_size_abi<Abi>>>
+cos(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using C = Common::FastConst<T>;
+    const V n = round(x * T(0.636619772367581343076));
+    const V r = ((x - n * C::pio2_1()) - n * C::pio2_2()) - n * C::pio2_3();
+    // cos(x) = sin(x + π/2)
+    return Common::fast_sin_quadrant<MaxUlp>(r, n + V(1));
+}
+
+// SimdArray overloads {{{1
+#define Vc_FAST_SIMDARRAY_OVERLOAD_(name_)                                               \
+    template <int MaxUlp> struct Forward_##name_ {                                       \
+        template <typename V> Vc_INTRINSIC void operator()(V &r, const V &x)            \
+        {                                                                                \
+            r = name_<MaxUlp>(x);                                                        \
+        }                                                                                \
+    };                                                                                   \
+    template <int MaxUlp = 4, typename T, std::size_t N, typename V, std::size_t M>      \
+    inline fixed_size_simd<T, N> name_(const SimdArray<T, N, V, M> &x)                   \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(Forward_##name_<MaxUlp>(), x);       \
+    }
+Vc_FAST_SIMDARRAY_OVERLOAD_(exp);
+Vc_FAST_SIMDARRAY_OVERLOAD_(log);
+Vc_FAST_SIMDARRAY_OVERLOAD_(sin);
+Vc_FAST_SIMDARRAY_OVERLOAD_(cos);
+#undef Vc_FAST_SIMDARRAY_OVERLOAD_
+//}}}1
+}  // namespace fast
+}  // namespace Vc
+
+#endif  // VC_COMMON_FASTMATH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,167 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FLOAT16_H_
+#define VC_COMMON_FLOAT16_H_
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "../global.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// scalar conversions {{{1
+/**\internal
+ * Converts the IEEE 754 binary16 value \p h to float. The conversion is exact; NaNs are
+ * quieted like the F16C instruction `vcvtph2ps` does.
+ */
+Vc_INTRINSIC float float16_to_float(std::uint16_t h)
+{
+    const std::uint32_t em = h & 0x7fffu;
+    std::uint32_t bits = em << 13;
+    if (em >= 0x7c00u) {  // inf or NaN
+        bits += (255u - 31u) << 23;
+        if (em > 0x7c00u) {
+            bits |= 0x00400000u;
+        }
+    } else {
+        bits += (127u - 15u) << 23;
+        if (em < 0x0400u) {  // zero or subnormal: renormalize via a float subtraction
+            bits += 1u << 23;
+            float f;
+            std::memcpy(&f, &bits, 4);
+            f -= 6.103515625e-05f;  // 2⁻¹⁴
+            std::memcpy(&bits, &f, 4);
+        }
+    }
+    bits |= std::uint32_t(h & 0x8000u) << 16;
+    float r;
+    std::memcpy(&r, &bits, 4);
+    return r;
+}
+
+/**\internal
+ * Converts \p x to IEEE 754 binary16, rounding to nearest even. The result is bit-exact
+ * with the F16C instruction `vcvtps2ph` (rounding mode 0), including NaN payloads.
+ */
+Vc_INTRINSIC std::uint16_t float_to_float16(float x)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, 4);
+    const std::uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+    std::uint32_t h;
+    if (bits >= 0x47800000u) {  // |x| >= 2¹⁶: overflow, inf, or NaN
+        h = bits > 0x7f800000u ? 0x7e00u | ((bits >> 13) & 0x3ffu) : 0x7c00u;
+    } else if (bits < 0x38800000u) {  // |x| < 2⁻¹⁴: subnormal or zero result
+        // adding 0.5 aligns the subnormal binary16 mantissa to the lowest bits; the
+        // float addition rounds to nearest even
+        float f;
+        std::memcpy(&f, &bits, 4);
+        f += 0.5f;
+        std::memcpy(&h, &f, 4);
+        h -= 0x3f000000u;
+    } else {
+        const std::uint32_t mantissa_odd = (bits >> 13) & 1u;
+        bits += ((15u - 127u) << 23) + 0xfffu + mantissa_odd;
+        h = bits >> 13;
+    }
+    return static_cast<std::uint16_t>(h | (sign >> 16));
+}
+//}}}1
+}  // namespace Common
+
+// float16 {{{1
+/**
+ * \ingroup Utilities
+ *
+ * An IEEE 754 binary16 (half-precision) storage type.
+ *
+ * float16 is not an arithmetic type. It converts to and from `float` and can be used as
+ * memory type for the load, store, gather, and scatter functions of `float_v` and
+ * `SimdArray<float, N>`. These conversions use the F16C instructions `vcvtph2ps` and
+ * `vcvtps2ph` if available (Vc_IMPL_F16C) and a bit-exact integer implementation
+ * otherwise.
+ *
+ * \code
+ * void scale(Vc::float16 *data, std::size_t n, float factor) {
+ *   for (std::size_t i = 0; i < n; i += Vc::float_v::size()) {
+ *     Vc::float_v x(data + i, Vc::Aligned);
+ *     x *= factor;
+ *     x.store(data + i, Vc::Aligned);
+ *   }
+ * }
+ * \endcode
+ */
+class float16
+{
+public:
+    float16() = default;
+    /// Rounds \p x to the nearest representable value (ties to even).
+    Vc_INTRINSIC float16(float x) : bits_(Common::float_to_float16(x)) {}
+    /// Returns the exact float representation.
+    Vc_INTRINSIC operator float() const { return Common::float16_to_float(bits_); }
+
+    /// Returns the binary16 representation.
+    Vc_INTRINSIC std::uint16_t bits() const { return bits_; }
+    /// Returns the float16 object with the binary16 representation \p b.
+    static Vc_INTRINSIC float16 from_bits(std::uint16_t b)
+    {
+        float16 r;
+        r.bits_ = b;
+        return r;
+    }
+
+private:
+    std::uint16_t bits_;
+};
+static_assert(sizeof(float16) == 2 && alignof(float16) == 2,
+              "float16 must have the size and alignment of binary16");
+
+namespace Traits
+{
+/**\internal
+ * Whether objects of type \p U can be used as memory type for loads into and stores from
+ * vectors with entry type \p T.
+ */
+template <class U, class T>
+struct is_load_store_type
+    : public std::integral_constant<
+          bool, std::is_arithmetic<U>::value || (std::is_same<U, float16>::value &&
+                                                 std::is_same<T, float>::value)> {
+};
+}  // namespace Traits
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_FLOAT16_H_
+
+// vim: foldmethod=marker
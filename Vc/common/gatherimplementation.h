@@ -39,7 +39,9 @@ enum class GatherScatterImplementation : int {
     SimpleLoop,
     SetIndexZero,
     BitScanLoop,
-    PopcntSwitch
+    PopcntSwitch,
+    // the AVX2 gather instructions; only chosen by the tuned dispatch of unmasked gathers
+    HardwareGather
 };
 
 using SimpleLoopT   = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SimpleLoop>;
@@ -94,7 +96,7 @@ Vc_ALWAYS_INLINE void executeGather(BitScanLoopT,
                                     typename V::MaskArgument mask)
 {
 #ifdef Vc_GNU_ASM
-    size_t bits = mask.toInt();
+    size_t bits = static_cast<unsigned int>(mask.toInt());
     while (Vc_IS_LIKELY(bits > 0)) {
         size_t i, j;
         asm("bsf %[bits],%[i]\n\t"
@@ -107,7 +109,7 @@ Vc_ALWAYS_INLINE void executeGather(BitScanLoopT,
     }
 #else
     // Alternative from Vc::SSE (0.7)
-    int bits = mask.toInt();
+    unsigned int bits = mask.toInt();
     while (bits) {
         const int i = _bit_scan_forward(bits);
 	bits &= bits - 1;
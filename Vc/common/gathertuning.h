@@ -0,0 +1,114 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_GATHERTUNING_H_
+#define VC_COMMON_GATHERTUNING_H_
+
+#include <type_traits>
+#include "../global.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// calibration files {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile gathertuning.h <Vc/Vc>
+ *
+ * Writes the gather/scatter strategies calibrated (or loaded) so far in this process to
+ * \p filename. Returns \c false if the file cannot be written.
+ *
+ * Translation units compiled with \c Vc_USE_TUNED_GATHERS defined choose the strategy
+ * of masked gathers and scatters (and whether unmasked AVX2 gathers use the \c vgather
+ * instructions) at runtime: on first use of every vector type and operation a short
+ * micro-benchmark (well below a millisecond) times the available strategies and the
+ * fastest one is used for the rest of the process. If the \c VC_GATHER_CALIBRATION
+ * environment variable names a file, it is read on first use, and new calibration
+ * results are written back to it, so that subsequent runs skip the micro-benchmarks.
+ */
+bool save_gather_calibration(const char *filename);
+
+/**
+ * \ingroup Utilities
+ * \headerfile gathertuning.h <Vc/Vc>
+ *
+ * Reads gather/scatter strategies from \p filename, as written by
+ * save_gather_calibration. Returns \c false if the file cannot be read.
+ *
+ * The strategy of every vector type and operation is fixed on its first use. Therefore,
+ * load the file before the first gather or scatter.
+ */
+bool load_gather_calibration(const char *filename);
+
+namespace Detail
+{
+// tuned_gather_implementation {{{1
+/**\internal
+ * The operations whose implementation is chosen by calibration.
+ */
+enum class GatherTuningOperation : int { MaskedGather, MaskedScatter, Gather };
+
+/**\internal
+ * Identifies one calibrated operation: the implementation the translation unit was
+ * compiled for (including extra instructions), the entry type, and the vector width.
+ */
+struct GatherTuningKey {
+    unsigned int implementation;
+    char kind;  // 'f', 'i', or 'u'
+    unsigned int entryBits;
+    unsigned int size;
+    GatherTuningOperation operation;
+};
+
+/**\internal
+ * Returns the GatherScatterImplementation for \p key: from a calibration file, from an
+ * earlier call, or by calling \p calibrate. \p calibrate runs without a lock held, since
+ * it may use other tuned operations. Defined in libVc.
+ */
+int tuned_gather_implementation(const GatherTuningKey &key, int (*calibrate)());
+
+template <unsigned int Features>
+constexpr unsigned int implementationFeatures(ImplementationT<Features>)
+{
+    return Features;
+}
+
+template <class V> GatherTuningKey gatherTuningKey(GatherTuningOperation op)
+{
+    using T = typename V::EntryType;
+    return {implementationFeatures(CurrentImplementation()),
+            std::is_floating_point<T>::value ? 'f' : std::is_signed<T>::value ? 'i' : 'u',
+            unsigned(sizeof(T) * 8), unsigned(V::Size), op};
+}
+}  // namespace Detail
+
+}  // namespace Vc
+
+#endif  // VC_COMMON_GATHERTUNING_H_
+
+// vim: foldmethod=marker
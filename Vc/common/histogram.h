@@ -0,0 +1,348 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HISTOGRAM_H_
+#define VC_COMMON_HISTOGRAM_H_
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "indexsequence.h"
+#include "parallel.h"
+#include "streaming.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// conflict_sum {{{1
+/**\internal
+ * Adds the entries of \p values rotated by \p R to the lanes of \p sum whose index equals
+ * the index rotated by \p R.
+ */
+template <std::size_t R, class V, class IT>
+Vc_INTRINSIC int add_conflicting(V &sum, const V &values, const IT &indexes)
+{
+    const auto equal = indexes == indexes.rotated(R);
+    sum(simd_cast<typename V::mask_type>(equal)) += values.rotated(R);
+    return 0;
+}
+
+/**\internal
+ * Returns, for every lane, the sum of \p values over all lanes with the same index. All
+ * lanes of a group of equal indexes thus hold the same sum, and a scatter of
+ * `gather + sum` is correct regardless of which of the conflicting lanes is stored last.
+ *
+ * Every rotation of the index vector is compared once, i.e. `Size - 1` rotations, compares,
+ * and masked additions, all in registers.
+ */
+template <class V, class IT, std::size_t... R>
+Vc_INTRINSIC V conflict_sum(const V &values, const IT &indexes, index_sequence<R...>)
+{
+    V sum = values;
+    const int unused[] = {0, add_conflicting<R + 1>(sum, values, indexes)...};
+    (void)unused;
+    return sum;
+}
+//}}}1
+}  // namespace Common
+
+// scatter_add {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Adds `values[i]` to `mem[indexes[i]]` for all lanes \p i.
+ *
+ * Unlike `(V(mem, indexes) + values).scatter(mem, indexes)`, this is correct if
+ * \p indexes contains duplicates: lanes with equal indexes are combined with a
+ * rotate-and-compare reduction before the scatter, so that no update is lost.
+ *
+ * \param mem The base address of the array that is updated.
+ * \param indexes A vector of indexes into \p mem, with the same number of entries as
+ *                \p values.
+ * \param values The values to add.
+ */
+template <class T, class IT, class V>
+inline enable_if<Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value, void>
+scatter_add(T *mem, const IT &indexes, const V &values)
+{
+    static_assert(IT::Size == V::Size, "scatter_add requires as many indexes as values");
+    V sum = Common::conflict_sum(values, indexes, make_index_sequence<V::Size - 1>());
+    sum += V(mem, indexes);
+    sum.scatter(mem, indexes);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Masked overload of scatter_add: only the lanes selected by \p mask are added. The
+ * indexes of the other lanes are not accessed.
+ */
+template <class T, class IT, class V, class M>
+inline enable_if<Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value &&
+                     Traits::is_simd_mask<M>::value,
+                 void>
+scatter_add(T *mem, const IT &indexes, const V &values, const M &mask)
+{
+    static_assert(IT::Size == V::Size && M::Size == V::Size,
+                  "scatter_add requires as many indexes and mask entries as values");
+    const typename V::mask_type k = simd_cast<typename V::mask_type>(mask);
+    V active = V::Zero();
+    active(k) = values;
+    V sum = Common::conflict_sum(active, indexes, make_index_sequence<V::Size - 1>());
+    V old = V::Zero();
+    old.gather(mem, indexes, k);
+    sum += old;
+    sum.scatter(mem, indexes, k);
+}
+
+namespace Common
+{
+// histogram kernels {{{1
+/**\internal
+ * Counts the \p count values at \p in into \p counts. \p bin_of maps a vector of values to
+ * the vector of bin indexes and sets the mask of the values that fall into a bin.
+ */
+template <class V, class C, class BinOf>
+inline void count_bins(const typename V::EntryType *in, std::size_t count, C *counts,
+                       const BinOf &bin_of)
+{
+    using IT = typename V::IndexType;
+    using W = rebind_vector_type<V, C>;
+    const W one = C(1);
+    typename IT::mask_type valid;
+    std::size_t i = 0;
+    for (; i + V::Size <= count; i += V::Size) {
+        const IT bin = bin_of(V(in + i, Vc::Unaligned), valid);
+        scatter_add(counts, bin, one, valid);
+    }
+    if (i < count) {
+        const IT bin = bin_of(load_partial<V>(in + i, count - i), valid);
+        valid &= IT([](int n) { return n; }) < int(count - i);
+        scatter_add(counts, bin, one, valid);
+    }
+}
+
+/**\internal
+ * Maps floating-point values to \p bins uniform bins over [\p lo, \p hi).
+ */
+template <class V> struct UniformBins {
+    using IT = typename V::IndexType;
+    V lo, hi, scale, last;
+
+    UniformBins(typename V::EntryType lo_, typename V::EntryType hi_, std::size_t bins)
+        : lo(lo_)
+        , hi(hi_)
+        , scale(typename V::EntryType(bins) / (hi_ - lo_))
+        , last(typename V::EntryType(bins - 1))
+    {
+    }
+
+    Vc_INTRINSIC IT operator()(const V &x, typename IT::mask_type &valid) const
+    {
+        const typename V::mask_type inside = x >= lo && x < hi;
+        valid = simd_cast<typename IT::mask_type>(inside);
+        // rounding may map values just below hi to bins; NaN and inf become bin 0
+        return simd_cast<IT>(iif(inside, min((x - lo) * scale, last), V::Zero()));
+    }
+};
+
+/**\internal
+ * Maps integral values to the bins [0, \p bins). \p bins must not be 0.
+ */
+template <class V> struct IntegerBins {
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    V last;
+
+    explicit IntegerBins(std::size_t bins)
+        : last(T(std::min<unsigned long long>(bins - 1, std::numeric_limits<T>::max())))
+    {
+    }
+
+    Vc_INTRINSIC IT operator()(const V &x, typename IT::mask_type &valid) const
+    {
+        // check the range before the conversion to int, which wraps 64-bit values
+        const typename V::mask_type inside = x >= V::Zero() && x <= last;
+        valid = simd_cast<typename IT::mask_type>(inside);
+        return simd_cast<IT>(iif(inside, x, V::Zero()));
+    }
+};
+
+/**\internal
+ * The state shared by the threads of a parallel histogram. Chunk 0 counts into the
+ * result, every other chunk into a private histogram, so that the threads never write to
+ * the same bins.
+ */
+template <class V, class C, class BinOf> struct ParallelHistogram {
+    const typename V::EntryType *first;
+    std::size_t count;
+    std::size_t chunks;
+    C *counts;
+    std::size_t bins;
+    const BinOf &bin_of;
+    std::unique_ptr<std::vector<C>[]> privateCounts;
+
+    static void run(void *context, std::size_t chunk)
+    {
+        auto &self = *static_cast<ParallelHistogram *>(context);
+        // chunk boundaries on whole vectors, except for the end
+        const std::size_t vectors = (self.count + V::Size - 1) / V::Size;
+        const std::size_t begin = std::min(self.count, vectors * chunk / self.chunks * V::Size);
+        const std::size_t end =
+            std::min(self.count, vectors * (chunk + 1) / self.chunks * V::Size);
+        C *out = self.counts;
+        if (chunk > 0) {
+            // allocated by the thread that uses it, so that the pages are local to it
+            self.privateCounts[chunk - 1].assign(self.bins, C());
+            out = self.privateCounts[chunk - 1].data();
+        }
+        count_bins<V>(self.first + begin, end - begin, out, self.bin_of);
+    }
+};
+
+template <class V, class C, class BinOf>
+inline void parallel_count_bins(const parallel_policy &policy,
+                                const typename V::EntryType *first, std::size_t count,
+                                C *counts, std::size_t bins, const BinOf &bin_of)
+{
+    const unsigned available = Vc::Detail::parallel_thread_count();
+    const std::size_t chunks = std::max<std::size_t>(
+        1, std::min<std::size_t>(policy.threads == 0 ? available
+                                                     : std::min(policy.threads, available),
+                                 (count + V::Size - 1) / V::Size));
+    ParallelHistogram<V, C, BinOf> state = {
+        first, count, chunks, counts, bins, bin_of,
+        std::unique_ptr<std::vector<C>[]>(new std::vector<C>[chunks - 1])};
+    Vc::Detail::parallel_for_chunks(chunks, unsigned(chunks),
+                                    &ParallelHistogram<V, C, BinOf>::run, &state);
+    for (std::size_t k = 0; k + 1 < chunks; ++k) {
+        const C *partial = state.privateCounts[k].data();
+        for (std::size_t b = 0; b < bins; ++b) {
+            counts[b] += partial[b];
+        }
+    }
+}
+//}}}1
+}  // namespace Common
+
+// simd_histogram {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Counts the values in [\p first, \p last) into \p bins uniform bins over [\p lo, \p hi):
+ * value `x` increments `counts[int((x - lo) * bins / (hi - lo))]`. Values outside of
+ * [\p lo, \p hi) and NaNs are ignored. The counts are added to the existing contents of
+ * \p counts.
+ *
+ * \code
+ * std::vector<unsigned> h(100);
+ * Vc::simd_histogram(energies.data(), energies.data() + energies.size(), h.data(), h.size(),
+ *                    0.f, 50.f);
+ * \endcode
+ *
+ * \tparam T `float` or `double`.
+ * \tparam C The counter type, a vectorizable type (see Vc::Vector).
+ */
+template <class T, class C>
+inline enable_if<std::is_floating_point<T>::value, void> simd_histogram(
+    const T *first, const T *last, C *counts, std::size_t bins, T lo, T hi)
+{
+    Common::count_bins<Vector<T>>(first, last - first, counts,
+                                  Common::UniformBins<Vector<T>>(lo, hi, bins));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_histogram. Every thread counts into a private histogram;
+ * the private histograms are added to \p counts at the end.
+ */
+template <class T, class C>
+inline enable_if<std::is_floating_point<T>::value, void> simd_histogram(
+    const parallel_policy &policy, const T *first, const T *last, C *counts,
+    std::size_t bins, T lo, T hi)
+{
+    Common::parallel_count_bins<Vector<T>>(policy, first, last - first, counts, bins,
+                                           Common::UniformBins<Vector<T>>(lo, hi, bins));
+}
+
+// simd_bincount {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Counts the occurrences of the integers in [\p first, \p last): value `x` increments
+ * `counts[x]`. Values outside of [0, \p bins) are ignored. The counts are added to the
+ * existing contents of \p counts.
+ *
+ * \tparam I An integral vectorizable type.
+ * \tparam C The counter type, a vectorizable type (see Vc::Vector).
+ */
+template <class I, class C>
+inline enable_if<std::is_integral<I>::value, void> simd_bincount(const I *first,
+                                                                 const I *last, C *counts,
+                                                                 std::size_t bins)
+{
+    if (bins == 0) {
+        return;
+    }
+    Common::count_bins<Vector<I>>(first, last - first, counts,
+                                  Common::IntegerBins<Vector<I>>(bins));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/Vc>
+ *
+ * Multi-threaded variant of simd_bincount. Every thread counts into a private histogram;
+ * the private histograms are added to \p counts at the end.
+ */
+template <class I, class C>
+inline enable_if<std::is_integral<I>::value, void> simd_bincount(
+    const parallel_policy &policy, const I *first, const I *last, C *counts,
+    std::size_t bins)
+{
+    if (bins == 0) {
+        return;
+    }
+    Common::parallel_count_bins<Vector<I>>(policy, first, last - first, counts, bins,
+                                           Common::IntegerBins<Vector<I>>(bins));
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_HISTOGRAM_H_
+
+// vim: foldmethod=marker
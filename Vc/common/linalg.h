@@ -0,0 +1,490 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_LINALG_H_
+#define VC_COMMON_LINALG_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include "indexsequence.h"
+#include "memory.h"
+#include "multiplyadd.h"
+#include "streaming.h"
+#include "vectortuple.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// GemmBlocking {{{1
+/**\internal
+ * The blocking parameters of gemm for entries of type \p T.
+ *
+ * The micro-kernel keeps an MR × NR tile of C in 2 · MR vector registers. A KC × NR
+ * sliver of the packed B panel stays in L1, the packed MC × KC block of A in L2, and the
+ * packed KC × NC panel of B in L3.
+ */
+template <class T> struct GemmBlocking {
+    using V = Vector<T>;
+    static constexpr std::size_t MR = 4;
+    static constexpr std::size_t NR = 2 * V::Size;
+    static constexpr std::size_t KC = 1024 / sizeof(T);
+    static constexpr std::size_t MC = 128;
+    static constexpr std::size_t NC = 2048;
+};
+
+// pack_a / pack_b {{{1
+/**\internal
+ * Copies the \p mc × \p kc block of A at \p a into strips of MR rows, each stored column
+ * by column, i.e. `out[strip * MR * kc + k * MR + r]`. Rows past \p mc are zero. Full 4 × 4
+ * tiles are reordered with Vc::transpose.
+ */
+template <class T>
+inline void pack_a(const T *a, std::size_t lda, std::size_t mc, std::size_t kc, T *out)
+{
+    using Tile = SimdArray<T, 4>;
+    constexpr std::size_t MR = GemmBlocking<T>::MR;
+    static_assert(MR == 4, "pack_a transposes 4 × 4 tiles");
+    for (std::size_t i = 0; i < mc; i += MR, out += MR * kc, a += MR * lda) {
+        const std::size_t rows = std::min(MR, mc - i);
+        std::size_t k = 0;
+        if (rows == MR) {
+            for (; k + 4 <= kc; k += 4) {
+                const Tile r0(a + k, Vc::Unaligned);
+                const Tile r1(a + lda + k, Vc::Unaligned);
+                const Tile r2(a + 2 * lda + k, Vc::Unaligned);
+                const Tile r3(a + 3 * lda + k, Vc::Unaligned);
+                Tile c0, c1, c2, c3;
+                tie(c0, c1, c2, c3) = transpose(r0, r1, r2, r3);
+                c0.store(out + k * MR, Vc::Unaligned);
+                c1.store(out + (k + 1) * MR, Vc::Unaligned);
+                c2.store(out + (k + 2) * MR, Vc::Unaligned);
+                c3.store(out + (k + 3) * MR, Vc::Unaligned);
+            }
+        }
+        for (; k < kc; ++k) {
+            for (std::size_t r = 0; r < MR; ++r) {
+                out[k * MR + r] = r < rows ? a[r * lda + k] : T();
+            }
+        }
+    }
+}
+
+/**\internal
+ * Copies the \p kc × \p nc panel of B at \p b into slivers of NR columns, each stored row
+ * by row, i.e. `out[sliver * NR * kc + k * NR + j]`. Columns past \p nc are zero. \p out
+ * must be vector-aligned.
+ */
+template <class T>
+inline void pack_b(const T *b, std::size_t ldb, std::size_t kc, std::size_t nc, T *out)
+{
+    using V = Vector<T>;
+    constexpr std::size_t NR = GemmBlocking<T>::NR;
+    for (std::size_t j = 0; j < nc; j += NR, out += NR * kc, b += NR) {
+        const std::size_t cols = std::min(NR, nc - j);
+        if (cols == NR) {
+            for (std::size_t k = 0; k < kc; ++k) {
+                V(b + k * ldb, Vc::Unaligned).store(out + k * NR, Vc::Aligned);
+                V(b + k * ldb + V::Size, Vc::Unaligned).store(out + k * NR + V::Size, Vc::Aligned);
+            }
+        } else {
+            for (std::size_t k = 0; k < kc; ++k) {
+                for (std::size_t c = 0; c < NR; ++c) {
+                    out[k * NR + c] = c < cols ? b[k * ldb + c] : T();
+                }
+            }
+        }
+    }
+}
+
+// gemm_kernel {{{1
+/**\internal
+ * Adds \p alpha times the product of the packed MR × \p kc strip \p a and the packed
+ * \p kc × NR sliver \p b to the \p rows × \p cols tile of C at \p c.
+ */
+template <class T>
+Vc_INTRINSIC void gemm_kernel(std::size_t kc, const T *Vc_RESTRICT a,
+                              const T *Vc_RESTRICT b, T alpha, T *Vc_RESTRICT c,
+                              std::size_t ldc, std::size_t rows, std::size_t cols)
+{
+    using V = Vector<T>;
+    constexpr std::size_t MR = GemmBlocking<T>::MR;
+    constexpr std::size_t NR = GemmBlocking<T>::NR;
+    V c00 = V::Zero(), c01 = V::Zero(), c10 = V::Zero(), c11 = V::Zero();
+    V c20 = V::Zero(), c21 = V::Zero(), c30 = V::Zero(), c31 = V::Zero();
+    for (std::size_t k = 0; k < kc; ++k, a += MR, b += NR) {
+        const V b0(b, Vc::Aligned);
+        const V b1(b + V::Size, Vc::Aligned);
+        V ak = a[0];
+        c00 = multiply_add(ak, b0, c00);
+        c01 = multiply_add(ak, b1, c01);
+        ak = a[1];
+        c10 = multiply_add(ak, b0, c10);
+        c11 = multiply_add(ak, b1, c11);
+        ak = a[2];
+        c20 = multiply_add(ak, b0, c20);
+        c21 = multiply_add(ak, b1, c21);
+        ak = a[3];
+        c30 = multiply_add(ak, b0, c30);
+        c31 = multiply_add(ak, b1, c31);
+    }
+    const V alpha_v = alpha;
+    const V tile[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}};
+    if (rows == MR && cols == NR) {
+        for (std::size_t r = 0; r < MR; ++r, c += ldc) {
+            multiply_add(alpha_v, tile[r][0], V(c, Vc::Unaligned)).store(c, Vc::Unaligned);
+            multiply_add(alpha_v, tile[r][1], V(c + V::Size, Vc::Unaligned))
+                .store(c + V::Size, Vc::Unaligned);
+        }
+    } else {
+        for (std::size_t r = 0; r < rows; ++r, c += ldc) {
+            T scaled[NR];
+            (alpha_v * tile[r][0]).store(&scaled[0], Vc::Unaligned);
+            (alpha_v * tile[r][1]).store(&scaled[V::Size], Vc::Unaligned);
+            for (std::size_t j = 0; j < cols; ++j) {
+                c[j] += scaled[j];
+            }
+        }
+    }
+}
+
+// gemm_blocked {{{1
+/**\internal
+ * C += alpha · A · B for row-major A (\p m × \p k), B (\p k × \p n), and C (\p m × \p n).
+ */
+template <class T>
+inline void gemm_blocked(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a,
+                         std::size_t lda, const T *b, std::size_t ldb, T *c,
+                         std::size_t ldc)
+{
+    using B = GemmBlocking<T>;
+    using V = Vector<T>;
+    const std::size_t mcMax = std::min(B::MC, (m + B::MR - 1) / B::MR * B::MR);
+    const std::size_t kcMax = std::min(B::KC, k);
+    const std::size_t ncMax = std::min(B::NC, (n + B::NR - 1) / B::NR * B::NR);
+    Memory<V> packedA(mcMax * kcMax);
+    Memory<V> packedB(kcMax * ncMax);
+    for (std::size_t jc = 0; jc < n; jc += B::NC) {
+        const std::size_t nc = std::min(B::NC, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += B::KC) {
+            const std::size_t kc = std::min(B::KC, k - pc);
+            pack_b(b + pc * ldb + jc, ldb, kc, nc, packedB.entries());
+            for (std::size_t ic = 0; ic < m; ic += B::MC) {
+                const std::size_t mc = std::min(B::MC, m - ic);
+                pack_a(a + ic * lda + pc, lda, mc, kc, packedA.entries());
+                for (std::size_t jr = 0; jr < nc; jr += B::NR) {
+                    for (std::size_t ir = 0; ir < mc; ir += B::MR) {
+                        gemm_kernel(kc, packedA.entries() + ir * kc,
+                                    packedB.entries() + jr * kc, alpha,
+                                    c + (ic + ir) * ldc + jc + jr, ldc,
+                                    std::min(B::MR, mc - ir), std::min(B::NR, nc - jr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// scale_rows {{{1
+/**\internal
+ * Multiplies the \p m × \p n matrix at \p c by \p beta. For `beta == 0` the previous
+ * contents are ignored, so that NaNs in uninitialized memory do not propagate.
+ */
+template <class T>
+inline void scale_rows(std::size_t m, std::size_t n, T beta, T *c, std::size_t ldc)
+{
+    if (beta == T(1)) {
+        return;
+    }
+    for (std::size_t i = 0; i < m; ++i, c += ldc) {
+        if (beta == T()) {
+            std::fill_n(c, n, T());
+        } else {
+            for (std::size_t j = 0; j < n; ++j) {
+                c[j] *= beta;
+            }
+        }
+    }
+}
+
+// fixed-size kernels {{{1
+template <class V, class A, class B>
+Vc_INTRINSIC int accumulate_product(V &acc, const A &a, const B &b, std::size_t i,
+                                    std::size_t k, std::size_t jv)
+{
+    acc = multiply_add(V(a[i][k]), V(&b[k][jv * V::Size], Vc::Aligned), acc);
+    return 0;
+}
+
+/**\internal
+ * Returns the vector \p jv of row \p i of the product of the fixed-size matrices \p a and
+ * \p b, unrolled over the \p K inner products.
+ */
+template <class V, class A, class B, std::size_t... K>
+Vc_INTRINSIC V row_times_matrix(const A &a, const B &b, std::size_t i, std::size_t jv,
+                                index_sequence<0, K...>)
+{
+    V acc = V(a[i][0]) * V(&b[0][jv * V::Size], Vc::Aligned);
+    const int unused[] = {0, accumulate_product(acc, a, b, i, K, jv)...};
+    (void)unused;
+    return acc;
+}
+
+/**\internal
+ * The row stride of a two-dimensional Memory, in entries.
+ */
+template <class V, std::size_t R, std::size_t C, bool P>
+constexpr std::size_t row_stride(const Memory<V, R, C, P> &)
+{
+    return Memory<V, R, C, P>::VectorsCount * V::Size;
+}
+//}}}1
+}  // namespace Common
+
+// gemm {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile linalg.h <Vc/linalg>
+ *
+ * Computes `C = alpha · A · B + beta · C` for the row-major matrices A (\p m × \p k), B
+ * (\p k × \p n), and C (\p m × \p n). \p lda, \p ldb, and \p ldc are the row strides, in
+ * entries. For `beta == 0` the previous contents of C are not read.
+ *
+ * The product is cache-blocked: panels of B and blocks of A are copied to contiguous,
+ * aligned buffers, and a register-tiled kernel updates 4 × 2 vectors of C per step.
+ *
+ * \code
+ * // C = A · B for square n × n matrices
+ * Vc::gemm(n, n, n, 1.f, a, n, b, n, 0.f, c, n);
+ * \endcode
+ *
+ * \tparam T `float` or `double`.
+ */
+template <class T>
+inline enable_if<std::is_floating_point<T>::value, void> gemm(
+    std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda,
+    const T *b, std::size_t ldb, T beta, T *c, std::size_t ldc)
+{
+    Common::scale_rows(m, n, beta, c, ldc);
+    if (m == 0 || n == 0 || k == 0 || alpha == T()) {
+        return;
+    }
+    Common::gemm_blocked(m, n, k, alpha, a, lda, b, ldb, c, ldc);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile linalg.h <Vc/linalg>
+ *
+ * Computes `c = a · b` for matrices with compile-time sizes, such as the 3 × 3, 4 × 4,
+ * or 6 × 6 matrices of a track fit. Every row of \p c is computed in registers as a linear
+ * combination of the (padded) rows of \p b, fully unrolled over \p K. Large matrices use
+ * the cache-blocked gemm.
+ *
+ * The padding entries of the rows of \p c are overwritten with unspecified values.
+ */
+template <class V, std::size_t M, std::size_t K, std::size_t N, bool P0, bool P1, bool P2>
+inline void gemm(const Memory<V, M, K, P0> &a, const Memory<V, K, N, P1> &b,
+                 Memory<V, M, N, P2> &c)
+{
+    using T = typename V::EntryType;
+    if (K * Common::row_stride(b) * sizeof(T) > 16384) {
+        gemm(M, N, K, T(1), &a[0][0], Common::row_stride(a), &b[0][0],
+             Common::row_stride(b), T(0), &c[0][0], Common::row_stride(c));
+        return;
+    }
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t jv = 0; jv < Memory<V, M, N, P2>::VectorsCount; ++jv) {
+            Common::row_times_matrix<V>(a, b, i, jv, make_index_sequence<K>())
+                .store(&c[i][jv * V::Size], Vc::Aligned);
+        }
+    }
+}
+
+// gemv {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile linalg.h <Vc/linalg>
+ *
+ * Computes `y = alpha · A · x + beta · y` for the row-major \p m × \p n matrix A with row
+ * stride \p lda. For `beta == 0` the previous contents of \p y are not read.
+ *
+ * Four rows are processed at once, so that every vector of \p x is loaded once per four
+ * rows.
+ *
+ * \tparam T `float` or `double`.
+ */
+template <class T>
+inline enable_if<std::is_floating_point<T>::value, void> gemv(std::size_t m, std::size_t n,
+                                                              T alpha, const T *a,
+                                                              std::size_t lda, const T *x,
+                                                              T beta, T *y)
+{
+    using V = Vector<T>;
+    const auto finish = [&](std::size_t i, T dot) {
+        y[i] = beta == T() ? alpha * dot : alpha * dot + beta * y[i];
+    };
+    std::size_t i = 0;
+    for (; i + 4 <= m; i += 4, a += 4 * lda) {
+        V acc0 = V::Zero(), acc1 = V::Zero(), acc2 = V::Zero(), acc3 = V::Zero();
+        std::size_t j = 0;
+        for (; j + V::Size <= n; j += V::Size) {
+            const V xj(x + j, Vc::Unaligned);
+            acc0 = Common::multiply_add(V(a + j, Vc::Unaligned), xj, acc0);
+            acc1 = Common::multiply_add(V(a + lda + j, Vc::Unaligned), xj, acc1);
+            acc2 = Common::multiply_add(V(a + 2 * lda + j, Vc::Unaligned), xj, acc2);
+            acc3 = Common::multiply_add(V(a + 3 * lda + j, Vc::Unaligned), xj, acc3);
+        }
+        if (j < n) {
+            const V xj = Common::load_partial<V>(x + j, n - j);
+            acc0 += Common::load_partial<V>(a + j, n - j) * xj;
+            acc1 += Common::load_partial<V>(a + lda + j, n - j) * xj;
+            acc2 += Common::load_partial<V>(a + 2 * lda + j, n - j) * xj;
+            acc3 += Common::load_partial<V>(a + 3 * lda + j, n - j) * xj;
+        }
+        finish(i, acc0.sum());
+        finish(i + 1, acc1.sum());
+        finish(i + 2, acc2.sum());
+        finish(i + 3, acc3.sum());
+    }
+    for (; i < m; ++i, a += lda) {
+        V acc = V::Zero();
+        std::size_t j = 0;
+        for (; j + V::Size <= n; j += V::Size) {
+            acc = Common::multiply_add(V(a + j, Vc::Unaligned), V(x + j, Vc::Unaligned), acc);
+        }
+        if (j < n) {
+            acc += Common::load_partial<V>(a + j, n - j) * Common::load_partial<V>(x + j, n - j);
+        }
+        finish(i, acc.sum());
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile linalg.h <Vc/linalg>
+ *
+ * Computes `y = a · x` for a matrix and vectors with compile-time sizes.
+ */
+template <class V, std::size_t M, std::size_t N, bool P0, bool P1, bool P2>
+inline void gemv(const Memory<V, M, N, P0> &a, const Memory<V, N, 0, P1> &x,
+                 Memory<V, M, 0, P2> &y)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Full = N / V::Size;
+    constexpr std::size_t Tail = N % V::Size;
+    // the padding of a and x may hold anything, including NaNs
+    const typename V::mask_type tail = V::IndexesFromZero() < V(T(Tail));
+    for (std::size_t i = 0; i < M; ++i) {
+        V acc = V::Zero();
+        for (std::size_t jv = 0; jv < Full; ++jv) {
+            acc = Common::multiply_add(V(&a[i][jv * V::Size], Vc::Aligned),
+                                       V(&x[jv * V::Size], Vc::Aligned), acc);
+        }
+        if (Tail > 0) {
+            V last = V(&a[i][Full * V::Size], Vc::Aligned) * V(&x[Full * V::Size], Vc::Aligned);
+            last.setZeroInverted(tail);
+            acc += last;
+        }
+        y[i] = acc.sum();
+    }
+}
+
+// transpose_matrix {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile linalg.h <Vc/linalg>
+ *
+ * Writes the transpose of the row-major \p rows × \p cols matrix at \p a (row stride
+ * \p lda) to the \p cols × \p rows matrix at \p b (row stride \p ldb). The matrices must
+ * not overlap.
+ *
+ * The matrix is traversed in cache-sized blocks of 4 × 4 tiles, each transposed in
+ * registers with Vc::transpose.
+ */
+template <class T>
+inline enable_if<std::is_arithmetic<T>::value, void> transpose_matrix(
+    std::size_t rows, std::size_t cols, const T *a, std::size_t lda, T *b, std::size_t ldb)
+{
+    using Tile = SimdArray<T, 4>;
+    constexpr std::size_t Block = 64;
+    for (std::size_t i0 = 0; i0 < rows; i0 += Block) {
+        const std::size_t iEnd = std::min(rows, i0 + Block);
+        for (std::size_t j0 = 0; j0 < cols; j0 += Block) {
+            const std::size_t jEnd = std::min(cols, j0 + Block);
+            std::size_t i = i0;
+            for (; i + 4 <= iEnd; i += 4) {
+                std::size_t j = j0;
+                for (; j + 4 <= jEnd; j += 4) {
+                    const T *src = a + i * lda + j;
+                    T *dst = b + j * ldb + i;
+                    const Tile r0(src, Vc::Unaligned);
+                    const Tile r1(src + lda, Vc::Unaligned);
+                    const Tile r2(src + 2 * lda, Vc::Unaligned);
+                    const Tile r3(src + 3 * lda, Vc::Unaligned);
+                    Tile c0, c1, c2, c3;
+                    tie(c0, c1, c2, c3) = transpose(r0, r1, r2, r3);
+                    c0.store(dst, Vc::Unaligned);
+                    c1.store(dst + ldb, Vc::Unaligned);
+                    c2.store(dst + 2 * ldb, Vc::Unaligned);
+                    c3.store(dst + 3 * ldb, Vc::Unaligned);
+                }
+                for (; j < jEnd; ++j) {
+                    for (std::size_t r = 0; r < 4; ++r) {
+                        b[j * ldb + i + r] = a[(i + r) * lda + j];
+                    }
+                }
+            }
+            for (; i < iEnd; ++i) {
+                for (std::size_t j = j0; j < jEnd; ++j) {
+                    b[j * ldb + i] = a[i * lda + j];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile linalg.h <Vc/linalg>
+ *
+ * Writes the transpose of \p a to \p b.
+ */
+template <class V, std::size_t M, std::size_t N, bool P0, bool P1>
+inline void transpose_matrix(const Memory<V, M, N, P0> &a, Memory<V, N, M, P1> &b)
+{
+    transpose_matrix(M, N, &a[0][0], Common::row_stride(a), &b[0][0],
+                     Common::row_stride(b));
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_LINALG_H_
+
+// vim: foldmethod=marker
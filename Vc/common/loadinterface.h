@@ -55,7 +55,7 @@ template <typename U, typename Flags = DefaultLoadTag,
           typename = enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+              Traits::is_load_store_type<U, EntryType>::value &&Traits::is_load_store_flag<Flags>::value>>
 explicit Vc_INTRINSIC Vector(const U *x, Flags flags = Flags())
 {
     load<U, Flags>(x, flags);
@@ -94,12 +94,40 @@ template <typename U, typename Flags>
 struct load_concept : public std::enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value && Traits::is_load_store_flag<Flags>::value, void>
+              Traits::is_load_store_type<U, EntryType>::value && Traits::is_load_store_flag<Flags>::value, void>
 {};
 
 public:
 template <typename U, typename Flags = DefaultLoadTag>
 Vc_INTRINSIC_L typename load_concept<U, Flags>::type load(const U *mem, Flags = Flags()) Vc_INTRINSIC_R;
+
+/**
+ * Load the vector entries from \p mem where \p mask is set. The entries where \p mask is
+ * not set keep their previous values.
+ *
+ * Memory at the offsets of the inactive entries is never written and never read if the
+ * read could fault. Thus \p mem may point to the last few elements of an array, which
+ * makes this function suitable for processing the remainder of a loop without a scalar
+ * epilogue:
+ * \code
+ * const float_m active = float_v::IndexesFromZero() < float_v(n - i);
+ * float_v x = float_v::Zero();
+ * x.load(&data[i], active);
+ * \endcode
+ *
+ * \param mem A pointer to data. If \p flags contains the Vc::Aligned flag, the pointer
+ *            must be aligned on a MemoryAlignment boundary.
+ * \param mask A mask object that determines which entries of the vector are loaded.
+ * \param flags A (combination of) flag object(s), such as Vc::Aligned, Vc::Unaligned,
+ *              and/or Vc::PrefetchDefault.
+ *
+ * \note
+ * The masked load does not unpack the values from memory. I.e. the entry at offset \c i
+ * is loaded from `mem[i]`, independent of whether `mask[j]` for any `j < i` is \c false.
+ */
+template <typename U, typename Flags = DefaultLoadTag>
+Vc_INTRINSIC_L typename load_concept<U, Flags>::type load(const U *mem, MaskArgument mask,
+                                                          Flags = Flags()) Vc_INTRINSIC_R;
 //}}}1
 
 // vim: foldmethod=marker
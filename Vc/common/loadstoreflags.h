@@ -50,6 +50,10 @@ namespace LoadStoreFlags
 struct StreamingFlag {};
 struct UnalignedFlag {};
 struct PrefetchFlagBase {};
+/**\internal
+ * The stride value of PrefetchFlag that selects the runtime-calibrated prefetch distance.
+ */
+constexpr size_t CalibratedPrefetchStride = ~size_t(0);
 // TODO: determine a good default for typical CPU use
 template <size_t L1 = 16 * 64, size_t L2 = 128 * 64, typename ExclusiveOrShared_ = void>
 struct PrefetchFlag : public PrefetchFlagBase {
@@ -210,6 +214,17 @@ constexpr StreamingTag Streaming;
  * emitted.
  */
 constexpr LoadStoreFlags::LoadStoreFlags<PrefetchFlag<>> PrefetchDefault;
+
+/**
+ * Use this object for a \p flags parameter to request software prefetches with the
+ * distance determined by a runtime calibration on first use (see Vc::prefetch_policy).
+ * The calibration can be overridden with the \c VC_PREFETCH_DISTANCE environment
+ * variable (in bytes).
+ */
+constexpr LoadStoreFlags::LoadStoreFlags<
+    PrefetchFlag<LoadStoreFlags::CalibratedPrefetchStride,
+                 LoadStoreFlags::CalibratedPrefetchStride>>
+    PrefetchCalibrated;
 ///@}
 
 /**
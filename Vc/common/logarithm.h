@@ -273,4 +273,23 @@ Vc_INTRINSIC Vc_CONST Vector<T, detail::not_fixed_size_abi<Abi>> log2(
     return Detail::LogImpl<Base2>::calc<T, Abi>(x);
 }
 
+/**
+ * \ingroup Math
+ * Returns \f$\ln(1 + x)\f$ for all input values in \p x. The result is accurate also for
+ * values of \p x close to zero, where `log(1 + x)` loses the low bits of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> log1p(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    const V u = x + V::One();
+    // ln(1 + x) = ln(u) · x / (u - 1) cancels the rounding error of u = 1 + x
+    V r = log(u) * (x / (u - V::One()));
+    r(u == V::One() || isnan(x) || x == std::numeric_limits<T>::infinity()) = x;
+    return r;
+}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
@@ -0,0 +1,136 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_MASKEDLOADSTORE_H_
+#define VC_COMMON_MASKEDLOADSTORE_H_
+
+#include <cstdint>
+#include "bitscanintrinsics.h"
+#include "macros.h"
+
+// AddressSanitizer reports the harmless over-read of the full-width load. Use the per-lane
+// loop instead.
+#if defined __SANITIZE_ADDRESS__
+#define Vc_MASKED_LOAD_NO_OVERREAD_ 1
+#elif defined __has_feature
+#if __has_feature(address_sanitizer)
+#define Vc_MASKED_LOAD_NO_OVERREAD_ 1
+#endif
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * Returns whether the \p Bytes Bytes starting at \p addr lie within one 4 KiB page.
+ * Larger pages are multiples of 4 KiB, so reading these Bytes cannot fault if any one of
+ * them is accessible.
+ */
+template <std::size_t Bytes> Vc_INTRINSIC bool is_within_one_page(const void *addr)
+{
+    static_assert(Bytes <= 4096, "is_within_one_page requires Bytes <= 4096");
+    return (reinterpret_cast<std::uintptr_t>(addr) & 4095u) <= 4096u - Bytes;
+}
+
+/**\internal
+ * Returns whether a full-width access of \p Bytes Bytes at \p addr cannot fault if the
+ * lanes in \p mask are accessible. At least one active lane is required for the page to
+ * be known to be accessible.
+ */
+template <std::size_t Bytes, typename M>
+Vc_INTRINSIC bool is_full_width_access_safe(const void *addr, const M &mask)
+{
+    return !mask.isEmpty() && is_within_one_page<Bytes>(addr);
+}
+
+/**\internal
+ * Returns whether \p Bytes Bytes may be read at \p addr although only a prefix of them is
+ * known to be accessible. This requires that they lie within one page and that the
+ * over-read is not reported by AddressSanitizer.
+ */
+template <std::size_t Bytes> Vc_INTRINSIC bool is_overread_safe(const void *addr)
+{
+#ifdef Vc_MASKED_LOAD_NO_OVERREAD_
+    return false;
+#else
+    return is_within_one_page<Bytes>(addr);
+#endif
+}
+
+/**\internal
+ * Loads `mem[i]` into `v[i]` for all \p i where \p mask is set and leaves the other
+ * entries of \p v unchanged. Memory of inactive lanes is never written and never read if
+ * that read could fault: a full-width load followed by a blend is used if the full vector
+ * lies within one page, otherwise the active lanes are loaded one by one.
+ *
+ * This is the implementation for targets without a masked load instruction (SSE) and for
+ * converting loads.
+ */
+template <typename V, typename U, typename Flags>
+Vc_INTRINSIC void masked_load(V &v, const U *mem, const typename V::MaskArgument mask,
+                              Flags flags)
+{
+    if (mask.isFull()) {
+        v.load(mem, flags);
+        return;
+    }
+    if (!mask.isEmpty() && is_overread_safe<V::Size * sizeof(U)>(mem)) {
+        where(mask) | v = V(mem, flags);
+        return;
+    }
+    unsigned bits = mask.toInt();
+    while (bits) {
+        const int i = _bit_scan_forward(bits);
+        bits &= bits - 1;
+        v[i] = mem[i];
+    }
+}
+
+/**\internal
+ * Stores `v[i]` to `mem[i]` for all \p i where \p mask is set, one entry at a time.
+ *
+ * This is the fallback for masked stores that are implemented with `maskmovdqu`, which may
+ * fault on the inactive lanes if the vector crosses into an inaccessible page.
+ */
+template <typename V, typename U>
+Vc_INTRINSIC void masked_store_per_lane(const V &v, U *mem,
+                                        const typename V::MaskArgument mask)
+{
+    unsigned bits = mask.toInt();
+    while (bits) {
+        const int i = _bit_scan_forward(bits);
+        bits &= bits - 1;
+        mem[i] = v[i];
+    }
+}
+}  // namespace Common
+}  // namespace Vc
+
+#undef Vc_MASKED_LOAD_NO_OVERREAD_
+
+#endif  // VC_COMMON_MASKEDLOADSTORE_H_
@@ -51,6 +51,20 @@ template <class T, size_t N> SimdArray<int, N> fpclassify(const SimdArray<T, N>
 
 #ifdef Vc_IMPL_SSE
 // for SSE, AVX, and AVX2
+namespace Common
+{
+/**\internal
+ * Enables the vectorized implementations of the math functions for `float` and `double`
+ * vectors of the SSE and AVX ABIs. The Scalar ABI uses the `<cmath>` functions instead
+ * and SimdArray forwards to one of the two.
+ */
+template <typename T, typename Abi>
+using enable_if_vectorized_math =
+    enable_if<std::is_floating_point<T>::value &&
+              (std::is_same<Abi, VectorAbi::Sse>::value ||
+               std::is_same<Abi, VectorAbi::Avx>::value)>;
+}  // namespace Common
+
 #include "logarithm.h"
 #include "exponential.h"
 #ifdef Vc_IMPL_AVX
@@ -134,6 +148,75 @@ inline SSE::double_v exp(SSE::double_v::AsArg _x) {
         return x;
     }
 
+#include "erf.h"
+
+namespace Common
+{
+/**\internal
+ * Returns ∛a for a ∈ [1, 8[. The initial approximation has a max. relative error of
+ * 1.3e-2; each step of Halley's iteration triples the number of correct digits.
+ */
+template <typename V> Vc_ALWAYS_INLINE V cbrt_halley(const V &a, int steps)
+{
+    V y = ((1.6274954e-3 * a - 3.40260528e-2) * a + 3.28836441e-1) * a + 7.16734648e-1;
+    for (int i = 0; i < steps; ++i) {
+        const V y3 = y * y * y;
+        y *= (y3 + a + a) / (y3 + y3 + a);
+    }
+    return y;
+}
+
+template <typename Abi> Vc_ALWAYS_INLINE Vector<float, Abi> cbrt_kernel(const Vector<float, Abi> &a)
+{
+    // two steps in double precision leave only the final rounding to float
+    using V = Vector<float, Abi>;
+    return simd_cast<V>(cbrt_halley(simd_cast<SimdArray<double, V::Size>>(a), 2));
+}
+
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> cbrt_kernel(const Vector<double, Abi> &a)
+{
+    using V = Vector<double, Abi>;
+    const V y = cbrt_halley(a, 3);
+    // a final Newton step with the residual y³ - a evaluated in extended precision
+    const V y2 = y * y;
+    const V residual = fma(y2, y, -a) + fma(y, y, -y2) * y;
+    return y - residual / (y2 * 3.);
+}
+}  // namespace Common
+
+/**
+ * \ingroup Math
+ * Returns the cube root of all input values in \p x.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp.
+ * \note The double-precision implementation has an error of max. 1 ulp.
+ */
+template <typename T, typename Abi, typename = Common::enable_if_vectorized_math<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> cbrt(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    using C = Detail::Const<T, Abi>;
+
+    V a = abs(x);
+    const M denormal = a < C::min();
+    a(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+    V e = Detail::exponent(a.data());
+    e(denormal) -= 54;
+    a.setZero(C::exponentMask());
+    a = Detail::operator|(a, V::One());  // a ∈ [1, 2[
+
+    // |x| = a · 2^(3q + r) with r ∈ {0, 1, 2} ⇒ ∛|x| = ∛(a · 2ʳ) · 2^q
+    const V q = floor((e + T(0.5)) * T(1. / 3.));
+    const V r = e - q * T(3);
+    a(r == V::One()) *= T(2);
+    a(r == T(2)) *= T(4);  // a ∈ [1, 8[
+
+    V y = copysign(ldexp(Common::cbrt_kernel(a), static_cast<SimdArray<int, V::Size>>(q)), x);
+    y(x == V::Zero() || !isfinite(x)) = x;
+    return y;
+}
 #endif
 }  // namespace Vc
 
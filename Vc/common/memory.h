@@ -412,6 +412,19 @@ class Memory<V, Size, 0u, InitPadding> :
                 }
                 return *this;
             }
+
+            /**
+             * Evaluates the memory expression \p rhs in one vectorized pass and stores
+             * the result.
+             *
+             * \see MemoryExpression
+             */
+            template <typename E>
+            inline Memory &operator=(const MemoryExpression<E> &rhs)
+            {
+                evaluate(*this, rhs);
+                return *this;
+            }
     };
 
     /**
@@ -588,6 +601,21 @@ class Memory<V, Size, 0u, InitPadding> :
             std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
             return *this;
         }
+
+        /**
+         * Evaluates the memory expression \p rhs in one vectorized pass and stores the
+         * result.
+         *
+         * \note this function requires that \p rhs has entriesCount() many entries.
+         *
+         * \see MemoryExpression
+         */
+        template <typename E>
+        inline Memory &operator=(const MemoryExpression<E> &rhs)
+        {
+            evaluate(*this, rhs);
+            return *this;
+        }
 };
 
 /**
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 #include <type_traits>
 #include <iterator>
+#include "memoryexpression.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -401,6 +402,9 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
 
         /**
          * Return a (vectorized) iterator to the start of this memory object.
+         *
+         * The \p flags apply to all loads and stores through the iterator. Use e.g.
+         * `Vc::Aligned | Vc::PrefetchCalibrated` to prefetch ahead of the iteration.
          */
         template<typename Flags = AlignedTag>
         Vc_ALWAYS_INLINE MemoryVectorIterator<      V, Flags> begin(Flags flags = Flags())       { return &firstVector(flags); }
@@ -0,0 +1,568 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_MEMORYEXPRESSION_H_
+#define VC_COMMON_MEMORYEXPRESSION_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "loadstoreflags.h"
+#include "multiplyadd.h"
+#include "parallel.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+template <typename V, typename Parent, int Dimension, typename RowMemory> class MemoryBase;
+template <typename T, std::ptrdiff_t Extent> class span;
+
+// MemoryExpression {{{1
+/**
+ * \ingroup Containers
+ * \headerfile memory.h <Vc/Memory>
+ *
+ * Common base class of the lazily evaluated expressions over one-dimensional Vc::Memory
+ * objects and Vc::span views.
+ *
+ * The arithmetic operators `+`, `-`, `*`, and `/` applied to Memory objects, spans,
+ * and scalars (at least one operand must be an array) do not compute anything. They
+ * return a small expression object that references the operands. The whole expression
+ * is evaluated when it is assigned to a Memory object (or passed to Vc::evaluate), in a
+ * single vectorized loop without temporary arrays:
+ * \code
+ * Vc::Memory<float_v> a(n), b(n), c(n), d(n);
+ * a = b * c + d;     // one pass over b, c, d, and a
+ * a += 2.f * b;      // one pass over a and b
+ * Vc::evaluate(Vc::parallel, Vc::span<float, Vc::dynamic_extent>(out, n), b * c - d);
+ * \endcode
+ *
+ * - Subexpressions of the form `x * y + z`, `x * y - z`, and `z - x * y` are contracted
+ *   to Vc::fma for floating-point entries if the target has FMA instructions. The result
+ *   then is rounded once instead of twice.
+ * - The entries after the last full vector are evaluated with one masked vector
+ *   operation. Masked-out lanes of array operands read as 1, so that integer division
+ *   cannot trap on them.
+ * - Expressions are evaluated entry by entry. The destination may be one of the
+ *   operands, but must not overlap an operand at a different offset.
+ * - The expression references its array operands. It must not outlive them.
+ */
+template <class E> struct MemoryExpression {
+    Vc_INTRINSIC const E &derived() const { return static_cast<const E &>(*this); }
+};
+
+// leaves {{{1
+/**\internal
+ * Array operand of a memory expression: \p size entries of type \p T at \p data. \p A is
+ * the vector type the array is padded and aligned for (Memory), or \c void (span).
+ * Vectors of type \p A are loaded with aligned loads.
+ */
+template <class T, class A>
+class MemoryExprArray : public MemoryExpression<MemoryExprArray<T, A>>
+{
+    const T *m_data;
+    std::size_t m_size;
+
+    template <class V>
+    using load_flags = typename std::conditional<std::is_same<V, A>::value, AlignedTag,
+                                                 UnalignedTag>::type;
+
+public:
+    typedef T value_type;
+
+    Vc_INTRINSIC MemoryExprArray(const T *data, std::size_t size)
+        : m_data(data), m_size(size)
+    {
+    }
+
+    Vc_INTRINSIC std::size_t size() const { return m_size; }
+
+    template <class V> Vc_INTRINSIC V vector(std::size_t i) const
+    {
+        return V(m_data + i, load_flags<V>());
+    }
+
+    template <class V>
+    Vc_INTRINSIC V vector(std::size_t i, const typename V::mask_type &k) const
+    {
+        V r = V::One();
+        r.load(m_data + i, k, Vc::Unaligned);
+        return r;
+    }
+};
+
+/**\internal
+ * Scalar operand of a memory expression, broadcast to all lanes. Its size() is 0: it
+ * fits arrays of any size.
+ */
+template <class T> class MemoryExprScalar : public MemoryExpression<MemoryExprScalar<T>>
+{
+    T m_value;
+
+public:
+    typedef T value_type;
+
+    Vc_INTRINSIC explicit MemoryExprScalar(T value) : m_value(value) {}
+
+    Vc_INTRINSIC std::size_t size() const { return 0; }
+
+    template <class V> Vc_INTRINSIC V vector(std::size_t) const { return V(m_value); }
+
+    template <class V>
+    Vc_INTRINSIC V vector(std::size_t, const typename V::mask_type &) const
+    {
+        return V(m_value);
+    }
+};
+
+// MemoryExprBinary / MemoryExprNegate {{{1
+/**\internal
+ * Applies the operation \p Op to the operands \p L and \p R. `Op::apply<V>(l, r, i...)`
+ * returns the vector at entry offset \p i (and with mask \p k for the tail).
+ */
+template <class Op, class L, class R>
+class MemoryExprBinary : public MemoryExpression<MemoryExprBinary<Op, L, R>>
+{
+    static_assert(std::is_same<typename L::value_type, typename R::value_type>::value,
+                  "the operands of a memory expression must have the same entry type");
+
+    L m_left;
+    R m_right;
+
+public:
+    typedef typename L::value_type value_type;
+
+    Vc_INTRINSIC MemoryExprBinary(const L &l, const R &r) : m_left(l), m_right(r)
+    {
+        Vc_ASSERT(l.size() == 0 || r.size() == 0 || l.size() == r.size());
+    }
+
+    Vc_INTRINSIC std::size_t size() const
+    {
+        return m_left.size() != 0 ? m_left.size() : m_right.size();
+    }
+
+    Vc_INTRINSIC const L &left() const { return m_left; }
+    Vc_INTRINSIC const R &right() const { return m_right; }
+
+    template <class V, class... I> Vc_INTRINSIC V vector(const I &... i) const
+    {
+        return Op::template apply<V>(m_left, m_right, i...);
+    }
+};
+
+/**\internal
+ * Negates the operand \p E.
+ */
+template <class E> class MemoryExprNegate : public MemoryExpression<MemoryExprNegate<E>>
+{
+    E m_operand;
+
+public:
+    typedef typename E::value_type value_type;
+
+    Vc_INTRINSIC explicit MemoryExprNegate(const E &e) : m_operand(e) {}
+
+    Vc_INTRINSIC std::size_t size() const { return m_operand.size(); }
+
+    Vc_INTRINSIC const E &operand() const { return m_operand; }
+
+    template <class V, class... I> Vc_INTRINSIC V vector(const I &... i) const
+    {
+        return -m_operand.template vector<V>(i...);
+    }
+};
+
+// operations {{{1
+/**\internal
+ * Returns `a * b + c`. For floating-point entries it is computed with a single rounding
+ * if the target has FMA instructions.
+ */
+template <class V>
+Vc_INTRINSIC V contract_multiply_add(const V &a, const V &b, const V &c, std::true_type)
+{
+    return multiply_add(a, b, c);
+}
+template <class V>
+Vc_INTRINSIC V contract_multiply_add(const V &a, const V &b, const V &c, std::false_type)
+{
+    return a * b + c;
+}
+template <class V>
+Vc_INTRINSIC V contract_multiply_add(const V &a, const V &b, const V &c)
+{
+    return contract_multiply_add(
+        a, b, c, std::is_floating_point<typename V::EntryType>());
+}
+
+struct MemoryExprMultiply {
+    template <class V, class L, class R, class... I>
+    static Vc_INTRINSIC V apply(const L &l, const R &r, const I &... i)
+    {
+        return l.template vector<V>(i...) * r.template vector<V>(i...);
+    }
+};
+
+struct MemoryExprDivide {
+    template <class V, class L, class R, class... I>
+    static Vc_INTRINSIC V apply(const L &l, const R &r, const I &... i)
+    {
+        return l.template vector<V>(i...) / r.template vector<V>(i...);
+    }
+};
+
+template <class A, class B>
+using MemoryExprProduct = MemoryExprBinary<MemoryExprMultiply, A, B>;
+
+/**\internal
+ * `l + r`, contracting a product operand to a multiply-add.
+ */
+struct MemoryExprAdd {
+    template <class V, class L, class R, class... I>
+    static Vc_INTRINSIC V apply(const L &l, const R &r, const I &... i)
+    {
+        return l.template vector<V>(i...) + r.template vector<V>(i...);
+    }
+    template <class V, class A, class B, class R, class... I>
+    static Vc_INTRINSIC V apply(const MemoryExprProduct<A, B> &l, const R &r,
+                                const I &... i)
+    {
+        return contract_multiply_add(l.left().template vector<V>(i...),
+                                     l.right().template vector<V>(i...),
+                                     r.template vector<V>(i...));
+    }
+    template <class V, class L, class A, class B, class... I>
+    static Vc_INTRINSIC V apply(const L &l, const MemoryExprProduct<A, B> &r,
+                                const I &... i)
+    {
+        return contract_multiply_add(r.left().template vector<V>(i...),
+                                     r.right().template vector<V>(i...),
+                                     l.template vector<V>(i...));
+    }
+    template <class V, class A, class B, class C, class D, class... I>
+    static Vc_INTRINSIC V apply(const MemoryExprProduct<A, B> &l,
+                                const MemoryExprProduct<C, D> &r, const I &... i)
+    {
+        return contract_multiply_add(l.left().template vector<V>(i...),
+                                     l.right().template vector<V>(i...),
+                                     r.template vector<V>(i...));
+    }
+};
+
+/**\internal
+ * `l - r`, contracting a product operand to a multiply-add.
+ */
+struct MemoryExprSubtract {
+    template <class V, class L, class R, class... I>
+    static Vc_INTRINSIC V apply(const L &l, const R &r, const I &... i)
+    {
+        return l.template vector<V>(i...) - r.template vector<V>(i...);
+    }
+    template <class V, class A, class B, class R, class... I>
+    static Vc_INTRINSIC V apply(const MemoryExprProduct<A, B> &l, const R &r,
+                                const I &... i)
+    {
+        return contract_multiply_add(l.left().template vector<V>(i...),
+                                     l.right().template vector<V>(i...),
+                                     -r.template vector<V>(i...));
+    }
+    template <class V, class L, class A, class B, class... I>
+    static Vc_INTRINSIC V apply(const L &l, const MemoryExprProduct<A, B> &r,
+                                const I &... i)
+    {
+        return contract_multiply_add(-r.left().template vector<V>(i...),
+                                     r.right().template vector<V>(i...),
+                                     l.template vector<V>(i...));
+    }
+    template <class V, class A, class B, class C, class D, class... I>
+    static Vc_INTRINSIC V apply(const MemoryExprProduct<A, B> &l,
+                                const MemoryExprProduct<C, D> &r, const I &... i)
+    {
+        return contract_multiply_add(l.left().template vector<V>(i...),
+                                     l.right().template vector<V>(i...),
+                                     -r.template vector<V>(i...));
+    }
+};
+
+// operand traits {{{1
+/**\internal
+ * Returns the expression node for an array operand: the expression itself, or a
+ * MemoryExprArray referencing the entries of a one-dimensional Memory or a span.
+ */
+template <class E>
+Vc_INTRINSIC const E &as_memory_expression(const MemoryExpression<E> &x)
+{
+    return x.derived();
+}
+template <class V, class Parent, class RowMemory>
+Vc_INTRINSIC MemoryExprArray<typename V::EntryType, V> as_memory_expression(
+    const MemoryBase<V, Parent, 1, RowMemory> &x)
+{
+    return {x.entries(), x.entriesCount()};
+}
+template <class U, std::ptrdiff_t Extent>
+Vc_INTRINSIC MemoryExprArray<typename std::remove_cv<U>::type, void> as_memory_expression(
+    const span<U, Extent> &x)
+{
+    return {x.data(), static_cast<std::size_t>(x.size())};
+}
+
+/**\internal
+ * Whether \p X is an array operand of memory expressions. \c type is its expression node
+ * and \c value_type its entry type. \c value_type is \c void for all other types.
+ */
+template <class X, class = void> struct memory_expression_array : std::false_type {
+    typedef void value_type;
+};
+template <class X>
+struct memory_expression_array<
+    X, decltype(as_memory_expression(std::declval<const X &>()), void())>
+    : std::true_type {
+    typedef typename std::decay<decltype(
+        as_memory_expression(std::declval<const X &>()))>::type type;
+    typedef typename type::value_type value_type;
+};
+
+/**\internal
+ * The entry type of the binary memory expression `L op R`. Undefined unless both are
+ * arrays with equal entry types, or one is an array and the other arithmetic.
+ */
+template <class L, class R, class TL = typename memory_expression_array<L>::value_type,
+          class TR = typename memory_expression_array<R>::value_type>
+struct memory_expression_value_type
+    : std::enable_if<std::is_same<TL, TR>::value, TL> {
+};
+template <class L, class R, class TR>
+struct memory_expression_value_type<L, R, void, TR>
+    : std::enable_if<std::is_arithmetic<L>::value, TR> {
+};
+template <class L, class R, class TL>
+struct memory_expression_value_type<L, R, TL, void>
+    : std::enable_if<std::is_arithmetic<R>::value, TL> {
+};
+template <class L, class R> struct memory_expression_value_type<L, R, void, void> {
+};
+
+/**\internal
+ * Converts the operand \p X of an expression with entry type \p T to its node: arrays
+ * via as_memory_expression, scalars to MemoryExprScalar<T>.
+ */
+template <class T, class X, bool = memory_expression_array<X>::value>
+struct memory_expression_operand {
+    typedef typename memory_expression_array<X>::type type;
+    static Vc_INTRINSIC type convert(const X &x) { return as_memory_expression(x); }
+};
+template <class T, class X> struct memory_expression_operand<T, X, false> {
+    typedef MemoryExprScalar<T> type;
+    static Vc_INTRINSIC type convert(const X &x) { return type(static_cast<T>(x)); }
+};
+
+// operators {{{1
+#define Vc_MEMORY_EXPRESSION_OPERATOR_(op_, name_)                                      \
+    template <class L, class R,                                                          \
+              class T = typename memory_expression_value_type<L, R>::type>               \
+    Vc_INTRINSIC MemoryExprBinary<name_, typename memory_expression_operand<T, L>::type, \
+                                  typename memory_expression_operand<T, R>::type>        \
+    operator op_(const L &l, const R &r)                                                 \
+    {                                                                                    \
+        return {memory_expression_operand<T, L>::convert(l),                             \
+                memory_expression_operand<T, R>::convert(r)};                            \
+    }
+Vc_MEMORY_EXPRESSION_OPERATOR_(+, MemoryExprAdd);
+Vc_MEMORY_EXPRESSION_OPERATOR_(-, MemoryExprSubtract);
+Vc_MEMORY_EXPRESSION_OPERATOR_(*, MemoryExprMultiply);
+Vc_MEMORY_EXPRESSION_OPERATOR_(/, MemoryExprDivide);
+#undef Vc_MEMORY_EXPRESSION_OPERATOR_
+
+template <class X, class = enable_if<memory_expression_array<X>::value>>
+Vc_INTRINSIC MemoryExprNegate<typename memory_expression_array<X>::type> operator-(
+    const X &x)
+{
+    return MemoryExprNegate<typename memory_expression_array<X>::type>(
+        as_memory_expression(x));
+}
+
+// evaluate {{{1
+/**\internal
+ * Below this number of entries, the parallel overloads of evaluate run on the calling
+ * thread only.
+ */
+constexpr std::size_t memory_expression_parallel_threshold = 65536;
+
+/**\internal
+ * Stores the entries [\p begin, \p end) of \p e to \p dst, with vectors of type \p V.
+ * \p begin must be a multiple of `V::Size`. Full vectors are stored with \p Flags, the
+ * remainder with one masked unaligned store.
+ */
+template <class V, class Flags, class T, class E>
+inline void evaluate_memory_expression(T *dst, const E &e, std::size_t begin,
+                                       std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + V::Size <= end; i += V::Size) {
+        e.template vector<V>(i).store(dst + i, Flags());
+    }
+    if (i < end) {
+        const typename V::mask_type k =
+            V::IndexesFromZero() < V(static_cast<typename V::EntryType>(end - i));
+        e.template vector<V>(i, k).store(dst + i, k, Vc::Unaligned);
+    }
+}
+
+/**\internal
+ * The state shared by the threads of a parallel evaluate. Every chunk but the last
+ * consists of full vectors.
+ */
+template <class V, class Flags, class T, class E> struct ParallelMemoryExpression {
+    T *dst;
+    const E &e;
+    std::size_t count;
+    std::size_t chunkSize;
+
+    static void run(void *context, std::size_t chunk)
+    {
+        const auto &self = *static_cast<ParallelMemoryExpression *>(context);
+        const std::size_t begin = chunk * self.chunkSize;
+        evaluate_memory_expression<V, Flags>(
+            self.dst, self.e, begin, std::min(begin + self.chunkSize, self.count));
+    }
+};
+
+template <class V, class Flags, class T, class E>
+inline void evaluate_memory_expression(const parallel_policy &policy, T *dst, const E &e,
+                                       std::size_t count)
+{
+    if (count < memory_expression_parallel_threshold) {
+        evaluate_memory_expression<V, Flags>(dst, e, 0, count);
+        return;
+    }
+    std::size_t chunkSize = policy.chunk_size == 0 ? 16384 : policy.chunk_size;
+    chunkSize = (chunkSize + V::Size - 1) / V::Size * V::Size;
+    ParallelMemoryExpression<V, Flags, T, E> state = {dst, e, count, chunkSize};
+    Vc::Detail::parallel_for_chunks((count + chunkSize - 1) / chunkSize, policy.threads,
+                                    &ParallelMemoryExpression<V, Flags, T, E>::run,
+                                    &state);
+}
+
+/**
+ * \ingroup Containers
+ * \headerfile memory.h <Vc/Memory>
+ *
+ * Evaluates the memory expression \p e (see MemoryExpression) in one vectorized pass
+ * and stores the result to \p dst. `dst = e` is equivalent for Memory objects.
+ *
+ * \param dst A one-dimensional Memory object with as many entries as the arrays in \p e.
+ * \param e The expression to evaluate. Its entry type must match the entry type of \p
+ *          dst.
+ */
+template <class V, class Parent, class RowMemory, class E>
+inline void evaluate(MemoryBase<V, Parent, 1, RowMemory> &dst, const MemoryExpression<E> &e)
+{
+    static_assert(std::is_same<typename V::EntryType, typename E::value_type>::value,
+                  "the memory expression and its destination must have the same entry type");
+    Vc_ASSERT(e.derived().size() == dst.entriesCount());
+    evaluate_memory_expression<V, AlignedTag>(dst.entries(), e.derived(), 0,
+                                              dst.entriesCount());
+}
+
+/**
+ * \ingroup Containers
+ *
+ * Evaluates the memory expression \p e and stores the result to the entries viewed by \p
+ * dst. The vector type is `Vc::Vector<T>`.
+ */
+template <class T, std::ptrdiff_t Extent, class E>
+inline void evaluate(span<T, Extent> dst, const MemoryExpression<E> &e)
+{
+    static_assert(std::is_same<T, typename E::value_type>::value,
+                  "the memory expression and its destination must have the same entry type");
+    Vc_ASSERT(e.derived().size() == static_cast<std::size_t>(dst.size()));
+    evaluate_memory_expression<Vector<T>, UnalignedTag>(dst.data(), e.derived(), 0,
+                                                        dst.size());
+}
+
+/**
+ * \ingroup Containers
+ *
+ * Multi-threaded variant of evaluate. Destinations with at least 65536 entries are split
+ * into chunks of `policy.chunk_size` entries, which are evaluated by the libVc
+ * work-stealing thread pool. Smaller destinations are evaluated on the calling thread.
+ */
+template <class V, class Parent, class RowMemory, class E>
+inline void evaluate(const parallel_policy &policy,
+                     MemoryBase<V, Parent, 1, RowMemory> &dst, const MemoryExpression<E> &e)
+{
+    static_assert(std::is_same<typename V::EntryType, typename E::value_type>::value,
+                  "the memory expression and its destination must have the same entry type");
+    Vc_ASSERT(e.derived().size() == dst.entriesCount());
+    evaluate_memory_expression<V, AlignedTag>(policy, dst.entries(), e.derived(),
+                                              dst.entriesCount());
+}
+
+/**
+ * \ingroup Containers
+ *
+ * Multi-threaded variant of evaluate for spans.
+ */
+template <class T, std::ptrdiff_t Extent, class E>
+inline void evaluate(const parallel_policy &policy, span<T, Extent> dst,
+                     const MemoryExpression<E> &e)
+{
+    static_assert(std::is_same<T, typename E::value_type>::value,
+                  "the memory expression and its destination must have the same entry type");
+    Vc_ASSERT(e.derived().size() == static_cast<std::size_t>(dst.size()));
+    evaluate_memory_expression<Vector<T>, UnalignedTag>(policy, dst.data(), e.derived(),
+                                                        dst.size());
+}
+
+// compound assignment {{{1
+#define Vc_MEMORY_EXPRESSION_ASSIGNMENT_(op_)                                           \
+    template <class V, class Parent, class RowMemory, class E>                           \
+    inline Parent &operator op_##=(MemoryBase<V, Parent, 1, RowMemory> &lhs,             \
+                                   const MemoryExpression<E> &rhs)                       \
+    {                                                                                    \
+        evaluate(lhs, static_cast<Parent &>(lhs) op_ rhs.derived());                     \
+        return static_cast<Parent &>(lhs);                                               \
+    }
+Vc_MEMORY_EXPRESSION_ASSIGNMENT_(+);
+Vc_MEMORY_EXPRESSION_ASSIGNMENT_(-);
+Vc_MEMORY_EXPRESSION_ASSIGNMENT_(*);
+Vc_MEMORY_EXPRESSION_ASSIGNMENT_(/);
+#undef Vc_MEMORY_EXPRESSION_ASSIGNMENT_
+// }}}1
+}  // namespace Common
+
+using Common::MemoryExpression;
+using Common::evaluate;
+}  // namespace Vc
+
+#endif  // VC_COMMON_MEMORYEXPRESSION_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,97 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PARALLEL_H_
+#define VC_COMMON_PARALLEL_H_
+
+#include <cstddef>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile parallel.h <Vc/Vc>
+ *
+ * Execution policy for the multi-threaded overloads of the Vc algorithms (e.g.
+ * simd_for_each). Pass Vc::parallel or a customized policy as the first argument:
+ * \code
+ * Vc::simd_for_each(Vc::parallel, data.begin(), data.end(), [](auto &v) { v *= 2; });
+ * Vc::simd_for_each(Vc::parallel_policy(4), data.begin(), data.end(), f);
+ * \endcode
+ *
+ * The range is split into chunks of whole vectors which are distributed over a
+ * work-stealing thread pool in libVc. The function object is invoked concurrently from
+ * several threads and therefore must not modify shared state without synchronization.
+ */
+struct parallel_policy {
+    /**
+     * \param threads_ The maximum number of threads to use (including the calling
+     *                 thread). 0 uses all hardware threads.
+     * \param chunk_size_ The number of scalar elements per chunk (rounded to a multiple of
+     *                    the vector width). 0 chooses a default.
+     */
+    constexpr explicit parallel_policy(unsigned threads_ = 0, std::size_t chunk_size_ = 0)
+        : threads(threads_), chunk_size(chunk_size_)
+    {
+    }
+    unsigned threads;
+    std::size_t chunk_size;
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * The default parallel execution policy: all hardware threads, default chunk size.
+ */
+constexpr parallel_policy parallel{};
+
+namespace Detail
+{
+/**\internal
+ * Calls \p body(\p context, i) for all i in [0, \p chunks), distributed over at most \p
+ * threads threads (0: all hardware threads) of the libVc thread pool, including the
+ * calling thread. Each thread starts on a contiguous share of the chunk indexes and
+ * steals half of the remaining share of another thread when it runs out of work.
+ * Returns after all chunks were processed. The first exception thrown by \p body is
+ * rethrown; remaining chunks are skipped in that case.
+ *
+ * Nested calls (from inside \p body) execute serially on the calling thread.
+ */
+void parallel_for_chunks(std::size_t chunks, unsigned threads,
+                         void (*body)(void *context, std::size_t chunk), void *context);
+
+/**\internal
+ * Returns the number of threads parallel_for_chunks uses by default.
+ */
+unsigned parallel_thread_count();
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_COMMON_PARALLEL_H_
+
+// vim: foldmethod=marker
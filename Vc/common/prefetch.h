@@ -0,0 +1,194 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PREFETCH_H_
+#define VC_COMMON_PREFETCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#ifdef Vc_IMPL_SSE
+#include <xmmintrin.h>
+#endif
+#include "loadstoreflags.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Determines the prefetch distance (in bytes) for streaming loops. The distance is read
+ * from the \c VC_PREFETCH_DISTANCE environment variable if set; otherwise a short
+ * calibration (a few ms) times a streaming read loop with different distances. Defined
+ * in libVc.
+ */
+std::size_t calibrate_prefetch_distance();
+
+/**\internal
+ * Returns the calibrated prefetch distance. The calibration runs on the first call.
+ */
+Vc_INTRINSIC std::size_t prefetch_distance()
+{
+    static const std::size_t distance = calibrate_prefetch_distance();
+    return distance;
+}
+}  // namespace Detail
+
+// prefetch_policy {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile prefetch.h <Vc/Vc>
+ *
+ * Software prefetch policy for the Vc algorithms (e.g. simd_for_each). Pass Vc::prefetch
+ * or a customized policy as the first argument:
+ * \code
+ * Vc::simd_for_each(Vc::prefetch, data.begin(), data.end(), [](auto &v) { v *= 2; });
+ * Vc::simd_for_each(Vc::prefetch_policy(2048), data.begin(), data.end(), f);
+ * Vc::simd_for_each(Vc::Prefetch<4096>(), data.begin(), data.end(), f);
+ * \endcode
+ *
+ * The algorithm then issues one prefetch per cache line, \p distance bytes ahead of the
+ * data it is about to process, and a second one eight times further ahead into the
+ * outer cache levels. This only pays off if the data is not in cache already and the
+ * hardware prefetchers cannot keep up, e.g. for many concurrent streams.
+ */
+struct prefetch_policy {
+    /**
+     * \param distance_ The prefetch distance in bytes. 0 uses the distance determined by
+     *                  a runtime calibration (see Vc::PrefetchCalibrated).
+     */
+    constexpr explicit prefetch_policy(std::size_t distance_ = 0) : distance(distance_) {}
+
+    /**
+     * Uses the L1 stride of the load/store flag \p Prefetch (e.g. Vc::PrefetchDefault) as
+     * distance.
+     */
+    template <std::size_t L1, std::size_t L2, class ExclusiveOrShared>
+    constexpr prefetch_policy(
+        LoadStoreFlags::LoadStoreFlags<PrefetchFlag<L1, L2, ExclusiveOrShared>>)
+        : distance(L1 == LoadStoreFlags::CalibratedPrefetchStride ? 0 : L1)
+    {
+    }
+    ///\copydoc prefetch_policy(LoadStoreFlags::LoadStoreFlags<PrefetchFlag<L1, L2, ExclusiveOrShared>>)
+    template <std::size_t L1, std::size_t L2, class ExclusiveOrShared>
+    constexpr prefetch_policy(Prefetch<L1, L2, ExclusiveOrShared>)
+        : distance(L1 == LoadStoreFlags::CalibratedPrefetchStride ? 0 : L1)
+    {
+    }
+
+    std::size_t distance;
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * The default prefetch policy, using the calibrated distance.
+ */
+constexpr prefetch_policy prefetch{};
+
+namespace Common
+{
+// prefetchers {{{1
+/**\internal
+ * The prefetcher of the algorithms without a prefetch policy.
+ */
+struct NoPrefetcher {
+    Vc_INTRINSIC void issue(const void *, std::size_t) const {}
+};
+
+/**\internal
+ * Prefetches the cache lines \p distance and `8 * distance` bytes ahead of the chunks
+ * passed to issue. Chunks of less than a cache line only prefetch if they start a new
+ * cache line.
+ */
+class StreamPrefetcher
+{
+public:
+    explicit StreamPrefetcher(const prefetch_policy &policy)
+        : distance(policy.distance != 0 ? policy.distance : Vc::Detail::prefetch_distance())
+    {
+    }
+
+    /// \p bytes is the size of the chunk at \p addr
+    Vc_INTRINSIC void issue(const void *addr, std::size_t bytes) const
+    {
+#ifdef Vc_IMPL_SSE
+        if (reinterpret_cast<std::uintptr_t>(addr) % 64 < bytes) {
+            const char *p = static_cast<const char *>(addr);
+            _mm_prefetch(p + distance, _MM_HINT_T0);
+            _mm_prefetch(p + 8 * distance, _MM_HINT_T1);
+        }
+#else
+        (void)addr;
+        (void)bytes;
+#endif
+    }
+
+private:
+    std::size_t distance;
+};
+//}}}1
+}  // namespace Common
+
+// prefetch_gather {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile prefetch.h <Vc/Vc>
+ *
+ * Prefetches the entries `mem[indexes[i]]` for all \p i into the L1 cache.
+ *
+ * Gathers from large tables stall on every cache miss. Loops over indirect data can hide
+ * that latency by prefetching the gather of a later iteration:
+ * \code
+ * for (std::size_t i = 0; i < n; i += float_v::size()) {
+ *   Vc::prefetch_gather(table, int_v(idx + i + 8 * float_v::size(), Vc::Unaligned));
+ *   float_v x = table[int_v(idx + i, Vc::Unaligned)];
+ *   ...
+ * }
+ * \endcode
+ * A lead of 4 to 16 vectors usually works well; the prefetch instructions do not fault
+ * on invalid addresses.
+ */
+template <class T, class IT>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<IT>::value, void> prefetch_gather(
+    const T *mem, const IT &indexes)
+{
+#ifdef Vc_IMPL_SSE
+    for (std::size_t i = 0; i < IT::Size; ++i) {
+        _mm_prefetch(reinterpret_cast<const char *>(mem + indexes[i]), _MM_HINT_T0);
+    }
+#else
+    (void)mem;
+    (void)indexes;
+#endif
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_PREFETCH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,433 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <cstdint>
+#include "../traits/type_traits.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * A vectorized xoshiro128** pseudo-random number generator.
+ *
+ * Every entry of `uint_v` is an independent xoshiro128** generator with a period of
+ * \f$2^{128}-1\f$. The lanes of one engine start \f$2^{64}\f$ steps apart from each
+ * other. The complete state is held in four `uint_v` objects, i.e. in registers, so
+ * that (contrary to Vector::Random) no memory is shared between engines. Give every
+ * thread its own engine and use the \p stream constructor argument (or long_jump) to
+ * obtain non-overlapping sequences:
+ * \code
+ * #pragma omp parallel
+ * {
+ *   Vc::Xoshiro128 engine(seed, omp_get_thread_num());
+ *   for (...) {
+ *     float_v x = Vc::normal<float_v>(engine);
+ *     ...
+ *   }
+ * }
+ * \endcode
+ *
+ * Use the free functions uniform, normal, and exponential to obtain values of any
+ * Vector or SimdArray type.
+ */
+class Xoshiro128
+{
+public:
+    /// The type returned from operator().
+    using result_type = uint_v;
+
+    /**
+     * Initializes the engine from \p seed, using the splitmix64 generator to expand the
+     * seed into the 128-bit state of the first lane. The state is then advanced by \p
+     * stream times \f$2^{96}\f$ steps (see long_jump) and the remaining lanes by
+     * \f$2^{64}\f$ steps each.
+     */
+    explicit Xoshiro128(std::uint64_t seed = 0x853c49e6748fea9bull,
+                        std::uint64_t stream = 0)
+    {
+        std::uint32_t lane[4];
+        for (int i = 0; i < 4; i += 2) {
+            const std::uint64_t x = splitmix64(seed);
+            lane[i] = static_cast<std::uint32_t>(x);
+            lane[i + 1] = static_cast<std::uint32_t>(x >> 32);
+        }
+        if ((lane[0] | lane[1] | lane[2] | lane[3]) == 0) {
+            lane[0] = 1;  // the all-zero state is a fixed point
+        }
+        for (; stream > 0; --stream) {
+            jump(lane, longJumpPolynomial());
+        }
+        alignas(uint_v::MemoryAlignment) std::uint32_t mem[4][uint_v::Size];
+        for (std::size_t i = 0; i < uint_v::Size; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                mem[j][i] = lane[j];
+            }
+            jump(lane, jumpPolynomial());
+        }
+        for (int j = 0; j < 4; ++j) {
+            s[j].load(&mem[j][0], Vc::Aligned);
+        }
+    }
+
+    /// Returns the next 32 random bits of every lane.
+    Vc_ALWAYS_INLINE uint_v operator()()
+    {
+        const uint_v result = rotl(s[1] * 5u, 7) * 9u;
+        const uint_v t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    /// Advances the engine by \p n steps.
+    void discard(std::uint64_t n)
+    {
+        for (; n > 0; --n) {
+            operator()();
+        }
+    }
+
+    /**
+     * Advances every lane by \f$2^{96}\f$ steps. This yields \f$2^{32}\f$
+     * non-overlapping engines, e.g. one per thread.
+     */
+    void long_jump()
+    {
+        const std::uint32_t *poly = longJumpPolynomial();
+        uint_v r[4] = {uint_v::Zero(), uint_v::Zero(), uint_v::Zero(), uint_v::Zero()};
+        for (int i = 0; i < 4; ++i) {
+            for (int b = 0; b < 32; ++b) {
+                if (poly[i] & (1u << b)) {
+                    for (int j = 0; j < 4; ++j) {
+                        r[j] ^= s[j];
+                    }
+                }
+                operator()();
+            }
+        }
+        for (int j = 0; j < 4; ++j) {
+            s[j] = r[j];
+        }
+    }
+
+private:
+    static Vc_ALWAYS_INLINE uint_v rotl(const uint_v &x, int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    static std::uint64_t splitmix64(std::uint64_t &x)
+    {
+        std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    static const std::uint32_t *jumpPolynomial()
+    {
+        static const std::uint32_t poly[4] = {0x8764000bu, 0xf542d2d3u, 0x6fa035c3u,
+                                              0x77f2db5bu};
+        return poly;
+    }
+    static const std::uint32_t *longJumpPolynomial()
+    {
+        static const std::uint32_t poly[4] = {0xb523952eu, 0x0b6f099fu, 0xccf5a0efu,
+                                              0x1c580662u};
+        return poly;
+    }
+
+    // scalar jump for a single lane, used for initialization
+    static void jump(std::uint32_t *lane, const std::uint32_t *poly)
+    {
+        std::uint32_t r[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4; ++i) {
+            for (int b = 0; b < 32; ++b) {
+                if (poly[i] & (1u << b)) {
+                    for (int j = 0; j < 4; ++j) {
+                        r[j] ^= lane[j];
+                    }
+                }
+                const std::uint32_t t = lane[1] << 9;
+                lane[2] ^= lane[0];
+                lane[3] ^= lane[1];
+                lane[1] ^= lane[2];
+                lane[0] ^= lane[3];
+                lane[2] ^= t;
+                lane[3] = (lane[3] << 11) | (lane[3] >> 21);
+            }
+        }
+        for (int j = 0; j < 4; ++j) {
+            lane[j] = r[j];
+        }
+    }
+
+    uint_v s[4];
+};
+
+namespace Common
+{
+/**\internal
+ * Writes at least \p Count random 32-bit words to \p mem.
+ */
+template <std::size_t Count>
+Vc_ALWAYS_INLINE void random_words(Xoshiro128 &engine, std::uint32_t *mem)
+{
+    for (std::size_t i = 0; i < Count; i += uint_v::Size) {
+        engine().store(mem + i, Vc::Aligned);
+    }
+}
+
+/**\internal
+ * Returns \p N random 32-bit words.
+ */
+template <std::size_t N>
+Vc_ALWAYS_INLINE SimdArray<unsigned int, N> random_words(Xoshiro128 &engine,
+                                                         std::true_type)
+{
+    return simd_cast<SimdArray<unsigned int, N>>(engine());
+}
+template <std::size_t N>
+Vc_ALWAYS_INLINE SimdArray<unsigned int, N> random_words(Xoshiro128 &engine,
+                                                         std::false_type)
+{
+    alignas(uint_v::MemoryAlignment)
+        std::uint32_t mem[(N + uint_v::Size - 1) / uint_v::Size * uint_v::Size];
+    random_words<N>(engine, mem);
+    return SimdArray<unsigned int, N>(&mem[0], Vc::Unaligned);
+}
+template <std::size_t N>
+Vc_ALWAYS_INLINE SimdArray<unsigned int, N> random_words(Xoshiro128 &engine)
+{
+    return random_words<N>(engine, std::integral_constant<bool, N == uint_v::Size>());
+}
+
+/**\internal
+ * Returns \p N random 64-bit words, each built from two 32-bit words.
+ */
+template <std::size_t N>
+Vc_ALWAYS_INLINE SimdArray<unsigned long long, N> random_words64(Xoshiro128 &engine)
+{
+    using U = SimdArray<unsigned long long, N>;
+    const U hi = simd_cast<U>(random_words<N>(engine));
+    const U lo = simd_cast<U>(random_words<N>(engine));
+    return (hi << 32) | lo;
+}
+
+/**\internal
+ * Returns uniformly distributed values in [0, 1) with the full mantissa precision of
+ * float.
+ */
+template <class V>
+Vc_ALWAYS_INLINE V uniform01(Xoshiro128 &engine, float)
+{
+    constexpr std::size_t N = V::Size;
+    const SimdArray<int, N> x =
+        simd_cast<SimdArray<int, N>>(random_words<N>(engine) >> 8);
+    return simd_cast<V>(x) * (1.f / (1 << 24));
+}
+
+/**\internal
+ * Returns uniformly distributed values in [0, 1) with the full mantissa precision of
+ * double. Every value consumes two random words.
+ */
+template <class V>
+Vc_ALWAYS_INLINE V uniform01(Xoshiro128 &engine, double)
+{
+    constexpr std::size_t N = V::Size;
+    alignas(uint_v::MemoryAlignment)
+        std::uint32_t mem[(2 * N + uint_v::Size - 1) / uint_v::Size * uint_v::Size];
+    random_words<2 * N>(engine, mem);
+    const SimdArray<unsigned int, N> hi(&mem[0], Vc::Unaligned);
+    const SimdArray<unsigned int, N> lo(&mem[N], Vc::Unaligned);
+    const V hi27 = simd_cast<V>(simd_cast<SimdArray<int, N>>(hi >> 5));
+    const V lo26 = simd_cast<V>(simd_cast<SimdArray<int, N>>(lo >> 6));
+    const V x = hi27 * V(67108864.) + lo26;
+    return x * V(1. / 9007199254740992.);
+}
+
+template <class V>
+using enable_if_floating_point =
+    enable_if<Traits::is_simd_vector<V>::value &&
+                  std::is_floating_point<typename V::EntryType>::value,
+              V>;
+template <class V>
+using enable_if_integral = enable_if<Traits::is_simd_vector<V>::value &&
+                                         std::is_integral<typename V::EntryType>::value,
+                                     V>;
+template <class V>
+using is_64bit_integral =
+    std::integral_constant<bool, sizeof(typename V::EntryType) == 8>;
+
+/**\internal
+ * Returns random bits for every lane of \p V.
+ */
+template <class V> Vc_ALWAYS_INLINE V uniform_bits(Xoshiro128 &engine, std::false_type)
+{
+    return simd_cast<V>(random_words<V::Size>(engine));
+}
+template <class V> Vc_ALWAYS_INLINE V uniform_bits(Xoshiro128 &engine, std::true_type)
+{
+    return simd_cast<V>(random_words64<V::Size>(engine));
+}
+
+/**\internal
+ * Returns values uniformly distributed in [\p a, \p b]. For up to 32-bit entries the
+ * offset is computed from a double in [0, 1), which has enough precision that the bias
+ * is negligible.
+ */
+template <class V, class T>
+Vc_ALWAYS_INLINE V uniform_int(Xoshiro128 &engine, T a, T b, std::false_type)
+{
+    using D = SimdArray<double, V::Size>;
+    using U = SimdArray<unsigned int, V::Size>;
+    const double range = static_cast<double>(b) - static_cast<double>(a) + 1.;
+    // offset is in [0, 2^32), shift it into the range of int for the conversion and
+    // undo the shift with modular unsigned arithmetic
+    const D offset = floor(uniform01<D>(engine, double()) * range) - 2147483648.;
+    const U x = simd_cast<U>(simd_cast<SimdArray<int, V::Size>>(offset)) +
+                (0x80000000u + static_cast<unsigned int>(a));
+    return simd_cast<V>(x);
+}
+/**\internal
+ * 64-bit ranges exceed the precision of double. Instead, random words are masked to the
+ * bit width of \p b - \p a and the lanes outside the range are drawn again (fewer than
+ * two rounds on average).
+ */
+template <class V, class T>
+Vc_ALWAYS_INLINE V uniform_int(Xoshiro128 &engine, T a, T b, std::true_type)
+{
+    using U = SimdArray<unsigned long long, V::Size>;
+    const unsigned long long range =
+        static_cast<unsigned long long>(b) - static_cast<unsigned long long>(a);
+    unsigned long long bits = range;
+    for (int shift = 1; shift < 64; shift *= 2) {
+        bits |= bits >> shift;
+    }
+    const U mask = bits;
+    const U last = range;
+    U x = random_words64<V::Size>(engine) & mask;
+    for (auto reject = x > last; any_of(reject); reject = x > last) {
+        x = iif(reject, U(random_words64<V::Size>(engine) & mask), x);
+    }
+    return simd_cast<V>(x + U(static_cast<unsigned long long>(a)));
+}
+}  // namespace Common
+
+/**
+ * \name Random Number Distributions
+ * \ingroup Utilities
+ * \headerfile random <Vc/random>
+ *
+ * Draw vectors of random numbers from a Xoshiro128 engine. \p V can be any Vector or
+ * SimdArray type.
+ */
+//@{
+/**
+ * Returns values uniformly distributed in [0, 1).
+ */
+template <class V>
+Vc_ALWAYS_INLINE Common::enable_if_floating_point<V> uniform(Xoshiro128 &engine)
+{
+    return Common::uniform01<V>(engine, typename V::EntryType());
+}
+
+/**
+ * Returns values uniformly distributed in [\p a, \p b).
+ */
+template <class V>
+Vc_ALWAYS_INLINE Common::enable_if_floating_point<V> uniform(
+    Xoshiro128 &engine, typename V::EntryType a, typename V::EntryType b)
+{
+    return a + (b - a) * uniform<V>(engine);
+}
+
+/**
+ * Returns values with uniformly distributed bits, i.e. uniformly distributed over the
+ * complete range of `V::EntryType`.
+ */
+template <class V>
+Vc_ALWAYS_INLINE Common::enable_if_integral<V> uniform(Xoshiro128 &engine)
+{
+    return Common::uniform_bits<V>(engine, Common::is_64bit_integral<V>());
+}
+
+/**
+ * Returns values uniformly distributed in the closed interval [\p a, \p b].
+ */
+template <class V>
+Vc_ALWAYS_INLINE Common::enable_if_integral<V> uniform(Xoshiro128 &engine,
+                                                       typename V::EntryType a,
+                                                       typename V::EntryType b)
+{
+    return Common::uniform_int<V>(engine, a, b, Common::is_64bit_integral<V>());
+}
+
+/**
+ * Returns normally distributed values with the given \p mean and standard deviation \p
+ * sigma, using the Box-Muller transform.
+ */
+template <class V>
+Vc_ALWAYS_INLINE Common::enable_if_floating_point<V> normal(
+    Xoshiro128 &engine, typename V::EntryType mean = 0, typename V::EntryType sigma = 1)
+{
+    using T = typename V::EntryType;
+    using D = SimdArray<double, V::Size>;
+    // (0, 1] with 53 bits: log(u1) is finite and the tail reaches 8.57 sigma (a float
+    // u1 would cut it off at 5.77 sigma)
+    const D u1 = 1. - uniform<D>(engine);
+    const V u2 = uniform<V>(engine);
+    const V r = simd_cast<V>(sqrt(-2. * log(u1)));
+    return mean + sigma * r * cos(u2 * T(6.283185307179586476925286766559));
+}
+
+/**
+ * Returns exponentially distributed values with rate parameter \p lambda.
+ */
+template <class V>
+Vc_ALWAYS_INLINE Common::enable_if_floating_point<V> exponential(
+    Xoshiro128 &engine, typename V::EntryType lambda = 1)
+{
+    using T = typename V::EntryType;
+    return -log(T(1) - uniform<V>(engine)) / lambda;
+}
+//@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
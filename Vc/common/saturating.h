@@ -0,0 +1,364 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SATURATING_H_
+#define VC_COMMON_SATURATING_H_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// saturate {{{1
+/**\internal
+ * Clamps \p x to the value range of \p T.
+ */
+template <class T> Vc_INTRINSIC T saturate(std::int64_t x)
+{
+    return x < std::int64_t(std::numeric_limits<T>::min())
+               ? std::numeric_limits<T>::min()
+               : x > std::int64_t(std::numeric_limits<T>::max())
+                     ? std::numeric_limits<T>::max()
+                     : static_cast<T>(x);
+}
+
+/**\internal
+ * Integral entry types of at most 32 bits, for which the saturating operations are
+ * defined.
+ */
+template <class T>
+using is_saturating_type =
+    std::integral_constant<bool, std::is_integral<T>::value &&
+                                     !std::is_same<T, bool>::value && sizeof(T) <= 4>;
+}  // namespace Common
+
+// adds / subs / avg for scalars {{{1
+/**
+ * \ingroup Utilities
+ * Returns \p a + \p b, clamped to the value range of \p T instead of wrapping around.
+ */
+template <class T>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value, T> adds(T a, T b)
+{
+    return Common::saturate<T>(std::int64_t(a) + std::int64_t(b));
+}
+/**
+ * \ingroup Utilities
+ * Returns \p a - \p b, clamped to the value range of \p T instead of wrapping around.
+ */
+template <class T>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value, T> subs(T a, T b)
+{
+    return Common::saturate<T>(std::int64_t(a) - std::int64_t(b));
+}
+/**
+ * \ingroup Utilities
+ * Returns (\p a + \p b + 1) / 2 without intermediate overflow, for unsigned \p T.
+ */
+template <class T>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value && std::is_unsigned<T>::value,
+                       T>
+avg(T a, T b)
+{
+    return static_cast<T>((std::uint64_t(a) + std::uint64_t(b) + 1) >> 1);
+}
+
+// adds / subs / avg for Vector {{{1
+/**
+ * \ingroup Utilities
+ * Saturating addition of every lane. The 8- and 16-bit integer vectors use a single
+ * instruction (`paddsb`, `paddusb`, `paddsw`, `paddusw`); all other integer vectors add
+ * lane by lane.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value, Vector<T, Abi>> adds(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Vector<T, Abi>::generate([&](int i) { return adds(T(a[i]), T(b[i])); });
+}
+/**
+ * \ingroup Utilities
+ * Saturating subtraction of every lane.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value, Vector<T, Abi>> subs(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Vector<T, Abi>::generate([&](int i) { return subs(T(a[i]), T(b[i])); });
+}
+/**
+ * \ingroup Utilities
+ * The rounding average (a + b + 1) / 2 of every lane of unsigned integer vectors.
+ */
+template <class T, class Abi>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value && std::is_unsigned<T>::value,
+                       Vector<T, Abi>>
+avg(const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Vector<T, Abi>::generate([&](int i) { return avg(T(a[i]), T(b[i])); });
+}
+
+#ifdef Vc_IMPL_SSE2
+#define Vc_SATURATING_(fun_, T_, intrin_)                                                \
+    Vc_INTRINSIC SSE::Vector<T_> fun_(const SSE::Vector<T_> &a,                          \
+                                      const SSE::Vector<T_> &b)                          \
+    {                                                                                    \
+        return intrin_(a.data(), b.data());                                              \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_SATURATING_(adds,  schar, _mm_adds_epi8);
+Vc_SATURATING_(adds,  uchar, _mm_adds_epu8);
+Vc_SATURATING_(adds,  short, _mm_adds_epi16);
+Vc_SATURATING_(adds, ushort, _mm_adds_epu16);
+Vc_SATURATING_(subs,  schar, _mm_subs_epi8);
+Vc_SATURATING_(subs,  uchar, _mm_subs_epu8);
+Vc_SATURATING_(subs,  short, _mm_subs_epi16);
+Vc_SATURATING_(subs, ushort, _mm_subs_epu16);
+Vc_SATURATING_( avg,  uchar, _mm_avg_epu8);
+Vc_SATURATING_( avg, ushort, _mm_avg_epu16);
+#undef Vc_SATURATING_
+#endif  // Vc_IMPL_SSE2
+
+#ifdef Vc_IMPL_AVX2
+#define Vc_SATURATING_(fun_, T_, intrin_)                                                \
+    Vc_INTRINSIC AVX2::Vector<T_> fun_(const AVX2::Vector<T_> &a,                        \
+                                       const AVX2::Vector<T_> &b)                        \
+    {                                                                                    \
+        return intrin_(a.data(), b.data());                                              \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_SATURATING_(adds,  schar, _mm256_adds_epi8);
+Vc_SATURATING_(adds,  uchar, _mm256_adds_epu8);
+Vc_SATURATING_(adds,  short, _mm256_adds_epi16);
+Vc_SATURATING_(adds, ushort, _mm256_adds_epu16);
+Vc_SATURATING_(subs,  schar, _mm256_subs_epi8);
+Vc_SATURATING_(subs,  uchar, _mm256_subs_epu8);
+Vc_SATURATING_(subs,  short, _mm256_subs_epi16);
+Vc_SATURATING_(subs, ushort, _mm256_subs_epu16);
+Vc_SATURATING_( avg,  uchar, _mm256_avg_epu8);
+Vc_SATURATING_( avg, ushort, _mm256_avg_epu16);
+#undef Vc_SATURATING_
+#endif  // Vc_IMPL_AVX2
+
+// maddubs / sad for Vector {{{1
+#ifdef Vc_IMPL_SSE2
+/**
+ * \ingroup Utilities
+ * Multiplies the unsigned bytes of \p a with the signed bytes of \p b and adds adjacent
+ * pairs of the 16-bit products with signed saturation: lane i of the result is
+ * `a[2i] * b[2i] + a[2i + 1] * b[2i + 1]`. This is the inner step of 8-bit dot products
+ * and convolutions (`pmaddubsw`).
+ */
+Vc_INTRINSIC SSE::Vector<short> maddubs(const SSE::Vector<uchar> &a,
+                                        const SSE::Vector<schar> &b)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_maddubs_epi16(a.data(), b.data());
+#else
+    // every product fits into 16 bits; only the sum needs to saturate
+    const __m128i aEven = _mm_and_si128(a.data(), _mm_set1_epi16(0xff));
+    const __m128i aOdd = _mm_srli_epi16(a.data(), 8);
+    const __m128i bEven = _mm_srai_epi16(_mm_slli_epi16(b.data(), 8), 8);
+    const __m128i bOdd = _mm_srai_epi16(b.data(), 8);
+    return _mm_adds_epi16(_mm_mullo_epi16(aEven, bEven), _mm_mullo_epi16(aOdd, bOdd));
+#endif
+}
+/**
+ * \ingroup Utilities
+ * Sums the absolute differences of \p a and \p b over each group of 8 adjacent lanes
+ * (`psadbw`): lane i of the result is the sum of `|a[j] - b[j]|` for j in [8i, 8i + 8).
+ */
+Vc_INTRINSIC SSE::Vector<ullong> sad(const SSE::Vector<uchar> &a,
+                                     const SSE::Vector<uchar> &b)
+{
+    return _mm_sad_epu8(a.data(), b.data());
+}
+#endif  // Vc_IMPL_SSE2
+
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC AVX2::Vector<short> maddubs(const AVX2::Vector<uchar> &a,
+                                         const AVX2::Vector<schar> &b)
+{
+    return _mm256_maddubs_epi16(a.data(), b.data());
+}
+Vc_INTRINSIC AVX2::Vector<ullong> sad(const AVX2::Vector<uchar> &a,
+                                      const AVX2::Vector<uchar> &b)
+{
+    return _mm256_sad_epu8(a.data(), b.data());
+}
+#endif  // Vc_IMPL_AVX2
+
+// SimdArray {{{1
+namespace Common
+{
+/**\internal
+ * Applies the saturating operations to the native chunks of a SimdArray.
+ */
+struct AddSaturated {
+    template <class V> Vc_INTRINSIC void operator()(V &r, const V &a, const V &b)
+    {
+        r = adds(a, b);
+    }
+};
+struct SubtractSaturated {
+    template <class V> Vc_INTRINSIC void operator()(V &r, const V &a, const V &b)
+    {
+        r = subs(a, b);
+    }
+};
+struct Average {
+    template <class V> Vc_INTRINSIC void operator()(V &r, const V &a, const V &b)
+    {
+        r = avg(a, b);
+    }
+};
+
+/**\internal
+ * Whether the lower halves of the SimdArrays \p A and \p R cover the same input lanes of
+ * an operation that reduces A::size() / R::size() adjacent lanes of \p A into one lane of
+ * \p R.
+ */
+template <class R, class A, bool = R::is_atomic || A::is_atomic>
+struct halves_match : std::false_type {
+};
+template <class R, class A>
+struct halves_match<R, A, false>
+    : std::integral_constant<bool, R::storage_type0::size() * (A::size() / R::size()) ==
+                                       A::storage_type0::size()> {
+};
+
+/**\internal
+ * Evaluates the reducing operation \p op on the native vectors of \p a and \p b if the
+ * SimdArrays wrap a single native vector, on both halves if they split alike, and lane
+ * by lane otherwise.
+ */
+template <class R, class Op, class A, class B>
+Vc_INTRINSIC enable_if<A::is_atomic, R> reduce_adjacent(Op op, const A &a, const B &b)
+{
+    return simd_cast<R>(op(internal_data(a), internal_data(b)));
+}
+template <class R, class Op, class A, class B>
+Vc_INTRINSIC enable_if<!A::is_atomic && halves_match<R, A>::value, R> reduce_adjacent(
+    Op op, const A &a, const B &b)
+{
+    using R0 = typename R::storage_type0;
+    using R1 = typename R::storage_type1;
+    return R(reduce_adjacent<R0>(op, internal_data0(a), internal_data0(b)),
+             reduce_adjacent<R1>(op, internal_data1(a), internal_data1(b)));
+}
+template <class R, class Op, class A, class B>
+Vc_INTRINSIC enable_if<!A::is_atomic && !halves_match<R, A>::value, R> reduce_adjacent(
+    Op op, const A &a, const B &b)
+{
+    return R::generate([&](std::size_t i) { return op.lane(a, b, i); });
+}
+
+struct MultiplyAddAdjacent {
+    template <class A, class B>
+    Vc_INTRINSIC auto operator()(const A &a, const B &b) const -> decltype(maddubs(a, b))
+    {
+        return maddubs(a, b);
+    }
+    template <class A, class B>
+    Vc_INTRINSIC short lane(const A &a, const B &b, std::size_t i) const
+    {
+        return saturate<short>(int(a[2 * i]) * int(b[2 * i]) +
+                               int(a[2 * i + 1]) * int(b[2 * i + 1]));
+    }
+};
+struct SumOfAbsoluteDifferences {
+    template <class A, class B>
+    Vc_INTRINSIC auto operator()(const A &a, const B &b) const -> decltype(sad(a, b))
+    {
+        return sad(a, b);
+    }
+    template <class A, class B>
+    Vc_INTRINSIC ullong lane(const A &a, const B &b, std::size_t i) const
+    {
+        ullong sum = 0;
+        for (std::size_t j = 8 * i; j < 8 * i + 8; ++j) {
+            sum += a[j] < b[j] ? b[j] - a[j] : a[j] - b[j];
+        }
+        return sum;
+    }
+};
+}  // namespace Common
+
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value, fixed_size_simd<T, N>> adds(
+    const SimdArray<T, N, V, M> &a, const SimdArray<T, N, V, M> &b)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::AddSaturated(), a, b);
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value, fixed_size_simd<T, N>> subs(
+    const SimdArray<T, N, V, M> &a, const SimdArray<T, N, V, M> &b)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::SubtractSaturated(), a, b);
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC enable_if<Common::is_saturating_type<T>::value && std::is_unsigned<T>::value,
+                       fixed_size_simd<T, N>>
+avg(const SimdArray<T, N, V, M> &a, const SimdArray<T, N, V, M> &b)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::Average(), a, b);
+}
+
+/**
+ * \ingroup Utilities
+ * The `pmaddubsw` operation on SimdArrays of an even number of bytes.
+ */
+template <std::size_t N, class V, std::size_t M, class W, std::size_t L>
+Vc_INTRINSIC fixed_size_simd<short, N / 2> maddubs(const SimdArray<uchar, N, V, M> &a,
+                                                   const SimdArray<schar, N, W, L> &b)
+{
+    static_assert(N % 2 == 0, "Vc::maddubs requires an even number of lanes");
+    return Common::reduce_adjacent<fixed_size_simd<short, N / 2>>(
+        Common::MultiplyAddAdjacent(), a, b);
+}
+/**
+ * \ingroup Utilities
+ * The `psadbw` operation on SimdArrays of a multiple of 8 bytes.
+ */
+template <std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC fixed_size_simd<ullong, N / 8> sad(const SimdArray<uchar, N, V, M> &a,
+                                                const SimdArray<uchar, N, V, M> &b)
+{
+    static_assert(N % 8 == 0, "Vc::sad requires a multiple of 8 lanes");
+    return Common::reduce_adjacent<fixed_size_simd<ullong, N / 8>>(
+        Common::SumOfAbsoluteDifferences(), a, b);
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_SATURATING_H_
+
+// vim: foldmethod=marker
@@ -72,7 +72,7 @@ Vc_ALWAYS_INLINE void executeScatter(BitScanLoopT,
                                     const IT &indexes,
                                     typename V::MaskArgument mask)
 {
-    size_t bits = mask.toInt();
+    size_t bits = static_cast<unsigned int>(mask.toInt());
     while (Vc_IS_LIKELY(bits > 0)) {
         size_t i, j;
         asm("bsf %[bits],%[i]\n\t"
@@ -0,0 +1,394 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SIMD_MATRIX_H_
+#define VC_COMMON_SIMD_MATRIX_H_
+
+#include <cstddef>
+#include <type_traits>
+#include "linalg.h"
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// simd_matrix {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile simd_matrix.h <Vc/linalg>
+ *
+ * An \p R × \p C matrix of `simdize<T, N>` entries: every lane holds an independent
+ * problem, e.g. the covariance matrix of one track. Arithmetic on simd_matrix thus solves
+ * `size()` problems at once, with code that reads like scalar linear algebra:
+ *
+ * \code
+ * using Mat5 = Vc::simd_matrix<float, 5>;
+ * Mat5 F, C, Q;
+ * // ... load size() tracks
+ * C = Vc::similarity_transform(F, C) + Q;        // F · C · Fᵀ + Q for every track
+ * const auto chol = Vc::cholesky(C);
+ * const Mat5 W = chol.inverse();
+ * \endcode
+ *
+ * \tparam T The scalar entry type, `float` or `double`.
+ * \tparam R The number of rows.
+ * \tparam C The number of columns.
+ * \tparam N The number of problems, i.e. lanes. The default 0 selects the native vector
+ *           width, `Vector<T>::size()`; other values use a SimdArray.
+ */
+template <class T, std::size_t R, std::size_t C = R, std::size_t N = 0> class simd_matrix
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "simd_matrix requires a floating-point entry type");
+
+public:
+    /// The type of every entry: a Vc::Vector or SimdArray with one lane per problem.
+    using value_type = simdize<T, N>;
+    using mask_type = typename value_type::mask_type;
+    using entry_type = T;
+    static constexpr std::size_t Rows = R;
+    static constexpr std::size_t Cols = C;
+
+    /// Returns the number of independent problems.
+    static constexpr std::size_t size() { return value_type::size(); }
+
+    /// The entries are uninitialized.
+    simd_matrix() = default;
+
+    /// Returns the matrix with all entries zero.
+    static simd_matrix zero()
+    {
+        simd_matrix m;
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                m(i, j) = value_type(T(0));
+            }
+        }
+        return m;
+    }
+
+    /// Returns the matrix with ones on the diagonal and zeros elsewhere.
+    static simd_matrix identity()
+    {
+        simd_matrix m = zero();
+        for (std::size_t i = 0; i < R && i < C; ++i) {
+            m(i, i) = value_type(T(1));
+        }
+        return m;
+    }
+
+    value_type &operator()(std::size_t i, std::size_t j) { return m_data[i][j]; }
+    const value_type &operator()(std::size_t i, std::size_t j) const { return m_data[i][j]; }
+
+    /**
+     * Loads the size() consecutive row-major scalar R × C matrices at \p mem, one per lane.
+     */
+    void load(const T *mem)
+    {
+        const auto offsets = lane_offsets();
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                m_data[i][j].gather(mem + i * C + j, offsets);
+            }
+        }
+    }
+
+    /**
+     * Stores lane `l` to the row-major scalar R × C matrix at `mem + l · R · C`.
+     */
+    void store(T *mem) const
+    {
+        const auto offsets = lane_offsets();
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                m_data[i][j].scatter(mem + i * C + j, offsets);
+            }
+        }
+    }
+
+    simd_matrix &operator+=(const simd_matrix &rhs)
+    {
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                m_data[i][j] += rhs(i, j);
+            }
+        }
+        return *this;
+    }
+
+    simd_matrix &operator-=(const simd_matrix &rhs)
+    {
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                m_data[i][j] -= rhs(i, j);
+            }
+        }
+        return *this;
+    }
+
+    simd_matrix &operator*=(const value_type &factor)
+    {
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                m_data[i][j] *= factor;
+            }
+        }
+        return *this;
+    }
+
+private:
+    static typename value_type::IndexType lane_offsets()
+    {
+        return typename value_type::IndexType([](int l) { return l * int(R * C); });
+    }
+
+    value_type m_data[R][C];
+};
+
+// arithmetic {{{1
+/// \relates simd_matrix
+template <class T, std::size_t R, std::size_t C, std::size_t N>
+inline simd_matrix<T, R, C, N> operator+(simd_matrix<T, R, C, N> a,
+                                         const simd_matrix<T, R, C, N> &b)
+{
+    return a += b;
+}
+
+/// \relates simd_matrix
+template <class T, std::size_t R, std::size_t C, std::size_t N>
+inline simd_matrix<T, R, C, N> operator-(simd_matrix<T, R, C, N> a,
+                                         const simd_matrix<T, R, C, N> &b)
+{
+    return a -= b;
+}
+
+/// \relates simd_matrix
+template <class T, std::size_t R, std::size_t K, std::size_t C, std::size_t N>
+inline simd_matrix<T, R, C, N> operator*(const simd_matrix<T, R, K, N> &a,
+                                         const simd_matrix<T, K, C, N> &b)
+{
+    simd_matrix<T, R, C, N> r;
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < C; ++j) {
+            simdize<T, N> sum = a(i, 0) * b(0, j);
+            for (std::size_t k = 1; k < K; ++k) {
+                sum = Common::multiply_add(a(i, k), b(k, j), sum);
+            }
+            r(i, j) = sum;
+        }
+    }
+    return r;
+}
+
+/// \relates simd_matrix
+template <class T, std::size_t R, std::size_t C, std::size_t N>
+inline simd_matrix<T, C, R, N> transposed(const simd_matrix<T, R, C, N> &a)
+{
+    simd_matrix<T, C, R, N> r;
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < C; ++j) {
+            r(j, i) = a(i, j);
+        }
+    }
+    return r;
+}
+
+/**
+ * \relates simd_matrix
+ *
+ * Returns `a · c · aᵀ` for the symmetric matrix \p c, e.g. the propagation of a
+ * covariance matrix. Only the lower triangle is computed; the result is exactly
+ * symmetric.
+ */
+template <class T, std::size_t R, std::size_t C, std::size_t N>
+inline simd_matrix<T, R, R, N> similarity_transform(const simd_matrix<T, R, C, N> &a,
+                                                    const simd_matrix<T, C, C, N> &c)
+{
+    const simd_matrix<T, R, C, N> ac = a * c;
+    simd_matrix<T, R, R, N> r;
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            simdize<T, N> sum = ac(i, 0) * a(j, 0);
+            for (std::size_t k = 1; k < C; ++k) {
+                sum = Common::multiply_add(ac(i, k), a(j, k), sum);
+            }
+            r(i, j) = sum;
+            r(j, i) = sum;
+        }
+    }
+    return r;
+}
+
+// simd_cholesky {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile simd_matrix.h <Vc/linalg>
+ *
+ * The Cholesky decomposition `A = L · Lᵀ` of a symmetric positive-definite simd_matrix,
+ * computed for all lanes at once. The reciprocals of the diagonal of L are kept, so that
+ * solve() and inverse() need no further divisions.
+ *
+ * Lanes whose matrix is not positive definite are reported by positive_definite(); their
+ * results are unspecified (NaN or infinite), the other lanes are unaffected.
+ */
+template <class T, std::size_t D, std::size_t N = 0> class simd_cholesky
+{
+public:
+    using matrix_type = simd_matrix<T, D, D, N>;
+    using value_type = typename matrix_type::value_type;
+    using mask_type = typename matrix_type::mask_type;
+
+    /// Decomposes \p a. Only the lower triangle of \p a is read.
+    explicit simd_cholesky(const matrix_type &a)
+    {
+        m_ok = mask_type(true);
+        for (std::size_t j = 0; j < D; ++j) {
+            value_type s = a(j, j);
+            for (std::size_t k = 0; k < j; ++k) {
+                s -= m_l(j, k) * m_l(j, k);
+            }
+            m_ok &= s > value_type(T(0));
+            const value_type d = sqrt(s);
+            m_l(j, j) = d;
+            m_invDiag[j] = value_type(T(1)) / d;
+            for (std::size_t i = j + 1; i < D; ++i) {
+                value_type t = a(i, j);
+                for (std::size_t k = 0; k < j; ++k) {
+                    t -= m_l(i, k) * m_l(j, k);
+                }
+                m_l(i, j) = t * m_invDiag[j];
+                m_l(j, i) = value_type(T(0));
+            }
+        }
+    }
+
+    /// Returns the lower-triangular factor L.
+    const matrix_type &matrix_l() const { return m_l; }
+
+    /// Returns the mask of the lanes whose matrix is positive definite.
+    mask_type positive_definite() const { return m_ok; }
+
+    /// Returns x with `A · x = b`, by forward and back substitution.
+    template <std::size_t K>
+    simd_matrix<T, D, K, N> solve(const simd_matrix<T, D, K, N> &b) const
+    {
+        simd_matrix<T, D, K, N> x;
+        for (std::size_t c = 0; c < K; ++c) {
+            // L · y = b
+            for (std::size_t i = 0; i < D; ++i) {
+                value_type t = b(i, c);
+                for (std::size_t k = 0; k < i; ++k) {
+                    t -= m_l(i, k) * x(k, c);
+                }
+                x(i, c) = t * m_invDiag[i];
+            }
+            // Lᵀ · x = y
+            for (std::size_t i = D; i-- > 0;) {
+                value_type t = x(i, c);
+                for (std::size_t k = i + 1; k < D; ++k) {
+                    t -= m_l(k, i) * x(k, c);
+                }
+                x(i, c) = t * m_invDiag[i];
+            }
+        }
+        return x;
+    }
+
+    /// Returns A⁻¹ = L⁻ᵀ · L⁻¹, which is exactly symmetric.
+    matrix_type inverse() const
+    {
+        // M = L⁻¹, lower triangular
+        matrix_type m;
+        for (std::size_t j = 0; j < D; ++j) {
+            m(j, j) = m_invDiag[j];
+            for (std::size_t i = j + 1; i < D; ++i) {
+                value_type t = m_l(i, j) * m(j, j);
+                for (std::size_t k = j + 1; k < i; ++k) {
+                    t = Common::multiply_add(m_l(i, k), m(k, j), t);
+                }
+                m(i, j) = -t * m_invDiag[i];
+            }
+        }
+        matrix_type r;
+        for (std::size_t i = 0; i < D; ++i) {
+            for (std::size_t j = 0; j <= i; ++j) {
+                value_type sum = m(i, i) * m(i, j);
+                for (std::size_t k = i + 1; k < D; ++k) {
+                    sum = Common::multiply_add(m(k, i), m(k, j), sum);
+                }
+                r(i, j) = sum;
+                r(j, i) = sum;
+            }
+        }
+        return r;
+    }
+
+private:
+    matrix_type m_l;
+    value_type m_invDiag[D];
+    mask_type m_ok;
+};
+
+/**
+ * \relates simd_cholesky
+ *
+ * Returns the Cholesky decomposition of the symmetric positive-definite matrices \p a.
+ */
+template <class T, std::size_t D, std::size_t N>
+inline simd_cholesky<T, D, N> cholesky(const simd_matrix<T, D, D, N> &a)
+{
+    return simd_cholesky<T, D, N>(a);
+}
+
+/**
+ * \relates simd_matrix
+ *
+ * Returns the inverse of the symmetric positive-definite matrices \p a.
+ */
+template <class T, std::size_t D, std::size_t N>
+inline simd_matrix<T, D, D, N> inverse_spd(const simd_matrix<T, D, D, N> &a)
+{
+    return simd_cholesky<T, D, N>(a).inverse();
+}
+
+/**
+ * \relates simd_matrix
+ *
+ * Returns x with `a · x = b` for the symmetric positive-definite matrices \p a.
+ */
+template <class T, std::size_t D, std::size_t K, std::size_t N>
+inline simd_matrix<T, D, K, N> solve_spd(const simd_matrix<T, D, D, N> &a,
+                                         const simd_matrix<T, D, K, N> &b)
+{
+    return simd_cholesky<T, D, N>(a).solve(b);
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_SIMD_MATRIX_H_
+
+// vim: foldmethod=marker
@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //#include "../IO"
 
 #include <array>
+#include <limits>
 
 #include "writemaskedvector.h"
 #include "simdarrayhelper.h"
@@ -115,12 +116,15 @@ template <typename T, std::size_t N, typename VectorType_>
 class SimdArray<T, N, VectorType_, N>
 {
     static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value ||
+                      (std::is_integral<T>::value && sizeof(T) == 8) ||
                       std::is_same<T, int32_t>::value ||
                       std::is_same<T, uint32_t>::value ||
                       std::is_same<T, int16_t>::value ||
-                      std::is_same<T, uint16_t>::value,
-                  "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, "
-                  "int16_t, uint16_t }");
+                      std::is_same<T, uint16_t>::value ||
+                      std::is_same<T, int8_t>::value ||
+                      std::is_same<T, uint8_t>::value,
+                  "SimdArray<T, N> may only be used with T = { double, float, int64_t, "
+                  "uint64_t, int32_t, uint32_t, int16_t, uint16_t, int8_t, uint8_t }");
     static_assert(
         std::is_same<VectorType_,
                      typename Common::select_best_vector_type<T, N>::type>::value &&
@@ -600,10 +604,13 @@ template <typename T, size_t N, typename V, size_t Wt> class SimdArray
 {
     static_assert(std::is_same<T,   double>::value ||
                   std::is_same<T,    float>::value ||
+                  (std::is_integral<T>::value && sizeof(T) == 8) ||
                   std::is_same<T,  int32_t>::value ||
                   std::is_same<T, uint32_t>::value ||
                   std::is_same<T,  int16_t>::value ||
-                  std::is_same<T, uint16_t>::value, "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, int16_t, uint16_t }");
+                  std::is_same<T, uint16_t>::value ||
+                  std::is_same<T,   int8_t>::value ||
+                  std::is_same<T,  uint8_t>::value, "SimdArray<T, N> may only be used with T = { double, float, int64_t, uint64_t, int32_t, uint32_t, int16_t, uint16_t, int8_t, uint8_t }");
     static_assert(
         std::is_same<V, typename Common::select_best_vector_type<T, N>::type>::value &&
             V::size() == Wt,
@@ -745,7 +752,7 @@ public:
 
     // load ctor
     template <typename U, typename Flags = DefaultLoadTag,
-              typename = enable_if<std::is_arithmetic<U>::value &&
+              typename = enable_if<Traits::is_load_store_type<U, T>::value &&
                                    Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(const U *mem, Flags f = Flags())
         : data0(mem, f), data1(mem + storage_type0::size(), f)
@@ -761,7 +768,7 @@ public:
      * from C-arrays.
      */
     template <typename U, std::size_t Extent, typename Flags = DefaultLoadTag,
-              typename = enable_if<std::is_arithmetic<U>::value &&
+              typename = enable_if<Traits::is_load_store_type<U, T>::value &&
                                    Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(CArray<U, Extent> &mem, Flags f = Flags())
         : data0(&mem[0], f), data1(&mem[storage_type0::size()], f)
@@ -771,7 +778,7 @@ public:
      * Const overload of the above.
      */
     template <typename U, std::size_t Extent, typename Flags = DefaultLoadTag,
-              typename = enable_if<std::is_arithmetic<U>::value &&
+              typename = enable_if<Traits::is_load_store_type<U, T>::value &&
                                    Traits::is_load_store_flag<Flags>::value>>
     explicit Vc_INTRINSIC SimdArray(const CArray<U, Extent> &mem, Flags f = Flags())
         : data0(&mem[0], f), data1(&mem[storage_type0::size()], f)
@@ -1764,13 +1771,21 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
  */
 ///@{
 Vc_FORWARD_UNARY_OPERATOR(abs);
+Vc_FORWARD_UNARY_OPERATOR(acos);
 Vc_FORWARD_UNARY_OPERATOR(asin);
 Vc_FORWARD_UNARY_OPERATOR(atan);
 Vc_FORWARD_BINARY_OPERATOR(atan2);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
+Vc_FORWARD_UNARY_OPERATOR(cbrt);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
+Vc_FORWARD_UNARY_OPERATOR(cosh);
 Vc_FORWARD_UNARY_OPERATOR(cos);
 Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_UNARY_OPERATOR(exp10);
+Vc_FORWARD_UNARY_OPERATOR(exp2);
+Vc_FORWARD_UNARY_OPERATOR(expm1);
+Vc_FORWARD_UNARY_OPERATOR(erf);
+Vc_FORWARD_UNARY_OPERATOR(erfc);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1799,10 +1814,13 @@ inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &
 Vc_FORWARD_UNARY_OPERATOR(log);
 Vc_FORWARD_UNARY_OPERATOR(log10);
 Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_UNARY_OPERATOR(log1p);
+Vc_FORWARD_BINARY_OPERATOR(pow);
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
 Vc_FORWARD_UNARY_OPERATOR(sin);
+Vc_FORWARD_UNARY_OPERATOR(sinh);
 /// Determines sine and cosine concurrently and component-wise on \p x.
 template <typename T, std::size_t N>
 void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
@@ -1810,6 +1828,8 @@ void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos
     SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos);
 }
 Vc_FORWARD_UNARY_OPERATOR(sqrt);
+Vc_FORWARD_UNARY_OPERATOR(tan);
+Vc_FORWARD_UNARY_OPERATOR(tanh);
 Vc_FORWARD_UNARY_OPERATOR(trunc);
 Vc_FORWARD_BINARY_OPERATOR(min);
 Vc_FORWARD_BINARY_OPERATOR(max);
@@ -2606,6 +2626,40 @@ inline void transpose_impl(
                                               internal_data1(std::get<3>(proxy.in))});
 }
 
+template <typename T, typename V>
+inline void transpose_impl(
+    TransposeTag<4, 4>, SimdArray<T, 4, V, 2> *Vc_RESTRICT r[],
+    const TransposeProxy<SimdArray<T, 4, V, 2>, SimdArray<T, 4, V, 2>,
+                         SimdArray<T, 4, V, 2>, SimdArray<T, 4, V, 2>> &proxy)
+{
+    // the 4x4 matrix consists of 2x2 blocks of V; transpose every block and swap the
+    // off-diagonal blocks
+    const auto &in0 = std::get<0>(proxy.in);
+    const auto &in1 = std::get<1>(proxy.in);
+    const auto &in2 = std::get<2>(proxy.in);
+    const auto &in3 = std::get<3>(proxy.in);
+    V *Vc_RESTRICT r00[2] = {&internal_data(internal_data0(*r[0])),
+                             &internal_data(internal_data0(*r[1]))};
+    V *Vc_RESTRICT r01[2] = {&internal_data(internal_data1(*r[0])),
+                             &internal_data(internal_data1(*r[1]))};
+    V *Vc_RESTRICT r10[2] = {&internal_data(internal_data0(*r[2])),
+                             &internal_data(internal_data0(*r[3]))};
+    V *Vc_RESTRICT r11[2] = {&internal_data(internal_data1(*r[2])),
+                             &internal_data(internal_data1(*r[3]))};
+    transpose_impl(TransposeTag<2, 2>(), &r00[0],
+                   TransposeProxy<V, V>{internal_data(internal_data0(in0)),
+                                        internal_data(internal_data0(in1))});
+    transpose_impl(TransposeTag<2, 2>(), &r01[0],
+                   TransposeProxy<V, V>{internal_data(internal_data0(in2)),
+                                        internal_data(internal_data0(in3))});
+    transpose_impl(TransposeTag<2, 2>(), &r10[0],
+                   TransposeProxy<V, V>{internal_data(internal_data1(in0)),
+                                        internal_data(internal_data1(in1))});
+    transpose_impl(TransposeTag<2, 2>(), &r11[0],
+                   TransposeProxy<V, V>{internal_data(internal_data1(in2)),
+                                        internal_data(internal_data1(in3))});
+}
+
 /* TODO:
 template <typename T, std::size_t N, typename V, std::size_t VSize>
 inline enable_if<(N > VSize), void> transpose_impl(
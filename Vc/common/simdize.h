@@ -222,9 +222,12 @@ struct is_class_template<C<Ts...>> : public true_type
  */
 template <typename T> constexpr Category typeCategory()
 {
-    return (is_same<T, bool>::value || is_same<T, short>::value ||
+    return (is_same<T, bool>::value || is_same<T, signed char>::value ||
+            is_same<T, unsigned char>::value || is_same<T, short>::value ||
             is_same<T, unsigned short>::value || is_same<T, int>::value ||
-            is_same<T, unsigned int>::value || is_same<T, float>::value ||
+            is_same<T, unsigned int>::value || is_same<T, long>::value ||
+            is_same<T, unsigned long>::value || is_same<T, long long>::value ||
+            is_same<T, unsigned long long>::value || is_same<T, float>::value ||
             is_same<T, double>::value)
                ? Category::ArithmeticVectorizable
                : iteratorCategories<T>(int()) != Category::None
@@ -0,0 +1,633 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SOA_VECTOR_H_
+#define VC_COMMON_SOA_VECTOR_H_
+
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "simdize.h"
+#include "algorithms.h"
+#include "span.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// SoaTraits {{{1
+/**\internal
+ * Describes the structure-of-arrays layout of \p T: one array per member, each padded to
+ * a multiple of the vector width of simdize<T>.
+ */
+template <class T> struct SoaTraits {
+    using value_type = T;
+    using vector_type = simdize<T>;
+    static constexpr std::size_t vector_size = vector_type::size();
+    static constexpr std::size_t member_count =
+        SimdizeDetail::determine_tuple_size_<T>::value;
+    using index_sequence = Vc::make_index_sequence<member_count>;
+
+    template <std::size_t I>
+    using member_type = typename SimdizeDetail::my_tuple_element<I, T>::type;
+    template <std::size_t I>
+    using member_vector = typename std::decay<decltype(
+        SimdizeDetail::get_dispatcher<I>(std::declval<vector_type &>()))>::type;
+
+    /// Loads and stores of member vectors are aligned if every vector starts at a
+    /// multiple of the member vector's MemoryAlignment, given aligned member arrays.
+    template <std::size_t I>
+    using member_flags = typename std::conditional<
+        (vector_size * sizeof(member_type<I>)) % member_vector<I>::MemoryAlignment == 0,
+        AlignedTag, UnalignedTag>::type;
+
+    static constexpr std::size_t padded(std::size_t n)
+    {
+        return (n + vector_size - 1) / vector_size * vector_size;
+    }
+
+    static_assert(SimdizeDetail::is_class_template<T>::value,
+                  "soa_vector and soa_array require a class template instance that "
+                  "provides the tuple interface (e.g. via Vc_SIMDIZE_INTERFACE) as value "
+                  "type");
+
+private:
+    template <bool... Bs> struct bools;
+    template <std::size_t... I>
+    static std::is_same<bools<true, Traits::is_simd_vector<member_vector<I>>::value...>,
+                        bools<Traits::is_simd_vector<member_vector<I>>::value..., true>>
+        members_are_vectors(Vc::index_sequence<I...>);
+
+public:
+    static_assert(decltype(members_are_vectors(index_sequence()))::value,
+                  "soa_vector and soa_array require that simdize turns every member of "
+                  "the value type into a vector, i.e. all members must be arithmetic "
+                  "types given as template arguments of the value type");
+};
+
+// AllocatorAligns {{{1
+/**\internal
+ * Whether the allocator \p A returns memory aligned for vector loads and stores. Only
+ * Vc::Allocator gives this guarantee.
+ */
+template <class A> struct AllocatorAligns : public std::false_type {
+};
+template <class U> struct AllocatorAligns<Allocator<U>> : public std::true_type {
+};
+
+// SoaReference {{{1
+/**\internal
+ * Proxy for the element at offset \p i of the SoA container \p C. It converts to and
+ * assigns from the value type, accessing all member arrays.
+ */
+template <class C> class SoaReference
+{
+    using T = typename C::value_type;
+    using Traits = SoaTraits<T>;
+
+    template <std::size_t... I> T extract(Vc::index_sequence<I...>) const
+    {
+        return SimdizeDetail::construct<T>(
+            SimdizeDetail::preferred_construction<
+                T, typename Traits::template member_type<I>...>(),
+            c->template data<I>()[i]...);
+    }
+    template <std::size_t... I> void assign(const T &x, Vc::index_sequence<I...>) const
+    {
+        auto &&unused = {
+            (c->template data<I>()[i] = SimdizeDetail::get_dispatcher<I>(x), 0)...};
+        if (&unused == &unused) {}
+    }
+
+public:
+    SoaReference(C &cc, std::size_t ii) : c(&cc), i(ii) {}
+
+    operator T() const { return extract(typename Traits::index_sequence()); }
+
+    const SoaReference &operator=(const T &x) const
+    {
+        assign(x, typename Traits::index_sequence());
+        return *this;
+    }
+    const SoaReference &operator=(const SoaReference &x) const
+    {
+        return operator=(static_cast<T>(x));
+    }
+
+    /// Returns a reference to the member \p I of the referenced element.
+    template <std::size_t I>
+    auto get() const -> decltype(std::declval<C &>().template data<I>()[0])
+    {
+        return c->template data<I>()[i];
+    }
+
+private:
+    C *c;
+    std::size_t i;
+};
+
+// SoaVectorReference {{{1
+/**\internal
+ * Proxy for the \p i-th vector of the SoA container \p C, i.e. the elements at offsets
+ * `i * vector_size` to `(i + 1) * vector_size - 1`. Conversion and assignment use one
+ * load or store per member, with the load/store flags given by `C::member_flags`.
+ */
+template <class C> class SoaVectorReference
+{
+    using T = typename C::value_type;
+    using Traits = SoaTraits<T>;
+    using V = typename Traits::vector_type;
+
+    template <std::size_t... I> void load(V &r, Vc::index_sequence<I...>) const
+    {
+        auto &&unused = {(SimdizeDetail::get_dispatcher<I>(r).load(
+                              c->template data<I>() + offset,
+                              typename C::template member_flags<I>()),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+    template <std::size_t... I> void store(const V &x, Vc::index_sequence<I...>) const
+    {
+        auto &&unused = {(SimdizeDetail::get_dispatcher<I>(x).store(
+                              c->template data<I>() + offset,
+                              typename C::template member_flags<I>()),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+
+public:
+    SoaVectorReference(C &cc, std::size_t ii) : c(&cc), offset(ii * Traits::vector_size)
+    {
+    }
+
+    operator V() const
+    {
+        V r;
+        load(r, typename Traits::index_sequence());
+        return r;
+    }
+
+    const SoaVectorReference &operator=(const V &x) const
+    {
+        store(x, typename Traits::index_sequence());
+        return *this;
+    }
+    const SoaVectorReference &operator=(const SoaVectorReference &x) const
+    {
+        return operator=(static_cast<V>(x));
+    }
+
+private:
+    C *c;
+    std::size_t offset;
+};
+
+// SoaIterator {{{1
+/**\internal
+ * Random access iterator over the elements of the SoA container \p C. Dereferencing
+ * yields a SoaReference proxy, thus the iterator does not satisfy the ForwardIterator
+ * requirement of returning a true reference (like `std::vector<bool>::iterator`).
+ */
+template <class C> class SoaIterator
+{
+public:
+    using value_type = typename C::value_type;
+    using reference = SoaReference<C>;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    SoaIterator() = default;
+    SoaIterator(C &cc, std::size_t ii) : c(&cc), i(ii) {}
+    template <class CC, class = enable_if<std::is_same<const CC, C>::value>>
+    SoaIterator(const SoaIterator<CC> &x) : c(x.container()), i(x.index())
+    {
+    }
+
+    reference operator*() const { return {*c, i}; }
+    reference operator[](difference_type n) const { return {*c, i + n}; }
+
+    SoaIterator &operator++() { ++i; return *this; }
+    SoaIterator &operator--() { --i; return *this; }
+    SoaIterator operator++(int) { SoaIterator r = *this; ++i; return r; }
+    SoaIterator operator--(int) { SoaIterator r = *this; --i; return r; }
+    SoaIterator &operator+=(difference_type n) { i += n; return *this; }
+    SoaIterator &operator-=(difference_type n) { i -= n; return *this; }
+    SoaIterator operator+(difference_type n) const { return {*c, i + n}; }
+    SoaIterator operator-(difference_type n) const { return {*c, i - n}; }
+    friend SoaIterator operator+(difference_type n, const SoaIterator &x)
+    {
+        return x + n;
+    }
+    difference_type operator-(const SoaIterator &x) const
+    {
+        return difference_type(i) - difference_type(x.i);
+    }
+
+    bool operator==(const SoaIterator &x) const { return i == x.i; }
+    bool operator!=(const SoaIterator &x) const { return i != x.i; }
+    bool operator< (const SoaIterator &x) const { return i <  x.i; }
+    bool operator<=(const SoaIterator &x) const { return i <= x.i; }
+    bool operator> (const SoaIterator &x) const { return i >  x.i; }
+    bool operator>=(const SoaIterator &x) const { return i >= x.i; }
+
+    /// The container the iterator points into.
+    C *container() const { return c; }
+    /// The offset of the element the iterator points to.
+    std::size_t index() const { return i; }
+
+private:
+    C *c = nullptr;
+    std::size_t i = 0;
+};
+
+// SoaInterface {{{1
+/**\internal
+ * The common interface of soa_vector and soa_array. \p Derived must provide `size()` and
+ * `data<I>()`, returning a pointer to the MemoryAlignment aligned and padded array of
+ * member \p I.
+ */
+template <class Derived, class T> class SoaInterface
+{
+    using Traits = SoaTraits<T>;
+    Derived &derived() { return static_cast<Derived &>(*this); }
+    const Derived &derived() const { return static_cast<const Derived &>(*this); }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = SoaReference<Derived>;
+    using const_reference = T;
+    using iterator = SoaIterator<Derived>;
+    using const_iterator = SoaIterator<const Derived>;
+    /// The vectorized value type returned by vector().
+    using vector_type = typename Traits::vector_type;
+    /// The number of elements in one vector_type object.
+    static constexpr std::size_t vector_size = Traits::vector_size;
+    /// The scalar type of member \p I.
+    template <std::size_t I> using member_type = typename Traits::template member_type<I>;
+
+    bool empty() const { return derived().size() == 0; }
+
+    /// Returns the number of vectors needed to cover all elements.
+    std::size_t vector_count() const
+    {
+        return (derived().size() + vector_size - 1) / vector_size;
+    }
+
+    /**
+     * Returns a proxy for the \p i-th vector, i.e. the elements `i * vector_size` to
+     * `(i + 1) * vector_size - 1`. The proxy converts to vector_type and assigns from it
+     * with aligned loads and stores. The last vector may extend into the padding after
+     * `size()`; values written there are not observable through the element interface.
+     */
+    SoaVectorReference<Derived> vector(std::size_t i) { return {derived(), i}; }
+    vector_type vector(std::size_t i) const
+    {
+        return SoaVectorReference<const Derived>(derived(), i);
+    }
+
+    reference operator[](std::size_t i) { return {derived(), i}; }
+    T operator[](std::size_t i) const
+    {
+        return SoaReference<const Derived>(derived(), i);
+    }
+
+    /// Returns a view of the array of member \p I without copying.
+    template <std::size_t I> span<member_type<I>> member()
+    {
+        return {derived().template data<I>(), std::ptrdiff_t(derived().size())};
+    }
+    template <std::size_t I> span<const member_type<I>> member() const
+    {
+        return {derived().template data<I>(), std::ptrdiff_t(derived().size())};
+    }
+
+    iterator begin() { return {derived(), 0}; }
+    iterator end() { return {derived(), derived().size()}; }
+    const_iterator begin() const { return {derived(), 0}; }
+    const_iterator end() const { return {derived(), derived().size()}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+};
+template <class Derived, class T>
+constexpr std::size_t SoaInterface<Derived, T>::vector_size;
+
+// SoaArrayStorage {{{1
+template <class E, std::size_t N> struct SoaArrayStorage {
+    alignas(MemoryAlignment) E data[N];
+};
+
+// simd_for_each_soa {{{1
+/**\internal
+ * Calls \p f with the scalar objects from \p first to \p last as simdize<T, 1>. Used for
+ * the unaligned head and the tail of a range.
+ */
+template <class C, class F>
+inline void simd_for_each_soa_scalar(SoaIterator<C> first, SoaIterator<C> last, F &f,
+                                     std::true_type /*immutable*/)
+{
+    using T = typename C::value_type;
+    for (; first != last; ++first) {
+        simdize<T, 1> tmp = static_cast<T>(*first);
+        f(tmp);
+    }
+}
+template <class C, class F>
+inline void simd_for_each_soa_scalar(SoaIterator<C> first, SoaIterator<C> last, F &f,
+                                     std::false_type /*immutable*/)
+{
+    using T = typename C::value_type;
+    for (; first != last; ++first) {
+        simdize<T, 1> tmp = static_cast<T>(*first);
+        f(tmp);
+        *first = extract(tmp, 0);
+    }
+}
+template <class C, class F>
+inline void simd_for_each_soa_vectors(C &c, std::size_t i, std::size_t end, F &f,
+                                      std::true_type /*immutable*/)
+{
+    for (; i < end; ++i) {
+        typename C::vector_type tmp = c.vector(i);
+        f(tmp);
+    }
+}
+template <class C, class F>
+inline void simd_for_each_soa_vectors(C &c, std::size_t i, std::size_t end, F &f,
+                                      std::false_type /*immutable*/)
+{
+    for (; i < end; ++i) {
+        typename C::vector_type tmp = c.vector(i);
+        f(tmp);
+        c.vector(i) = tmp;
+    }
+}
+//}}}1
+}  // namespace Common
+
+// soa_vector {{{1
+/**
+ * \ingroup Containers
+ * \headerfile soa_vector.h <Vc/soa_vector>
+ *
+ * A dynamically sized container that stores objects of type \p T as one array per
+ * member (structure of arrays).
+ *
+ * \p T must be a class template instance with the tuple interface (see
+ * Vc_SIMDIZE_INTERFACE), just as for simdize, and its members must be arithmetic types.
+ * Every member array is allocated with \p Alloc (rebound to the member type) and padded
+ * to a multiple of vector_size. Therefore vector(i) returns `simdize<T>` objects using
+ * only vector loads, in contrast to the gathers required to simdize an array of
+ * structures. With the default Vc::Allocator the member arrays are aligned to
+ * Vc::MemoryAlignment and these loads are aligned; other allocators give no alignment
+ * guarantee, thus unaligned loads and stores are used.
+ *
+ * \code
+ * template <class T> struct ParticleT {
+ *     T x, y, z, mass;
+ *     Vc_SIMDIZE_INTERFACE((x, y, z, mass));
+ * };
+ * using Particle = ParticleT<float>;
+ *
+ * Vc::soa_vector<Particle> particles;
+ * particles.push_back({1.f, 2.f, 3.f, 4.f});
+ * Vc::simd_for_each(particles.begin(), particles.end(), [](auto &p) {
+ *     p.x += p.mass;
+ * });
+ * \endcode
+ *
+ * \tparam T The value type.
+ * \tparam Alloc The allocator used for the member arrays.
+ */
+template <class T, class Alloc = Allocator<T>>
+class soa_vector : public Common::SoaInterface<soa_vector<T, Alloc>, T>
+{
+    using Traits = Common::SoaTraits<T>;
+    template <class E>
+    using member_vector =
+        std::vector<E, typename std::allocator_traits<Alloc>::template rebind_alloc<E>>;
+    template <std::size_t... I>
+    static std::tuple<member_vector<typename Traits::template member_type<I>>...>
+        storage_type_helper(Vc::index_sequence<I...>);
+    using storage_type =
+        decltype(storage_type_helper(typename Traits::index_sequence()));
+
+    template <class A> static void resize_array(A &a, std::size_t count, std::size_t n)
+    {
+        // value-initialize the elements in the padding that become visible
+        std::fill(a.begin() + std::min(count, n), a.begin() + std::min(a.size(), n),
+                  typename A::value_type());
+        a.resize(Traits::padded(n));
+    }
+    template <std::size_t... I> void resize_impl(std::size_t n, Vc::index_sequence<I...>)
+    {
+        auto &&unused = {(resize_array(std::get<I>(arrays), count, n), 0)...};
+        if (&unused == &unused) {}
+    }
+    template <std::size_t... I> void reserve_impl(std::size_t n, Vc::index_sequence<I...>)
+    {
+        auto &&unused = {(std::get<I>(arrays).reserve(Traits::padded(n)), 0)...};
+        if (&unused == &unused) {}
+    }
+    template <std::size_t... I> void shrink_impl(Vc::index_sequence<I...>)
+    {
+        auto &&unused = {(std::get<I>(arrays).shrink_to_fit(), 0)...};
+        if (&unused == &unused) {}
+    }
+
+public:
+    using allocator_type = Alloc;
+
+    /// The load/store flags for the vectors of member \p I.
+    template <std::size_t I>
+    using member_flags =
+        typename std::conditional<Common::AllocatorAligns<Alloc>::value,
+                                  typename Traits::template member_flags<I>,
+                                  UnalignedTag>::type;
+
+    soa_vector() = default;
+    /// Constructs \p n value-initialized elements.
+    explicit soa_vector(std::size_t n) { resize(n); }
+    /// Constructs \p n copies of \p x.
+    soa_vector(std::size_t n, const T &x) { resize(n, x); }
+    /// Constructs the elements from \p init.
+    soa_vector(std::initializer_list<T> init)
+    {
+        reserve(init.size());
+        for (const T &x : init) {
+            push_back(x);
+        }
+    }
+
+    std::size_t size() const { return count; }
+    /// Returns the number of elements that fit without reallocation.
+    std::size_t capacity() const { return std::get<0>(arrays).capacity(); }
+
+    /// Returns a pointer to the array of member \p I.
+    template <std::size_t I> typename Traits::template member_type<I> *data()
+    {
+        return std::get<I>(arrays).data();
+    }
+    template <std::size_t I> const typename Traits::template member_type<I> *data() const
+    {
+        return std::get<I>(arrays).data();
+    }
+
+    void reserve(std::size_t n)
+    {
+        reserve_impl(n, typename Traits::index_sequence());
+    }
+
+    /// Resizes to \p n elements. New elements are value-initialized.
+    void resize(std::size_t n)
+    {
+        resize_impl(n, typename Traits::index_sequence());
+        count = n;
+    }
+    /// Resizes to \p n elements. New elements are copies of \p x.
+    void resize(std::size_t n, const T &x)
+    {
+        const std::size_t old = count;
+        resize(n);
+        for (std::size_t i = old; i < n; ++i) {
+            (*this)[i] = x;
+        }
+    }
+
+    void push_back(const T &x)
+    {
+        if (count % Traits::vector_size == 0) {
+            resize_impl(count + 1, typename Traits::index_sequence());
+        }
+        (*this)[count++] = x;
+    }
+    void pop_back() { --count; }
+    void clear() { resize(0); }
+
+    /// Releases the memory not needed for size() elements.
+    void shrink_to_fit()
+    {
+        shrink_impl(typename Traits::index_sequence());
+    }
+
+private:
+    storage_type arrays;
+    std::size_t count = 0;
+};
+
+// soa_array {{{1
+/**
+ * \ingroup Containers
+ * \headerfile soa_vector.h <Vc/soa_vector>
+ *
+ * A fixed-size variant of soa_vector storing \p N objects of type \p T in aligned member
+ * arrays that are part of the object itself.
+ */
+template <class T, std::size_t N>
+class soa_array : public Common::SoaInterface<soa_array<T, N>, T>
+{
+    using Traits = Common::SoaTraits<T>;
+    template <std::size_t... I>
+    static std::tuple<Common::SoaArrayStorage<typename Traits::template member_type<I>,
+                                              Traits::padded(N)>...>
+        storage_type_helper(Vc::index_sequence<I...>);
+    using storage_type =
+        decltype(storage_type_helper(typename Traits::index_sequence()));
+
+public:
+    /// The load/store flags for the vectors of member \p I.
+    template <std::size_t I> using member_flags = typename Traits::template member_flags<I>;
+
+    static constexpr std::size_t size() { return N; }
+
+    template <std::size_t I> typename Traits::template member_type<I> *data()
+    {
+        return std::get<I>(arrays).data;
+    }
+    template <std::size_t I> const typename Traits::template member_type<I> *data() const
+    {
+        return std::get<I>(arrays).data;
+    }
+
+    /// Assigns \p x to all elements.
+    void fill(const T &x)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            (*this)[i] = x;
+        }
+    }
+
+    Vc_FREE_STORE_OPERATORS_ALIGNED(alignof(soa_array));
+
+private:
+    storage_type arrays;
+};
+
+// simd_for_each(SoaIterator) {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Overload of simd_for_each for soa_vector and soa_array iterators. \p f is called with
+ * `simdize<T>` objects loaded with aligned vector loads from the member arrays, and with
+ * `simdize<T, 1>` objects for the elements before the first and after the last complete
+ * vector in the range. If \p f takes its argument by non-const reference the modified
+ * objects are stored back.
+ */
+template <class C, class UnaryFunction>
+inline UnaryFunction simd_for_each(Common::SoaIterator<C> first,
+                                   Common::SoaIterator<C> last, UnaryFunction f)
+{
+    using T = typename C::value_type;
+    constexpr std::size_t N = Common::SoaTraits<T>::vector_size;
+    using Immutable = std::integral_constant<
+        bool,
+        std::is_const<C>::value ||
+            Traits::is_functor_argument_immutable<UnaryFunction, simdize<T>>::value>;
+    if (last - first < std::ptrdiff_t(N)) {
+        Common::simd_for_each_soa_scalar(first, last, f, Immutable());
+        return f;
+    }
+    C &c = *first.container();
+    const std::size_t firstVector = (first.index() + N - 1) / N;
+    const std::size_t lastVector = last.index() / N;
+    Common::simd_for_each_soa_scalar(first, Common::SoaIterator<C>(c, firstVector * N), f,
+                                     Immutable());
+    Common::simd_for_each_soa_vectors(c, firstVector, lastVector, f, Immutable());
+    Common::simd_for_each_soa_scalar(Common::SoaIterator<C>(c, lastVector * N), last, f,
+                                     Immutable());
+    return f;
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_SOA_VECTOR_H_
+
+// vim: foldmethod=marker
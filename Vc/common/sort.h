@@ -0,0 +1,427 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SORT_H_
+#define VC_COMMON_SORT_H_
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "compress.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * Payload policy for sorting keys only.
+ */
+struct NoSortPayload {
+    struct Block {
+        Vc_INTRINSIC void read(const NoSortPayload &, std::size_t, std::size_t) {}
+        Vc_INTRINSIC void write(NoSortPayload &, std::size_t, std::size_t) const {}
+        Vc_INTRINSIC void compress_write(NoSortPayload &, std::size_t, unsigned) const {}
+    };
+    Vc_INTRINSIC void swap(std::size_t, std::size_t) {}
+};
+
+/**\internal
+ * Payload policy for sort_by_key: every move of a key is mirrored on \c data.
+ */
+template <class U, std::size_t W> struct SortPayload {
+    U *data;
+    struct Block {
+        U v[W];
+        Vc_INTRINSIC void read(const SortPayload &p, std::size_t pos, std::size_t count)
+        {
+            for (std::size_t k = 0; k < count; ++k) {
+                v[k] = p.data[pos + k];
+            }
+        }
+        Vc_INTRINSIC void write(SortPayload &p, std::size_t pos, std::size_t lane) const
+        {
+            p.data[pos] = v[lane];
+        }
+        // writes the lanes set in bits to increasing positions starting at pos
+        Vc_INTRINSIC void compress_write(SortPayload &p, std::size_t pos,
+                                         unsigned bits) const
+        {
+            for (; bits != 0; bits &= bits - 1) {
+                p.data[pos++] = v[_bit_scan_forward(bits)];
+            }
+        }
+    };
+    Vc_INTRINSIC void swap(std::size_t i, std::size_t j)
+    {
+        using std::swap;
+        swap(data[i], data[j]);
+    }
+};
+
+/**\internal
+ * The value used to pad partial vectors in the sorting networks. It sorts after (or
+ * equal to) all other values.
+ */
+template <class T> constexpr T sort_padding()
+{
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+}
+
+/**\internal
+ * Sorts \p n <= V::Size elements at \p keys with the in-register sorting network of V.
+ */
+template <class V> Vc_ALWAYS_INLINE void sort_network(typename V::EntryType *keys, std::size_t n)
+{
+    using T = typename V::EntryType;
+    alignas(V::MemoryAlignment) T buf[V::Size];
+    std::fill_n(&buf[0], V::Size, sort_padding<T>());
+    std::memcpy(&buf[0], keys, n * sizeof(T));
+    V(&buf[0], Vc::Aligned).sorted().store(&buf[0], Vc::Aligned);
+    std::memcpy(keys, &buf[0], n * sizeof(T));
+}
+
+/**\internal
+ * Base case for ranges of up to 4 vectors: the sorting networks of Vector and SimdArray,
+ * the latter merging the sorted registers with bitonic merge steps.
+ */
+template <class T, class P>
+Vc_ALWAYS_INLINE void sort_small(T *keys, P &, std::size_t begin, std::size_t end,
+                                  NoSortPayload *)
+{
+    keys += begin;
+    const std::size_t n = end - begin;
+    constexpr std::size_t W = Vector<T>::Size;
+    if (n <= W) {
+        sort_network<Vector<T>>(keys, n);
+    } else if (n <= 2 * W) {
+        sort_network<SimdArray<T, 2 * W>>(keys, n);
+    } else {
+        sort_network<SimdArray<T, 4 * W>>(keys, n);
+    }
+}
+
+/**\internal
+ * Base case with payload: insertion sort.
+ */
+template <class T, class P>
+Vc_ALWAYS_INLINE void sort_small(T *keys, P &payload, std::size_t begin,
+                                  std::size_t end, void *)
+{
+    for (std::size_t i = begin + 1; i < end; ++i) {
+        for (std::size_t j = i; j > begin && keys[j] < keys[j - 1]; --j) {
+            std::swap(keys[j], keys[j - 1]);
+            payload.swap(j, j - 1);
+        }
+    }
+}
+
+/**\internal
+ * Writes the lanes of \p v (and the corresponding payload) where \p m is \c true to
+ * the positions starting at \p wl and the remaining lanes to the positions ending at \p wr,
+ * using compress_store. Both sides must have at least V::Size free slots.
+ */
+template <class V, class P>
+Vc_ALWAYS_INLINE void partition_store(const V &v, const typename V::MaskType &m,
+                                      const typename P::Block &block,
+                                      typename V::EntryType *keys, P &payload,
+                                      std::size_t &wl, std::size_t &wr)
+{
+    const std::size_t nl = Vc::compress_store(v, m, keys + wl);
+    const std::size_t nr = V::Size - nl;
+    Vc::compress_store(v, !m, keys + wr - nr);
+    block.compress_write(payload, wl, m.toInt());
+    block.compress_write(payload, wr - nr, (!m).toInt());
+    wl += nl;
+    wr -= nr;
+}
+
+/**\internal
+ * Partitions [begin, end) in-place such that all elements for which \p pred returns
+ * \c true precede the others. Requires end - begin >= 2 * Vector<T>::Size. Returns the
+ * index of the first element of the second group.
+ *
+ * The first and last vector are held in registers, which leaves free space at both ends
+ * of the range. Each iteration reads the next vector from the side with less free space
+ * and thus never overwrites unread elements.
+ */
+template <class T, class P, class Pred>
+std::size_t partition(T *keys, P &payload, std::size_t begin, std::size_t end, Pred &&pred)
+{
+    using V = Vector<T>;
+    constexpr std::size_t W = V::Size;
+    typename P::Block blockL, blockR, block;
+    const V vL(keys + begin, Vc::Unaligned);
+    const V vR(keys + end - W, Vc::Unaligned);
+    blockL.read(payload, begin, W);
+    blockR.read(payload, end - W, W);
+    std::size_t l = begin + W, r = end - W;  // unread elements: [l, r)
+    std::size_t wl = begin, wr = end;        // next free slots: wl and wr - 1
+    while (r - l >= W) {
+        V v;
+        if (l - wl <= wr - r) {
+            v.load(keys + l, Vc::Unaligned);
+            block.read(payload, l, W);
+            l += W;
+        } else {
+            r -= W;
+            v.load(keys + r, Vc::Unaligned);
+            block.read(payload, r, W);
+        }
+        partition_store(v, pred(v), block, keys, payload, wl, wr);
+    }
+    // fewer than W elements remain unread
+    const std::size_t rest = r - l;
+    if (rest > 0) {
+        alignas(V::MemoryAlignment) T tmp[W];
+        std::copy_n(keys + l, rest, &tmp[0]);
+        std::fill_n(&tmp[rest], W - rest, tmp[0]);
+        block.read(payload, l, rest);
+        const auto m = pred(V(&tmp[0], Vc::Aligned));
+        for (std::size_t i = 0; i < rest; ++i) {
+            const std::size_t pos = m[i] ? wl++ : --wr;
+            keys[pos] = tmp[i];
+            block.write(payload, pos, i);
+        }
+    }
+    partition_store(vL, pred(vL), blockL, keys, payload, wl, wr);
+    partition_store(vR, pred(vR), blockR, keys, payload, wl, wr);
+    return wl;
+}
+
+/**\internal
+ * Fallback for degenerate partitions (introsort depth limit) and non-vectorizable types.
+ */
+template <class T>
+void sort_fallback(T *keys, NoSortPayload &, std::size_t begin,
+                   std::size_t end, std::size_t limit)
+{
+    if (limit < end) {
+        std::partial_sort(keys + begin, keys + limit, keys + end);
+    } else {
+        std::sort(keys + begin, keys + end);
+    }
+}
+template <class T, class U>
+void sort_fallback(T *keys, SortPayload<U, Vector<T>::Size> &payload, std::size_t begin,
+                   std::size_t end, std::size_t)
+{
+    std::vector<std::pair<T, U>> tmp;
+    tmp.reserve(end - begin);
+    for (std::size_t i = begin; i < end; ++i) {
+        tmp.emplace_back(keys[i], std::move(payload.data[i]));
+    }
+    std::stable_sort(tmp.begin(), tmp.end(),
+                     [](const std::pair<T, U> &a, const std::pair<T, U> &b) {
+                         return a.first < b.first;
+                     });
+    for (std::size_t i = begin; i < end; ++i) {
+        keys[i] = tmp[i - begin].first;
+        payload.data[i] = std::move(tmp[i - begin].second);
+    }
+}
+
+/**\internal
+ * Introsort with vectorized partitioning. Only partitions that intersect [begin, limit)
+ * are sorted, which implements partial_sort.
+ */
+template <class T, class P>
+void sort_impl(T *keys, P &payload, std::size_t begin, std::size_t end, std::size_t limit,
+               int depth)
+{
+    using V = Vector<T>;
+    constexpr std::size_t Threshold = 4 * V::Size;
+    while (end - begin > Threshold) {
+        if (depth-- == 0) {
+            sort_fallback(keys, payload, begin, end, limit);
+            return;
+        }
+        // median of three
+        T a = keys[begin], b = keys[begin + (end - begin) / 2], c = keys[end - 1];
+        if (b < a) std::swap(a, b);
+        if (c < b) b = (c < a) ? a : c;
+        const T pivot = b;
+        const V pivotV = pivot;
+
+        std::size_t mid = partition(keys, payload, begin, end,
+                                    [&](const V &x) { return x < pivotV; });
+        if (mid == begin) {
+            // the pivot is the smallest value: split off all elements equal to it
+            begin = partition(keys, payload, begin, end,
+                              [&](const V &x) { return x <= pivotV; });
+            if (begin >= limit) {
+                return;
+            }
+            continue;
+        }
+        if (mid >= limit) {
+            end = mid;
+        } else if (mid - begin < end - mid) {
+            sort_impl(keys, payload, begin, mid, limit, depth);
+            begin = mid;
+        } else {
+            sort_impl(keys, payload, mid, end, limit, depth);
+            end = mid;
+        }
+    }
+    sort_small(keys, payload, begin, end, &payload);
+}
+
+inline int sort_depth_limit(std::size_t n)
+{
+    int depth = 0;
+    for (; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    return depth;
+}
+
+template <class T>
+inline void sort(T *keys, std::size_t n, std::size_t limit, std::true_type)
+{
+    NoSortPayload payload;
+    sort_impl(keys, payload, 0, n, limit, sort_depth_limit(n));
+}
+template <class T>
+inline void sort(T *keys, std::size_t n, std::size_t limit, std::false_type)
+{
+    if (limit == n) {
+        std::sort(keys, keys + n);
+    } else {
+        std::partial_sort(keys, keys + limit, keys + n);
+    }
+}
+
+template <class T, class U>
+inline void sort_by_key(T *keys, U *values, std::size_t n, std::true_type)
+{
+    SortPayload<U, Vector<T>::Size> payload = {values};
+    sort_impl(keys, payload, 0, n, n, sort_depth_limit(n));
+}
+template <class T, class U>
+inline void sort_by_key(T *keys, U *values, std::size_t n, std::false_type)
+{
+    std::vector<std::size_t> index(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        index[i] = i;
+    }
+    std::stable_sort(index.begin(), index.end(),
+                     [&](std::size_t a, std::size_t b) { return keys[a] < keys[b]; });
+    std::vector<T> k(n);
+    std::vector<U> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        k[i] = keys[index[i]];
+        v[i] = std::move(values[index[i]]);
+    }
+    std::copy(k.begin(), k.end(), keys);
+    std::move(v.begin(), v.end(), values);
+}
+
+template <class It>
+using sort_is_vectorizable =
+    Traits::is_valid_vector_argument<typename std::iterator_traits<It>::value_type>;
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/Vc>
+ *
+ * Sorts the elements in [\p first, \p last) in ascending order, like `std::sort` with
+ * `operator<`.
+ *
+ * For the arithmetic types supported by Vc::Vector the implementation is an introsort
+ * with a vectorized in-place partition step and the in-register sorting networks
+ * (Vector::sorted and SimdArray::sorted with bitonic merge across registers) as base
+ * case. All other element types are forwarded to `std::sort`.
+ *
+ * \param first, last A contiguous range (e.g. pointers, `std::vector` or `std::array`
+ *                    iterators).
+ *
+ * \note The range must not contain NaNs, as `operator<` would not be a strict weak
+ * ordering. The sort is not stable.
+ */
+template <class RandomAccessIterator>
+inline void sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    const std::size_t n = std::distance(first, last);
+    if (n > 1) {
+        Common::sort(std::addressof(*first), n, n,
+                     Common::sort_is_vectorizable<RandomAccessIterator>());
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/Vc>
+ *
+ * Rearranges the elements in [\p first, \p last) such that [\p first, \p middle)
+ * contains the smallest `middle - first` elements in ascending order, like
+ * `std::partial_sort`. The order of the remaining elements is unspecified.
+ *
+ * Same requirements as Vc::sort.
+ */
+template <class RandomAccessIterator>
+inline void partial_sort(RandomAccessIterator first, RandomAccessIterator middle,
+                         RandomAccessIterator last)
+{
+    const std::size_t n = std::distance(first, last);
+    const std::size_t limit = std::distance(first, middle);
+    if (n > 1 && limit > 0) {
+        Common::sort(std::addressof(*first), n, limit,
+                     Common::sort_is_vectorizable<RandomAccessIterator>());
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/Vc>
+ *
+ * Sorts the keys in [\p keys_first, \p keys_last) in ascending order and applies the
+ * same permutation to the range starting at \p values_first. The keys are partitioned
+ * with the vectorized partition step of Vc::sort; the values are moved along.
+ *
+ * Same requirements as Vc::sort, additionally the values range must be contiguous.
+ */
+template <class KeyIterator, class ValueIterator>
+inline void sort_by_key(KeyIterator keys_first, KeyIterator keys_last,
+                        ValueIterator values_first)
+{
+    const std::size_t n = std::distance(keys_first, keys_last);
+    if (n > 1) {
+        Common::sort_by_key(std::addressof(*keys_first), std::addressof(*values_first), n,
+                            Common::sort_is_vectorizable<KeyIterator>());
+    }
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SORT_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,255 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_STREAMING_H_
+#define VC_COMMON_STREAMING_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#ifdef Vc_IMPL_SSE
+#include <xmmintrin.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// store_fence {{{1
+/**\internal
+ * Orders preceding non-temporal stores before all subsequent stores.
+ */
+Vc_INTRINSIC void store_fence()
+{
+#ifdef Vc_IMPL_SSE
+    _mm_sfence();
+#endif
+}
+
+/**\internal
+ * Output size in bytes from which the range functions use non-temporal stores. Smaller
+ * outputs fit into the outer cache levels and are likely to be read again from there;
+ * bypassing the cache only pays off once the output would evict most of it.
+ */
+constexpr std::size_t streaming_threshold = 4 * 1024 * 1024;
+
+// partial loads and stores {{{1
+/**\internal
+ * Loads \p n <= V::Size entries from \p mem without reading past `mem + n`. The remaining
+ * entries are zero.
+ */
+template <class V, class T> Vc_INTRINSIC V load_partial(const T *mem, std::size_t n)
+{
+    T buffer[V::Size] = {};
+    std::copy(mem, mem + n, &buffer[0]);
+    return V(&buffer[0], Vc::Unaligned);
+}
+
+/**\internal
+ * Stores the first \p n <= V::Size entries of \p v to \p mem without writing past
+ * `mem + n`.
+ */
+template <class V, class T>
+Vc_INTRINSIC void store_partial(const V &v, T *mem, std::size_t n)
+{
+    T buffer[V::Size];
+    v.store(&buffer[0], Vc::Unaligned);
+    std::copy(&buffer[0], &buffer[n], mem);
+}
+
+// stream_store {{{1
+/**\internal
+ * Writes `chunk(i, n)`, a vector of type \p W holding the values for `out[i]` to
+ * `out[i + n - 1]`, to all \p count entries of \p out. \p n is W::Size except for the
+ * head and the tail.
+ *
+ * Outputs of at least streaming_threshold bytes are written with aligned non-temporal
+ * stores: entries up to the first W::MemoryAlignment boundary are written as head chunk
+ * with regular stores, and a store fence follows the last non-temporal store.
+ */
+template <class W, class U, class F>
+inline void stream_store(U *out, std::size_t count, F &&chunk)
+{
+    // single-entry vectors never need a partial head or tail
+    constexpr std::size_t Size = W::Size;
+    std::size_t i = 0;
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(out);
+    if (count * sizeof(U) >= streaming_threshold && addr % sizeof(U) == 0) {
+        const std::size_t misalignment = addr % W::MemoryAlignment;
+        const std::size_t head =
+            misalignment == 0 ? 0 : (W::MemoryAlignment - misalignment) / sizeof(U);
+        if (Size > 1 && head > 0) {
+            store_partial(chunk(std::size_t(0), head), out, head);
+            i = head;
+        }
+        for (; i + Size <= count; i += Size) {
+            chunk(i, Size).store(out + i, Vc::Aligned | Vc::Streaming);
+        }
+        store_fence();
+    } else {
+        for (; i + Size <= count; i += Size) {
+            chunk(i, Size).store(out + i, Vc::Unaligned);
+        }
+    }
+    if (Size > 1 && i < count) {
+        store_partial(chunk(i, count - i), out + i, count - i);
+    }
+}
+
+/**\internal
+ * Loads the chunk of \p n entries at \p mem, with a full vector load if possible.
+ */
+template <class V, class T>
+Vc_INTRINSIC V load_chunk(const T *mem, std::size_t n)
+{
+    return n == V::Size ? V(mem, Vc::Unaligned) : load_partial<V>(mem, n);
+}
+
+/**\internal
+ * The vector type with entries of type \p U and the width of \p V: V itself or a
+ * SimdArray. Vectors are converted to it with simd_cast.
+ */
+template <class V, class U>
+using rebind_vector_type =
+    typename std::conditional<std::is_same<typename V::EntryType, U>::value, V,
+                              SimdArray<U, V::Size>>::type;
+//}}}1
+}  // namespace Common
+
+// stream_copy {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/Memory>
+ *
+ * Copies the range [\p first, \p last) to the range starting at \p d_first, like
+ * std::copy, but writes large outputs with non-temporal (Vc::Streaming) stores.
+ *
+ * Non-temporal stores bypass the cache hierarchy. They avoid reading the destination
+ * into the cache and evicting the working set of the calling and of neighbouring threads.
+ * They are used if the output is at least 4 MiB large; smaller outputs are written with
+ * regular stores, since they are likely still in cache when they are read next. The
+ * destination does not need to be aligned: the entries up to the first aligned address
+ * are written with regular stores. A store fence is issued before the function returns,
+ * so that the output is visible to other threads after any subsequent synchronization.
+ *
+ * The ranges must not overlap.
+ *
+ * \returns `d_first + (last - first)`
+ *
+ * \tparam T A vectorizable type (see Vc::Vector).
+ */
+template <class T>
+inline enable_if<std::is_arithmetic<T>::value, T *> stream_copy(const T *first,
+                                                                 const T *last, T *d_first)
+{
+    static_assert(Traits::is_valid_vector_argument<T>::value,
+                  "stream_copy requires a vectorizable type");
+    const std::size_t count = last - first;
+    if (count * sizeof(T) < Common::streaming_threshold) {
+        return std::copy(first, last, d_first);
+    }
+    Common::stream_store<Vector<T>>(d_first, count, [&](std::size_t i, std::size_t n) {
+        return Common::load_chunk<Vector<T>>(first + i, n);
+    });
+    return d_first + count;
+}
+
+// stream_fill {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/Memory>
+ *
+ * Assigns \p value to all entries in [\p first, \p last), like std::fill, but writes large
+ * outputs with non-temporal stores. See stream_copy for details.
+ *
+ * \tparam T A vectorizable type (see Vc::Vector).
+ */
+template <class T>
+inline enable_if<std::is_arithmetic<T>::value, void> stream_fill(T *first, T *last,
+                                                                 const T &value)
+{
+    static_assert(Traits::is_valid_vector_argument<T>::value,
+                  "stream_fill requires a vectorizable type");
+    const std::size_t count = last - first;
+    if (count * sizeof(T) < Common::streaming_threshold) {
+        std::fill(first, last, value);
+        return;
+    }
+    const Vector<T> v = value;
+    Common::stream_store<Vector<T>>(first, count,
+                                    [&](std::size_t, std::size_t) { return v; });
+}
+
+// stream_transform {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/Memory>
+ *
+ * Writes `f(x)` for all entries `x` in [\p first, \p last) to the range starting at
+ * \p d_first, like std::transform, but writes large outputs with non-temporal stores. See
+ * stream_copy for details.
+ *
+ * \p f is called with `Vc::Vector<T>` arguments. The entries of the last (and, for
+ * misaligned destinations, of the first) vector that lie outside the input range are
+ * zero and their results are discarded. The result is converted to vectors of \p U with
+ * simd_cast.
+ *
+ * \code
+ * void scale(const float *in, float *out, std::size_t n, float factor) {
+ *   Vc::stream_transform(in, in + n, out, [&](Vc::float_v x) { return x * factor; });
+ * }
+ * \endcode
+ *
+ * The ranges may be identical, but must not overlap otherwise.
+ *
+ * \returns `d_first + (last - first)`
+ *
+ * \tparam T A vectorizable type (see Vc::Vector).
+ * \tparam U A vectorizable type.
+ */
+template <class T, class U, class F>
+inline enable_if<std::is_arithmetic<T>::value, U *> stream_transform(const T *first,
+                                                                      const T *last,
+                                                                      U *d_first, F &&f)
+{
+    static_assert(Traits::is_valid_vector_argument<T>::value &&
+                      Traits::is_valid_vector_argument<U>::value,
+                  "stream_transform requires vectorizable types");
+    using W = Common::rebind_vector_type<Vector<T>, U>;
+    const std::size_t count = last - first;
+    Common::stream_store<W>(d_first, count, [&](std::size_t i, std::size_t n) {
+        return simd_cast<W>(f(Common::load_chunk<Vector<T>>(first + i, n)));
+    });
+    return d_first + count;
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_STREAMING_H_
+
+// vim: foldmethod=marker
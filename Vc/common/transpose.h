@@ -46,7 +46,8 @@ template <int LhsLength, size_t RhsLength> struct TransposeTag {
 };
 }  // namespace Common
 
-template <typename... Vs> Common::TransposeProxy<Vs...> transpose(Vs... vs)
+// the proxy refers to the arguments, which therefore must outlive the assignment
+template <typename... Vs> Common::TransposeProxy<Vs...> transpose(const Vs &... vs)
 {
     return {vs...};
 }
@@ -220,6 +220,60 @@ Vc_INTRINSIC void sincos(const Vector<T, Abi> &x,
 {
     Detail::Trig<T, Abi>::sincos(x, sin, cos);
 }
+
+/**
+ * \ingroup Math
+ * Returns the tangent of all input values in \p x.
+ *
+ * \param x The values to apply the tangent function on.
+ * \returns the tangent of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 4 ulp in the range
+ * [-8192, 8192].
+ * \note The double-precision implementation has an error of max. 3 ulp in the range
+ * [-8192, 8192].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> tan(const Vector<T, Abi> &x)
+{
+    Vector<T, Abi> s, c;
+    Detail::Trig<T, Abi>::sincos(x, &s, &c);
+    return s / c;
+}
+
+/**
+ * \ingroup Math
+ * Returns the arccosine of all input values in \p x.
+ *
+ * \param x The values to apply the arccosine function on.
+ * \returns the arccosine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp.
+ * \note The double-precision implementation has an error of max. 2 ulp.
+ */
+template <typename T, typename Abi>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> acos(const Vector<T, Abi> &x)
+{
+    using V = Vector<T, Abi>;
+    using M = typename V::Mask;
+    // π/2 split such that subtracting a small value from the high part is exact
+    const T pio2_hi = std::is_same<T, float>::value ? 1.5707962513e+00
+                                                    : 1.57079632679489655800e+00;
+    const T pio2_lo = std::is_same<T, float>::value ? 7.5497894159e-08
+                                                    : 6.12323399573676603587e-17;
+    const V ax = abs(x);
+    const M large = ax > T(0.5);
+    V z = x;
+    z(large) = sqrt((V::One() - ax) * T(0.5));
+    const V a = Detail::Trig<T, Abi>::asin(z);
+    // |x| ≤ ½: acos(x) = π/2 - asin(x)
+    V r = pio2_hi - (a - pio2_lo);
+    // x > ½: acos(x) = 2 asin(√((1 - x) / 2))
+    r(large) = a + a;
+    // x < -½: acos(x) = π - 2 asin(√((1 + x) / 2))
+    r(large && x < V::Zero()) = 2 * pio2_hi - ((a + a) - 2 * pio2_lo);
+    return r;
+}
 #endif
 }  // namespace Vc_VERSIONED_NAMESPACE
 
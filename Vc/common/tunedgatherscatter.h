@@ -0,0 +1,354 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_TUNEDGATHERSCATTER_H_
+#define VC_COMMON_TUNEDGATHERSCATTER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include "gathertuning.h"
+#include "scatterimplementation.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// strategy availability {{{1
+/**\internal
+ * BitScanLoop and PopcntSwitch need Mask::toInt, which requires BMI2 for 16 lanes on
+ * AVX2.
+ */
+template <class V>
+using HasMaskBits = std::integral_constant<bool,
+#if defined Vc_IMPL_AVX2 && !defined Vc_IMPL_BMI2
+                                           V::Size != 16
+#else
+                                           true
+#endif
+                                           >;
+
+/**\internal
+ * Whether the masked gather strategy \p I can be used for \p V with indexes of type
+ * \p IT.
+ */
+template <class V, class IT, GatherScatterImplementation I>
+struct GatherStrategySupported : public std::true_type {
+};
+template <class V, class IT>
+struct GatherStrategySupported<V, IT, GatherScatterImplementation::SetIndexZero>
+    : public Traits::is_simd_vector<IT> {
+};
+template <class V, class IT>
+struct GatherStrategySupported<V, IT, GatherScatterImplementation::BitScanLoop>
+    : public HasMaskBits<V> {
+};
+template <class V, class IT>
+struct GatherStrategySupported<V, IT, GatherScatterImplementation::PopcntSwitch>
+    : public std::integral_constant<bool, HasMaskBits<V>::value &&
+                                              (V::Size == 2 || V::Size == 4 ||
+                                               V::Size == 8 || V::Size == 16)> {
+};
+
+/**\internal
+ * Whether the masked scatter strategy \p I can be used for \p V.
+ */
+template <class V, GatherScatterImplementation I>
+struct ScatterStrategySupported
+    : public GatherStrategySupported<V, typename V::IndexType, I> {
+};
+template <class V>
+struct ScatterStrategySupported<V, GatherScatterImplementation::SetIndexZero>
+    : public std::false_type {
+};
+#ifndef Vc_GNU_ASM
+template <class V>
+struct ScatterStrategySupported<V, GatherScatterImplementation::BitScanLoop>
+    : public std::false_type {
+};
+#endif
+
+template <class I, class V, class MT, class IT>
+Vc_INTRINSIC void executeGatherIfSupported(std::true_type, I, V &v, const MT *mem,
+                                           const IT &indexes,
+                                           typename V::MaskArgument mask)
+{
+    executeGather(I(), v, mem, indexes, mask);
+}
+template <class I, class V, class MT, class IT>
+Vc_INTRINSIC void executeGatherIfSupported(std::false_type, I, V &v, const MT *mem,
+                                           const IT &indexes,
+                                           typename V::MaskArgument mask)
+{
+    executeGather(SimpleLoopT(), v, mem, indexes, mask);
+}
+template <class I, class V, class MT, class IT>
+Vc_INTRINSIC void executeScatterIfSupported(std::true_type, I, V &v, MT *mem,
+                                            const IT &indexes,
+                                            typename V::MaskArgument mask)
+{
+    executeScatter(I(), v, mem, indexes, mask);
+}
+template <class I, class V, class MT, class IT>
+Vc_INTRINSIC void executeScatterIfSupported(std::false_type, I, V &v, MT *mem,
+                                            const IT &indexes,
+                                            typename V::MaskArgument mask)
+{
+    executeScatter(SimpleLoopT(), v, mem, indexes, mask);
+}
+
+// calibration {{{1
+/**\internal
+ * Input data for the micro-benchmarks: a table that fits into L1, random indexes, and
+ * masks with 25%, 50%, 75%, and 100% active lanes in turn.
+ */
+template <class V> struct GatherCalibrationData {
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    using M = typename V::MaskType;
+    static constexpr std::size_t TableSize = 1024;
+    // long enough that the 5% threshold of fastestGatherStrategy exceeds the timer noise
+    static constexpr std::size_t Count = 4096;
+    static constexpr int Passes = 7;
+
+    GatherCalibrationData()
+        : table(new T[TableSize])
+        , indexes(new typename IT::EntryType[Count * V::Size])
+        , masks(new T[Count * V::Size])
+    {
+        std::minstd_rand rng;
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            table[i] = T(i);
+        }
+        for (std::size_t i = 0; i < Count * V::Size; ++i) {
+            indexes[i] = typename IT::EntryType(rng() % TableSize);
+            masks[i] = T(rng() % 4 <= (i / V::Size) % 4 ? 1 : 0);
+        }
+    }
+
+    IT index(std::size_t i) const { return IT(&indexes[i * V::Size], Vc::Unaligned); }
+    M mask(std::size_t i) const
+    {
+        return V(&masks[i * V::Size], Vc::Unaligned) != V::Zero();
+    }
+
+    std::unique_ptr<T[]> table;
+    std::unique_ptr<typename IT::EntryType[]> indexes;
+    std::unique_ptr<T[]> masks;  // 0 or 1 per lane
+    volatile T sink;
+};
+
+template <class F> double timeGatherStrategy(F &&f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+template <class V, class I>
+double timeMaskedGather(GatherCalibrationData<V> &, I, std::false_type)
+{
+    return 1e9;
+}
+template <class V, class I>
+double timeMaskedGather(GatherCalibrationData<V> &d, I impl, std::true_type)
+{
+    V sum = V::Zero();
+    const double t = timeGatherStrategy([&]() {
+        for (std::size_t i = 0; i < d.Count; ++i) {
+            V v = V::Zero();
+            executeGather(impl, v, d.table.get(), d.index(i), d.mask(i));
+            sum += v;
+        }
+    });
+    d.sink = sum.sum();
+    return t;
+}
+
+template <class V, class I>
+double timeMaskedScatter(GatherCalibrationData<V> &, I, std::false_type)
+{
+    return 1e9;
+}
+template <class V, class I>
+double timeMaskedScatter(GatherCalibrationData<V> &d, I impl, std::true_type)
+{
+    V v = V::IndexesFromZero();
+    const double t = timeGatherStrategy([&]() {
+        for (std::size_t i = 0; i < d.Count; ++i) {
+            executeScatter(impl, v, d.table.get(), d.index(i), d.mask(i));
+        }
+    });
+    d.sink = d.table[0];
+    return t;
+}
+
+/**\internal
+ * Returns the fastest of the \p best timings. SimpleLoop (index 0), the default, is only
+ * replaced by a strategy that is clearly faster.
+ */
+inline int fastestGatherStrategy(const double *best, int count)
+{
+    int chosen = 0;
+    for (int c = 1; c < count; ++c) {
+        if (best[c] < 0.95 * best[chosen]) {
+            chosen = c;
+        }
+    }
+    return chosen;
+}
+
+/**\internal
+ * Times the masked gather strategies for \p V and returns the fastest.
+ */
+template <class V> int calibrateMaskedGather()
+{
+    using I = GatherScatterImplementation;
+    using IT = typename V::IndexType;
+    GatherCalibrationData<V> d;
+    double best[4] = {1e9, 1e9, 1e9, 1e9};
+    // interleave the candidates, so that frequency changes affect all of them alike
+    for (int pass = 0; pass < d.Passes; ++pass) {
+        best[0] = std::min(best[0], timeMaskedGather(d, SimpleLoopT(), std::true_type()));
+        best[1] = std::min(
+            best[1], timeMaskedGather(d, SetIndexZeroT(),
+                                      GatherStrategySupported<V, IT, I::SetIndexZero>()));
+        best[2] = std::min(
+            best[2], timeMaskedGather(d, BitScanLoopT(),
+                                      GatherStrategySupported<V, IT, I::BitScanLoop>()));
+        best[3] = std::min(
+            best[3], timeMaskedGather(d, PopcntSwitchT(),
+                                      GatherStrategySupported<V, IT, I::PopcntSwitch>()));
+    }
+    return fastestGatherStrategy(best, 4);
+}
+
+/**\internal
+ * Times the masked scatter strategies for \p V and returns the fastest.
+ */
+template <class V> int calibrateMaskedScatter()
+{
+    using I = GatherScatterImplementation;
+    GatherCalibrationData<V> d;
+    double best[4] = {1e9, 1e9, 1e9, 1e9};
+    for (int pass = 0; pass < d.Passes; ++pass) {
+        best[0] =
+            std::min(best[0], timeMaskedScatter(d, SimpleLoopT(), std::true_type()));
+        best[2] = std::min(
+            best[2], timeMaskedScatter(d, BitScanLoopT(),
+                                       ScatterStrategySupported<V, I::BitScanLoop>()));
+        best[3] = std::min(
+            best[3], timeMaskedScatter(d, PopcntSwitchT(),
+                                       ScatterStrategySupported<V, I::PopcntSwitch>()));
+    }
+    return fastestGatherStrategy(best, 4);
+}
+
+// tuned dispatch {{{1
+template <class V> GatherScatterImplementation tunedMaskedGather()
+{
+    using Op = Vc::Detail::GatherTuningOperation;
+    static const GatherScatterImplementation impl =
+        static_cast<GatherScatterImplementation>(Vc::Detail::tuned_gather_implementation(
+            Vc::Detail::gatherTuningKey<V>(Op::MaskedGather), &calibrateMaskedGather<V>));
+    return impl;
+}
+
+template <class V> GatherScatterImplementation tunedMaskedScatter()
+{
+    using Op = Vc::Detail::GatherTuningOperation;
+    static const GatherScatterImplementation impl =
+        static_cast<GatherScatterImplementation>(Vc::Detail::tuned_gather_implementation(
+            Vc::Detail::gatherTuningKey<V>(Op::MaskedScatter),
+            &calibrateMaskedScatter<V>));
+    return impl;
+}
+
+/**\internal
+ * Executes the masked gather with the strategy calibrated for \p V. Strategies that are
+ * not available for the index type \p IT fall back to SimpleLoop.
+ */
+template <class V, class MT, class IT>
+Vc_ALWAYS_INLINE void executeTunedGather(V &v, const MT *mem, const IT &indexes,
+                                         typename V::MaskArgument mask)
+{
+    using I = GatherScatterImplementation;
+    switch (tunedMaskedGather<V>()) {
+    case I::SetIndexZero:
+        executeGatherIfSupported(GatherStrategySupported<V, IT, I::SetIndexZero>(),
+                                 SetIndexZeroT(), v, mem, indexes, mask);
+        break;
+    case I::BitScanLoop:
+        executeGatherIfSupported(GatherStrategySupported<V, IT, I::BitScanLoop>(),
+                                 BitScanLoopT(), v, mem, indexes, mask);
+        break;
+    case I::PopcntSwitch:
+        executeGatherIfSupported(GatherStrategySupported<V, IT, I::PopcntSwitch>(),
+                                 PopcntSwitchT(), v, mem, indexes, mask);
+        break;
+    default:
+        executeGather(SimpleLoopT(), v, mem, indexes, mask);
+        break;
+    }
+}
+
+/**\internal
+ * Executes the masked scatter with the strategy calibrated for \p V.
+ */
+template <class V, class MT, class IT>
+Vc_ALWAYS_INLINE void executeTunedScatter(V &v, MT *mem, const IT &indexes,
+                                          typename V::MaskArgument mask)
+{
+    using I = GatherScatterImplementation;
+    // scatterImplementation is const, thus V is deduced as a const type
+    using W = typename std::remove_const<V>::type;
+    switch (tunedMaskedScatter<W>()) {
+    case I::BitScanLoop:
+        executeScatterIfSupported(ScatterStrategySupported<W, I::BitScanLoop>(),
+                                  BitScanLoopT(), v, mem, indexes, mask);
+        break;
+    case I::PopcntSwitch:
+        executeScatterIfSupported(ScatterStrategySupported<W, I::PopcntSwitch>(),
+                                  PopcntSwitchT(), v, mem, indexes, mask);
+        break;
+    default:
+        executeScatter(SimpleLoopT(), v, mem, indexes, mask);
+        break;
+    }
+}
+// }}}1
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_TUNEDGATHERSCATTER_H_
+
+// vim: foldmethod=marker
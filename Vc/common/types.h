@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../global.h"
 #include "../traits/type_traits.h"
 #include "permutation.h"
+#include "float16.h"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -208,6 +208,10 @@ public:
      *
      * \note This function may use a very small amount of state and thus will be a weak
      * random number generator.
+     *
+     * \note The state is shared by all threads without synchronization. Use Xoshiro128
+     * and the distribution functions in <Vc/random> for multi-threaded code or if you
+     * need control over the seed.
      */
     static inline Vector Random();
 
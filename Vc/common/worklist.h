@@ -0,0 +1,218 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_WORKLIST_H_
+#define VC_COMMON_WORKLIST_H_
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+#include "iterators.h"
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// worklist_statistics {{{1
+/**
+ * \ingroup Simdize
+ * \headerfile worklist.h <Vc/simdize>
+ *
+ * Lane utilization of a simd_worklist run.
+ */
+struct worklist_statistics {
+    /// The number of vector iterations, i.e. calls to the step function.
+    std::size_t iterations = 0;
+    /// The sum over all iterations of the number of lanes that held an unfinished item.
+    std::size_t active_lanes = 0;
+    /// The number of work items, i.e. lanes that were (re)filled.
+    std::size_t items = 0;
+    /// The number of calls to the init function.
+    std::size_t refills = 0;
+    /// The vector width.
+    std::size_t lanes = 0;
+
+    /**
+     * The fraction of the executed lane iterations that worked on unfinished items: 1 if
+     * no lane ever idled.
+     */
+    double utilization() const
+    {
+        return iterations == 0 ? 1. : double(active_lanes) / double(iterations * lanes);
+    }
+};
+
+/**
+ * \ingroup Simdize
+ *
+ * The vector of work item indexes passed to the callbacks of simd_worklist for the state
+ * type \p V.
+ */
+template <class V> using worklist_index = SimdArray<int, V::size()>;
+
+namespace Common
+{
+// worklist_mask {{{1
+/**\internal
+ * Converts the item mask \p k to a mask for conditional assignment of \p V: the mask
+ * type of \p V for vectors. Simdized structures convert the mask per member.
+ */
+template <class V, class M>
+Vc_INTRINSIC typename V::mask_type worklist_mask(const M &k, std::true_type)
+{
+    return simd_cast<typename V::mask_type>(k);
+}
+template <class V, class M> Vc_INTRINSIC const M &worklist_mask(const M &k, std::false_type)
+{
+    return k;
+}
+template <class V, class M> Vc_INTRINSIC auto worklist_mask(const M &k)
+    -> decltype(worklist_mask<V>(k, Traits::is_simd_vector<V>()))
+{
+    return worklist_mask<V>(k, Traits::is_simd_vector<V>());
+}
+}  // namespace Common
+
+// simd_worklist {{{1
+/**
+ * \ingroup Simdize
+ * \headerfile worklist.h <Vc/simdize>
+ *
+ * Processes the work items `0, 1, ..., count - 1` with an iterative, divergent kernel,
+ * one item per lane of the state \p V, and refills finished lanes with new items.
+ *
+ * Looping over one vector of items until its slowest lane finishes leaves the other
+ * lanes idle. Instead, simd_worklist checks after every iteration which lanes finished,
+ * hands their results to \p finish, and loads the next items into these lanes with
+ * masked assignment. Lanes only idle once no items are left.
+ *
+ * \tparam V The per-lane state: a `simdize<State>` structure or a Vc vector type.
+ * \param count The number of work items. It must not exceed `INT_MAX`.
+ * \param init Called as `V init(const worklist_index<V> &items)`. Returns the initial
+ *             state for the given items. Only the lanes that are refilled are used.
+ * \param step Called as `mask step(V &state)`. Advances the state of all lanes by one
+ *             iteration and returns a mask (of \p V or worklist_index<V>) of the lanes
+ *             that need further iterations. Lanes that return \c false must leave their
+ *             state unmodified.
+ * \param finish Called as `finish(const V &state, const worklist_index<V> &items,
+ *               const worklist_index<V>::mask_type &done)` after every iteration in
+ *               which some lanes finished. \p done selects these lanes, \p items holds
+ *               their item indexes.
+ *
+ * \return The lane utilization statistics of the run.
+ *
+ * Lanes without an item (at the start if `count < V::size()`, and once the items run
+ * out) hold a copy of another valid item and are not reported to \p finish. Thus \p init
+ * and \p step never see out-of-range item indexes.
+ *
+ * Example:
+ * \code
+ * using State = simdize<std::tuple<float, float, int>>;  // z, c, iterations
+ * using Items = Vc::worklist_index<State>;
+ * auto stats = Vc::simd_worklist<State>(
+ *     n,
+ *     [&](const Items &i) {
+ *         State s;
+ *         std::get<1>(s) = float_v(&input[0], simd_cast<float_v::IndexType>(i));
+ *         std::get<0>(s) = std::get<1>(s);
+ *         std::get<2>(s) = 0;
+ *         return s;
+ *     },
+ *     [](State &s) {
+ *         auto &z = std::get<0>(s);
+ *         const float_m run = abs(z) < 100.f;
+ *         where(run) | z = z * z + std::get<1>(s);
+ *         std::get<2>(s)(simd_cast<int_m>(run)) += 1;
+ *         return run;
+ *     },
+ *     [&](const State &s, const Items &i, const Items::mask_type &done) {
+ *         for (int lane : where(done)) {
+ *             output[i[lane]] = std::get<2>(s)[lane];
+ *         }
+ *     });
+ * std::cout << stats.utilization();
+ * \endcode
+ */
+template <class V, class Init, class Step, class Finish>
+inline worklist_statistics simd_worklist(std::size_t count, Init &&init, Step &&step,
+                                         Finish &&finish)
+{
+    using IV = worklist_index<V>;
+    using IM = typename IV::mask_type;
+    constexpr std::size_t N = V::size();
+    Vc_ASSERT(count <= std::size_t(INT_MAX));
+
+    worklist_statistics stats;
+    stats.lanes = N;
+    if (count == 0) {
+        return stats;
+    }
+
+    // initial fill; lanes without an item duplicate the last item
+    const IV laneIndex = IV::IndexesFromZero();
+    IM active = laneIndex < int(count);
+    IV items = iif(active, laneIndex, IV(int(count) - 1));
+    std::size_t next = count < N ? count : N;
+    V state = init(items);
+    stats.items = next;
+    stats.refills = 1;
+
+    while (any_of(active)) {
+        const IM running = simd_cast<IM>(step(state)) && active;
+        ++stats.iterations;
+        stats.active_lanes += active.count();
+        const IM done = active && !running;
+        if (none_of(done)) {
+            continue;
+        }
+        finish(static_cast<const V &>(state), static_cast<const IV &>(items), done);
+
+        // hand out the next items to the finished lanes, in lane order
+        IM refill = done;
+        for (int lane : where(done)) {
+            if (next < count) {
+                items[lane] = int(next++);
+                ++stats.items;
+            } else {
+                refill[lane] = false;
+                active[lane] = false;
+            }
+        }
+        if (any_of(refill)) {
+            const V fresh = init(static_cast<const IV &>(items));
+            where(Common::worklist_mask<V>(refill)) | state = fresh;
+            ++stats.refills;
+        }
+    }
+    return stats;
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_WORKLIST_H_
+
+// vim: foldmethod=marker
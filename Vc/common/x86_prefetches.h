@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_COMMON_X86_PREFETCHES_H_
 
 #include <xmmintrin.h>
+#include "prefetch.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -84,7 +85,14 @@ Vc_INTRINSIC void prefetchFar(const void *addr)
 /*handlePrefetch/handleLoadPrefetches/handleStorePrefetches{{{*/
 namespace
 {
-template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<L1 != 0 && L2 != 0, void *>::type = nullptr)
+template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<L1 == LoadStoreFlags::CalibratedPrefetchStride, void *>::type = nullptr)
+{
+    const char *addr = static_cast<const char *>(addr_);
+    const size_t distance = Vc::Detail::prefetch_distance();
+    prefetchClose<typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + distance);
+    prefetchMid  <typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + 8 * distance);
+}
+template<size_t L1, size_t L2, bool UseExclusivePrefetch> Vc_INTRINSIC void handlePrefetch(const void *addr_, typename std::enable_if<L1 != 0 && L2 != 0 && L1 != LoadStoreFlags::CalibratedPrefetchStride, void *>::type = nullptr)
 {
     const char *addr = static_cast<const char *>(addr_);
     prefetchClose<typename std::conditional<UseExclusivePrefetch, Vc::Exclusive, Vc::Shared>::type>(addr + L1);
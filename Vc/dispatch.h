@@ -0,0 +1,184 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DISPATCH_H_
+#define VC_DISPATCH_H_
+
+#include "global.h"
+#include "support.h"
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include "common/macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Returns the index into \p impls of the implementation that should be used on the
+ * current system: the highest implementation in the list that is supported by CPU and OS
+ * and does not exceed the implementation requested via the \c VC_IMPL environment
+ * variable. Returns -1 if none of the listed implementations can run.
+ *
+ * This function is implemented in libVc and uses CpuId.
+ */
+int selectImplementation(const Implementation *impls, std::size_t count);
+
+template <Implementation First, Implementation...> struct first_implementation {
+    static constexpr Implementation value = First;
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch.h>
+ *
+ * Runtime selection of a kernel that was compiled for several %Vc implementations.
+ *
+ * A kernel is a class template over Vc::Implementation with a static member function \c
+ * run. Its declaration (without definition of \c run) goes into a header:
+ * \code
+ * template <Vc::Implementation Impl> struct Saxpy {
+ *     static void run(float a, const float *x, float *y, std::size_t n);
+ * };
+ * \endcode
+ * The kernel source defines \c run once for the implementation of its translation unit:
+ * \code
+ * template <>
+ * void Saxpy<Vc::CurrentImplementation::current()>::run(float a, const float *x,
+ *                                                          float *y, std::size_t n)
+ * { ... float_v ... }
+ * \endcode
+ * and is compiled once per implementation, e.g. with the CMake macro
+ * \code
+ * vc_compile_for_all_implementations(srcs saxpy.cpp ONLY SSE2 AVX AVX2+FMA+BMI2)
+ * \endcode
+ * The caller, typically compiled for the baseline instruction set, then uses
+ * \code
+ * using SaxpyDispatch = Vc::Dispatch<Saxpy, Vc::AVX2Impl, Vc::AVXImpl, Vc::SSE2Impl>;
+ * SaxpyDispatch::call(a, x, y, n);
+ * \endcode
+ *
+ * The first call resolves the best supported implementation (see
+ * isImplementationSupported) and caches the function pointer; subsequent calls are a
+ * single indirect call. \c AVX2Impl is only selected if the CPU also supports FMA and
+ * BMI2, matching the \c AVX2+FMA+BMI2 target of \c vc_compile_for_all_implementations.
+ *
+ * Setting the environment variable \c VC_IMPL to one of \c Scalar, \c SSE2, \c SSE3, \c
+ * SSSE3, \c SSE4_1, \c SSE4_2, \c AVX, or \c AVX2 limits the selection to
+ * implementations up to (and including) the given one. This is useful for testing all
+ * code paths on a single machine.
+ *
+ * The list of implementations should contain one entry every targeted system can
+ * execute (\c ScalarImpl or \c SSE2Impl). If none of them is supported, the last entry
+ * of the list is used.
+ *
+ * \tparam Kernel The class template providing the static \c run function.
+ * \tparam Impls The list of implementations \p Kernel was compiled for.
+ */
+template <template <Implementation> class Kernel, Implementation... Impls> class Dispatch
+{
+    static_assert(sizeof...(Impls) > 0,
+                  "Vc::Dispatch requires at least one implementation to dispatch to.");
+    static constexpr Implementation First = Detail::first_implementation<Impls...>::value;
+
+public:
+    /// The type of the function pointer to the selected \c Kernel<Impl>::run function.
+    using pointer = decltype(&Kernel<First>::run);
+
+    /**
+     * Calls the \c run function of the selected implementation, forwarding all arguments.
+     */
+    template <class... Args>
+    static Vc_ALWAYS_INLINE auto call(Args &&... args)
+        -> decltype(std::declval<pointer>()(std::forward<Args>(args)...))
+    {
+        return get()(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Returns the function pointer to the selected implementation. Resolves the
+     * selection on first use.
+     */
+    static Vc_ALWAYS_INLINE pointer get()
+    {
+        pointer f = cache().load(std::memory_order_acquire);
+        if (Vc_IS_UNLIKELY(f == nullptr)) {
+            f = resolve();
+        }
+        return f;
+    }
+
+    /**
+     * Returns the implementation that get() and call() dispatch to.
+     */
+    static Implementation selected()
+    {
+        get();
+        return implementations()[index().load(std::memory_order_acquire)];
+    }
+
+    /**
+     * Determines the implementation to use (again) and returns the resulting function
+     * pointer. Call this after modifying the \c VC_IMPL environment variable at runtime.
+     */
+    static pointer resolve()
+    {
+        static const pointer functions[] = {&Kernel<Impls>::run...};
+        int i = Detail::selectImplementation(implementations(), sizeof...(Impls));
+        if (i < 0) {
+            i = sizeof...(Impls) - 1;
+        }
+        index().store(i, std::memory_order_release);
+        cache().store(functions[i], std::memory_order_release);
+        return functions[i];
+    }
+
+private:
+    static const Implementation *implementations()
+    {
+        static const Implementation list[] = {Impls...};
+        return list;
+    }
+    static std::atomic<pointer> &cache()
+    {
+        static std::atomic<pointer> f{nullptr};
+        return f;
+    }
+    static std::atomic<int> &index()
+    {
+        static std::atomic<int> i{0};
+        return i;
+    }
+};
+
+}  // namespace Vc
+
+#endif  // VC_DISPATCH_H_
+
+// vim: foldmethod=marker
@@ -70,6 +70,12 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v copysign(Scalar::double_v mag,
         return Scalar::V(std::max(x.data(), y.data()));                                  \
     }
 Vc_ALL_VECTOR_TYPES(Vc_MINMAX);
+Vc_MINMAX(llong_v);
+Vc_MINMAX(ullong_v);
+Vc_MINMAX(long_v);
+Vc_MINMAX(ulong_v);
+Vc_MINMAX(schar_v);
+Vc_MINMAX(uchar_v);
 #undef Vc_MINMAX
 
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sqrt (const Scalar::Vector<T> &x)
@@ -84,8 +90,11 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> rsqrt(const Scala
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
+                               std::is_same<T, signed char>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, long long>::value ||
+                               std::is_same<T, long>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<T> abs(Scalar::Vector<T> x)
 {
     return std::abs(x.data());
@@ -125,11 +134,21 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> asin (const Scala
     return Scalar::Vector<T>(std::asin(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> acos (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::acos(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cos  (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::cos(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tan  (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tan(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log  (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::log(x.data()));
@@ -145,11 +164,31 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log2(const Scalar
     return Scalar::Vector<T>(std::log2(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log1p(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::log1p(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::exp(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp2 (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::exp2(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp10(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::pow(T(10), x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> expm1(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::expm1(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::atan( x.data() ));
@@ -160,6 +199,41 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan2(const Scala
     return Scalar::Vector<T>(std::atan2( x.data(), y.data() ));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sinh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::sinh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cosh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cosh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tanh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tanh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> pow  (const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::pow( x.data(), y.data() ));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cbrt (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cbrt(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erf  (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erf(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erfc (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erfc(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> trunc(const Scalar::Vector<T> &x)
 {
     return std::trunc(x.data());
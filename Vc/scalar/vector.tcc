@@ -62,6 +62,18 @@ load_concept<U, Flags>::type Vector<T, VectorAbi::Scalar>::load(const U *mem, Fl
 {
     m_data = mem[0];
 }
+template <typename T>
+template <typename U, typename Flags>
+Vc_INTRINSIC typename Vector<T, VectorAbi::Scalar>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<U, Flags>::type Vector<T, VectorAbi::Scalar>::load(const U *mem, MaskArgument mask, Flags)
+{
+    if (mask.data()) {
+        m_data = mem[0];
+    }
+}
 
 // store member functions{{{1
 template <typename T>
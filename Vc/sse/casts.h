@@ -40,6 +40,9 @@ using uint = unsigned int;
 using ushort = unsigned short;
 using uchar = unsigned char;
 using schar = signed char;
+using llong = long long;
+using ullong = unsigned long long;
+using ulong = unsigned long;
 
 // sse_cast {{{1
 template <typename To, typename From> Vc_ALWAYS_INLINE Vc_CONST To sse_cast(From v)
@@ -57,11 +60,23 @@ template<> Vc_ALWAYS_INLINE Vc_CONST __m128d sse_cast<__m128d, __m128 >(__m128
 template <typename From, typename To> struct ConvertTag
 {
 };
+/**\internal
+ * Maps \c long and \c unsigned \c long to the fundamental type of equal size, so that
+ * the ConvertTag overloads below only need to be written for \c llong and \c ullong.
+ */
+template <typename T> struct convert_canonical { using type = T; };
+template <> struct convert_canonical<long> {
+    using type = typename std::conditional<sizeof(long) == 8, llong, int>::type;
+};
+template <> struct convert_canonical<ulong> {
+    using type = typename std::conditional<sizeof(long) == 8, ullong, uint>::type;
+};
 template <typename From, typename To>
 Vc_INTRINSIC typename VectorTraits<To>::VectorType convert(
     typename VectorTraits<From>::VectorType v)
 {
-    return convert(v, ConvertTag<From, To>());
+    return convert(v, ConvertTag<typename convert_canonical<From>::type,
+                                 typename convert_canonical<To>::type>());
 }
 
 Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , int   >) { return _mm_cvttps_epi32(v); }
@@ -139,6 +154,125 @@ Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ushort>) { return v;
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, ushort>()); }
 
+// 64-bit integer conversions {{{1
+// to and from the low two entries of the narrower integer types
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , llong >) {
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_cvtepi32_epi64(v);
+#else
+    return _mm_unpacklo_epi32(v, _mm_srai_epi32(v, 31));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , llong >) { return _mm_unpacklo_epi32(v, _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , llong >) { return convert(convert(v, ConvertTag<short, int>()), ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, llong >) { return convert(convert(v, ConvertTag<ushort, int>()), ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , ullong>) { return convert(v, ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , ullong>) { return convert(v, ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ullong>) { return convert(v, ConvertTag<short, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ullong>) { return convert(v, ConvertTag<ushort, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, int   >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , short >) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, short >) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ushort>) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, ushort>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ushort>) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, ushort>()); }
+
+// 64-bit integers to double: exact (correctly rounded) via the 2^52/2^84 magic numbers
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<ullong, double>) {
+    // hi: 2^84 + (v >> 32) * 2^32, lo: 2^52 + (v & 0xffffffff); hi - (2^84 + 2^52) is
+    // exact, the final addition rounds once
+    const __m128i hi = _mm_or_si128(_mm_srli_epi64(v, 32),
+                                    _mm_set1_epi64x(0x4530000000000000ll));
+    const __m128i lo =
+        _mm_or_si128(_mm_and_si128(v, _mm_set1_epi64x(0xffffffffll)),
+                     _mm_set1_epi64x(0x4330000000000000ll));
+    return _mm_add_pd(_mm_sub_pd(_mm_castsi128_pd(hi), _mm_set1_pd(19342813118337666422669312.)),
+                      _mm_castsi128_pd(lo));
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<llong , double>) {
+    // bias by 2^63 to make the input unsigned, then subtract the bias as part of the
+    // exact subtraction
+    const __m128i hi =
+        _mm_or_si128(_mm_srli_epi64(_mm_xor_si128(v, setmin_epi64()), 32),
+                     _mm_set1_epi64x(0x4530000000000000ll));
+    const __m128i lo =
+        _mm_or_si128(_mm_and_si128(v, _mm_set1_epi64x(0xffffffffll)),
+                     _mm_set1_epi64x(0x4330000000000000ll));
+    return _mm_add_pd(_mm_sub_pd(_mm_castsi128_pd(hi), _mm_set1_pd(19342822341709703277445120.)),
+                      _mm_castsi128_pd(lo));
+}
+// there are no SSE instructions for the remaining conversions; convert per entry to
+// get the same rounding and range behavior as the scalar conversions
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, llong >) {
+    return _mm_set_epi64x(llong(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))), llong(_mm_cvtsd_f64(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ullong>) {
+    return _mm_set_epi64x(ullong(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))), ullong(_mm_cvtsd_f64(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , llong >) { return convert(_mm_cvtps_pd(v), ConvertTag<double, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , ullong>) { return convert(_mm_cvtps_pd(v), ConvertTag<double, ullong>()); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<llong , float >) {
+    return _mm_setr_ps(float(llong(_mm_cvtsi128_si64(v))),
+                       float(llong(_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v)))), 0.f, 0.f);
+}
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<ullong, float >) {
+    return _mm_setr_ps(float(ullong(_mm_cvtsi128_si64(v))),
+                       float(ullong(_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v)))), 0.f, 0.f);
+}
+
+// 8-bit integer conversions {{{1
+// widening reads the low entries; narrowing truncates like the scalar conversion and
+// zeroes the unused high entries
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uchar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uchar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , short >) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , short >) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , ushort>) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , ushort>) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , int   >) { return cvtepi8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , int   >) { return cvtepu8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uint  >) { return cvtepi8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uint  >) { return cvtepu8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , llong >) { return convert(cvtepi8_epi32(v), ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , llong >) { return convert(cvtepu8_epi32(v), ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , ullong>) { return convert(cvtepi8_epi32(v), ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , ullong>) { return convert(cvtepu8_epi32(v), ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<schar , float >) { return _mm_cvtepi32_ps(cvtepi8_epi32(v)); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<uchar , float >) { return _mm_cvtepi32_ps(cvtepu8_epi32(v)); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<schar , double>) { return _mm_cvtepi32_pd(cvtepi8_epi32(v)); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<uchar , double>) { return _mm_cvtepi32_pd(cvtepu8_epi32(v)); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , uchar >) {
+    return _mm_packus_epi16(_mm_and_si128(v, _mm_set1_epi16(0xff)), _mm_setzero_si128());
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, uchar >) { return convert(v, ConvertTag<short, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , uchar >) {
+    // the masked values are positive and fit into 16 bits, so neither pack saturates
+    return _mm_packus_epi16(
+        _mm_packs_epi32(_mm_and_si128(v, _mm_set1_epi32(0xff)), _mm_setzero_si128()),
+        _mm_setzero_si128());
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , uchar >) { return convert(v, ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uchar >) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uchar >) { return convert(convert(v, ConvertTag<llong, int>()), ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , uchar >) { return convert(_mm_cvttps_epi32(v), ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, uchar >) { return convert(_mm_cvttpd_epi32(v), ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , schar >) { return convert(v, ConvertTag<short, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, schar >) { return convert(v, ConvertTag<short, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , schar >) { return convert(v, ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , schar >) { return convert(v, ConvertTag<int, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , schar >) { return convert(v, ConvertTag<llong, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, schar >) { return convert(v, ConvertTag<llong, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , schar >) { return convert(v, ConvertTag<float, uchar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, schar >) { return convert(v, ConvertTag<double, uchar>()); }
+
 // }}}1
 }  // namespace SSE
 }  // namespace Vc
@@ -58,6 +58,16 @@ struct c_general
     alignas(16) static const unsigned long long frexpMask[2];
 };
 
+struct c_compress
+{
+    alignas(64) static const unsigned char compress2[4][16];
+    alignas(64) static const unsigned char compress4[16][16];
+    alignas(64) static const unsigned char compress8[256][16];
+    alignas(64) static const unsigned char expand2[4][16];
+    alignas(64) static const unsigned char expand4[16][16];
+    alignas(64) static const unsigned char expand8[256][16];
+};
+
 template<typename T> struct c_trig
 {
     alignas(64) static const T data[];
@@ -329,6 +329,11 @@ Vc_INTRINSIC __m128 load(const T *mem, Flags f, LoadTag<__m128, float>)
 {
     return _mm_cvtepi32_ps(load<__m128i, int>(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const float16 *mem, Flags, LoadTag<__m128, float>)
+{
+    return SseIntrinsics::cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)));
+}
 
 // shifted{{{1
 template <int amount, typename T>
@@ -426,6 +431,13 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 8, __m128>(__m128i k)
         _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
 }
 
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(SSE::sse_cast<__m128i>(mask_cast<2, 8, __m128>(k)),
+                        _mm_setzero_si128()));
+}
+
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 2, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_unpacklo_epi32(k, k));
@@ -435,6 +447,16 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 8, __m128>(__m128i k)
     return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
 }
 
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
+}
+
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
+}
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 2, __m128>(__m128i k)
 {
     const auto tmp = _mm_unpacklo_epi16(k, k);
@@ -497,6 +519,18 @@ Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::
     return _mm_sub_epi16(_mm_setzero_si128(), v);
 #endif
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 1>)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_sign_epi8(v, allone<__m128i>());
+#else
+    return _mm_sub_epi8(_mm_setzero_si128(), v);
+#endif
+}
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_sub_epi64(_mm_setzero_si128(), v);
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m128 xor_(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
@@ -532,6 +566,10 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a,
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ushort) { return _mm_add_epi16(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  schar) { return _mm_add_epi8 (a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  llong) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ullong) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,   long) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  ulong) { return _mm_add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
@@ -542,6 +580,10 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a,
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ushort) { return _mm_sub_epi16(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  schar) { return _mm_sub_epi8 (a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  llong) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ullong) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,   long) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  ulong) { return _mm_sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
@@ -567,7 +609,7 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  schar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
@@ -578,10 +620,14 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  llong) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b, ullong) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,   long) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  ulong) { return SSE::mullo_epi64(a, b); }
 
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
@@ -606,6 +652,10 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a,
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ushort) { return SSE::min_epu16(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  schar) { return SSE::min_epi8 (a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  llong) { return SSE::min_epi64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ullong) { return SSE::min_epu64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,   long) { return SSE::min_epi64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  ulong) { return SSE::min_epu64(a, b); }
 
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
@@ -616,6 +666,10 @@ Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a,
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ushort) { return SSE::max_epu16(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  schar) { return SSE::max_epi8 (a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  uchar) { return _mm_max_epu8 (a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  llong) { return SSE::max_epi64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ullong) { return SSE::max_epu64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,   long) { return SSE::max_epi64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  ulong) { return SSE::max_epu64(a, b); }
 
 // horizontal add{{{1
 Vc_INTRINSIC  float add(__m128  a,  float) {
@@ -648,6 +702,12 @@ Vc_INTRINSIC  schar add(__m128i a,  schar) {
     return _mm_cvtsi128_si32(a);  // & 0xff is implicit
 }
 Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return add(a, schar()); }
+Vc_INTRINSIC  llong add(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong add(__m128i a, ullong) { return add(a, llong()); }
+Vc_INTRINSIC   long add(__m128i a,   long) { return add(a, llong()); }
+Vc_INTRINSIC  ulong add(__m128i a,  ulong) { return add(a, llong()); }
 
 // horizontal mul{{{1
 Vc_INTRINSIC  float mul(__m128  a,  float) {
@@ -673,12 +733,19 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
 }
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
 Vc_INTRINSIC  schar mul(__m128i a,  schar) {
-    // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
-    return mul(mul(s0, s1, short()), short());
+    a = mul(a, _mm_srli_si128(a, 8), schar());
+    a = mul(a, _mm_srli_si128(a, 4), schar());
+    a = mul(a, _mm_srli_si128(a, 2), schar());
+    a = mul(a, _mm_srli_si128(a, 1), schar());
+    return _mm_cvtsi128_si32(a);  // & 0xff is implicit
 }
 Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
+Vc_INTRINSIC  llong mul(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong mul(__m128i a, ullong) { return mul(a, llong()); }
+Vc_INTRINSIC   long mul(__m128i a,   long) { return mul(a, llong()); }
+Vc_INTRINSIC  ulong mul(__m128i a,  ulong) { return mul(a, llong()); }
 
 // horizontal min{{{1
 Vc_INTRINSIC  float min(__m128  a,  float) {
@@ -719,11 +786,19 @@ Vc_INTRINSIC  schar min(__m128i a,  schar) {
     return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+Vc_INTRINSIC  llong min(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong min(__m128i a, ullong) {
+    return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
+Vc_INTRINSIC   long min(__m128i a,   long) { return min(a, llong()); }
+Vc_INTRINSIC  ulong min(__m128i a,  ulong) { return min(a, ullong()); }
 
 // horizontal max{{{1
 Vc_INTRINSIC  float max(__m128  a,  float) {
@@ -764,11 +839,19 @@ Vc_INTRINSIC  schar max(__m128i a,  schar) {
     return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+Vc_INTRINSIC  llong max(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong max(__m128i a, ullong) {
+    return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
+Vc_INTRINSIC   long max(__m128i a,   long) { return max(a, llong()); }
+Vc_INTRINSIC  ulong max(__m128i a,  ulong) { return max(a, ullong()); }
 
 // sorted{{{1
 template <Vc::Implementation, typename T>
@@ -813,6 +896,22 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 16), V> rotated(V v, int am
         return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(6 * sizeof(T))));
     case 7:
         return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(7 * sizeof(T))));
+    case 8:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(8 * sizeof(T))));
+    case 9:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(9 * sizeof(T))));
+    case 10:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(10 * sizeof(T))));
+    case 11:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(11 * sizeof(T))));
+    case 12:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(12 * sizeof(T))));
+    case 13:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(13 * sizeof(T))));
+    case 14:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(14 * sizeof(T))));
+    case 15:
+        return sse_cast<V>(_mm_alignr_epi8(v, v, sanitize<V>(15 * sizeof(T))));
     }
     return sse_cast<V>(_mm_setzero_si128());
 }
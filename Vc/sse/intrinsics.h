@@ -107,6 +107,7 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu32(__m128i a, __m128i b) { return _mm_comgt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return _mm_comlt_epu64(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b) { return _mm_comgt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b) { return _mm_comgt_epi64(a, b); }
 #else
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b)
     {
@@ -597,6 +598,78 @@ namespace SseIntrinsics
 }  // namespace Vc
 #endif
 
+// 64-bit integer helpers
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace SseIntrinsics
+{
+    Vc_INTRINSIC Vc_CONST __m128i max_epi64(__m128i a, __m128i b) {
+        return blendv_epi8(b, a, cmpgt_epi64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i max_epu64(__m128i a, __m128i b) {
+        return blendv_epi8(b, a, cmpgt_epu64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i min_epi64(__m128i a, __m128i b) {
+        return blendv_epi8(a, b, cmpgt_epi64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i min_epu64(__m128i a, __m128i b) {
+        return blendv_epi8(a, b, cmpgt_epu64(a, b));
+    }
+    // all bits set in the 64-bit entries of a that are negative
+    Vc_INTRINSIC Vc_CONST __m128i signmask_epi64(__m128i a) {
+        return _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+    }
+    // there is no psraq before AVX-512: shifting the one's complement of negative entries
+    // logically and complementing again shifts in the sign bit
+    Vc_INTRINSIC Vc_CONST __m128i sra_epi64(__m128i a, int shift) {
+        const __m128i sign = signmask_epi64(a);
+        return _mm_xor_si128(_mm_srl_epi64(_mm_xor_si128(a, sign), _mm_cvtsi32_si128(shift)),
+                             sign);
+    }
+    Vc_INTRINSIC Vc_CONST __m128i abs_epi64(__m128i a) {
+        const __m128i sign = signmask_epi64(a);
+        return _mm_sub_epi64(_mm_xor_si128(a, sign), sign);
+    }
+    // a * b = lo(a) lo(b) + (hi(a) lo(b) + lo(a) hi(b)) << 32 (mod 2^64)
+    Vc_INTRINSIC Vc_CONST __m128i mullo_epi64(__m128i a, __m128i b) {
+        const __m128i lolo = _mm_mul_epu32(a, b);
+        const __m128i hilo = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+        const __m128i lohi = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));
+        return _mm_add_epi64(lolo, _mm_slli_epi64(_mm_add_epi64(hilo, lohi), 32));
+    }
+}  // namespace SseIntrinsics
+}  // namespace Vc
+
+// 8-bit integer helpers
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace SseIntrinsics
+{
+    // there are no 8-bit shifts: shift 16-bit entries and clear the bits that crossed
+    // into the neighboring byte
+    Vc_INTRINSIC Vc_CONST __m128i sll_epi8(__m128i a, int shift) {
+        return _mm_and_si128(_mm_sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                             _mm_set1_epi8(static_cast<char>(0xff << shift)));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i srl_epi8(__m128i a, int shift) {
+        return _mm_and_si128(_mm_srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                             _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+    }
+    // sign-extends the logically shifted value: (x ^ m) - m with m the shifted sign bit
+    Vc_INTRINSIC Vc_CONST __m128i sra_epi8(__m128i a, int shift) {
+        const __m128i m = _mm_set1_epi8(static_cast<char>(0x80 >> shift));
+        return _mm_sub_epi8(_mm_xor_si128(srl_epi8(a, shift), m), m);
+    }
+    // multiplies the even and the odd bytes as 16-bit entries and merges the low bytes
+    Vc_INTRINSIC Vc_CONST __m128i mullo_epi8(__m128i a, __m128i b) {
+        const __m128i even = _mm_mullo_epi16(a, b);
+        const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+        return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0xff)),
+                            _mm_slli_epi16(odd, 8));
+    }
+}  // namespace SseIntrinsics
+}  // namespace Vc
+
 // SSE4.2
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -695,11 +768,91 @@ namespace SseIntrinsics
     static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned char *mem) {
         return _mm_stream_load(reinterpret_cast<const int *>(mem));
     }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const long long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned long long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+
+    // binary16 <-> binary32 conversion of the 4 halves in the low 64 bits
+    // The integer fallbacks are bit-exact with vcvtph2ps / vcvtps2ph (round to nearest
+    // even), see Common::float16_to_float and Common::float_to_float16.
+#ifdef Vc_IMPL_F16C
+    Vc_INTRINSIC Vc_CONST __m128 cvtph_ps(__m128i h) { return _mm_cvtph_ps(h); }
+    Vc_INTRINSIC Vc_CONST __m128i cvtps_ph(__m128 x)
+    {
+        return _mm_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+    }
+#else
+    Vc_INTRINSIC Vc_CONST __m128 cvtph_ps(__m128i h)
+    {
+        const __m128i h32 = cvtepu16_epi32(h);
+        const __m128i em = _mm_and_si128(h32, _mm_set1_epi32(0x7fff));
+        const __m128i exp = _mm_and_si128(h32, _mm_set1_epi32(0x7c00));
+        const __m128i infnan = _mm_cmpeq_epi32(exp, _mm_set1_epi32(0x7c00));
+        const __m128i nan = _mm_cmpgt_epi32(em, _mm_set1_epi32(0x7c00));
+        // rebias the exponent by 127 - 15, and once more for inf/NaN
+        __m128i bits = _mm_add_epi32(_mm_slli_epi32(em, 13), _mm_set1_epi32(112 << 23));
+        bits = _mm_add_epi32(bits, _mm_and_si128(infnan, _mm_set1_epi32(112 << 23)));
+        bits = _mm_or_si128(bits, _mm_and_si128(nan, _mm_set1_epi32(0x00400000)));
+        // zero and subnormals: renormalize via a float subtraction of 2⁻¹⁴
+        const __m128i denorm = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+        const __m128i renorm = _mm_castps_si128(
+            _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))),
+                       _mm_set1_ps(6.103515625e-05f)));
+        bits = _mm_or_si128(_mm_andnot_si128(denorm, bits), _mm_and_si128(denorm, renorm));
+        const __m128i sign = _mm_slli_epi32(_mm_and_si128(h32, _mm_set1_epi32(0x8000)), 16);
+        return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i cvtps_ph(__m128 x)
+    {
+        const __m128i bits = _mm_castps_si128(x);
+        const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(int(0x80000000u)));
+        const __m128i abs = _mm_xor_si128(bits, sign);
+        const __m128i mantissa = _mm_srli_epi32(abs, 13);
+        // |x| >= 2¹⁶: inf, or NaN with the payload truncated and the quiet bit set
+        const __m128i overflow = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477fffff));
+        const __m128i nan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7f800000));
+        const __m128i big = _mm_or_si128(
+            _mm_set1_epi32(0x7c00),
+            _mm_and_si128(nan, _mm_or_si128(_mm_set1_epi32(0x0200),
+                                            _mm_and_si128(mantissa, _mm_set1_epi32(0x3ff)))));
+        // |x| < 2⁻¹⁴: adding 0.5 shifts the subnormal mantissa to the lowest bits
+        const __m128i small = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+        const __m128i subnormal = _mm_sub_epi32(
+            _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(abs), _mm_set1_ps(0.5f))),
+            _mm_set1_epi32(0x3f000000));
+        // normals: rebias the exponent and round to nearest even
+        const __m128i normal = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(abs, _mm_set1_epi32(int(0xc8000fffu))),
+                          _mm_and_si128(mantissa, _mm_set1_epi32(1))),
+            13);
+        __m128i h = _mm_or_si128(_mm_andnot_si128(small, normal),
+                                 _mm_and_si128(small, subnormal));
+        h = _mm_or_si128(_mm_andnot_si128(overflow, h), _mm_and_si128(overflow, big));
+        h = _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+        // sign-extend the 16-bit results so that the saturating pack keeps them intact
+        h = _mm_srai_epi32(_mm_slli_epi32(h, 16), 16);
+        return _mm_packs_epi32(h, _mm_setzero_si128());
+    }
+#endif
 
 #ifndef __x86_64__
     Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
         return _mm_castpd_si128(_mm_load_sd(reinterpret_cast<const double *>(&x)));
     }
+    Vc_INTRINSIC Vc_CONST int64_t _mm_cvtsi128_si64(__m128i x) {
+        int64_t r;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&r), x);
+        return r;
+    }
 #endif
 
 }  // namespace SseIntrinsics
@@ -82,6 +82,78 @@ template<> struct numeric_limits< ::Vc::SSE::int_v> : public numeric_limits<int>
     static Vc_INTRINSIC Vc_CONST ::Vc::SSE::int_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::int_v::Zero(); }
     static Vc_INTRINSIC Vc_CONST ::Vc::SSE::int_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::int_v::Zero(); }
 };
+template<> struct numeric_limits< ::Vc::SSE::ullong_v> : public numeric_limits<unsigned long long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v max()           Vc_NOEXCEPT { return ::Vc::SSE::_mm_setallone_si128(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v min()           Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::llong_v> : public numeric_limits<long long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v max()           Vc_NOEXCEPT { return _mm_srli_epi64(::Vc::SSE::_mm_setallone_si128(), 1); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v min()           Vc_NOEXCEPT { return ::Vc::SSE::setmin_epi64(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::ulong_v> : public numeric_limits<unsigned long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v max()           Vc_NOEXCEPT { return ::Vc::SSE::_mm_setallone_si128(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v min()           Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ulong_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::ulong_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::long_v> : public numeric_limits<long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v max()           Vc_NOEXCEPT { return _mm_srli_epi64(::Vc::SSE::_mm_setallone_si128(), 1); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v min()           Vc_NOEXCEPT { return ::Vc::SSE::setmin_epi64(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::long_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::long_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::long_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::long_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::long_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::long_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::long_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::uchar_v> : public numeric_limits<unsigned char>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v max()           Vc_NOEXCEPT { return ::Vc::SSE::_mm_setallone_si128(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v min()           Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::schar_v> : public numeric_limits<signed char>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v max()           Vc_NOEXCEPT { return _mm_set1_epi8(0x7f); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v min()           Vc_NOEXCEPT { return ::Vc::SSE::setmin_epi8(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+};
 } // namespace std
 
 #endif // VC_SSE_LIMITS_H_
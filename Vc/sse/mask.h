@@ -58,6 +58,12 @@ template <typename T> class Mask<T, VectorAbi::Sse>
     friend class Mask<uint32_t, abi>;
     friend class Mask< int16_t, abi>;
     friend class Mask<uint16_t, abi>;
+    friend class Mask<   llong, abi>;
+    friend class Mask<  ullong, abi>;
+    friend class Mask<    long, abi>;
+    friend class Mask<   ulong, abi>;
+    friend class Mask<   schar, abi>;
+    friend class Mask<   uchar, abi>;
 
     /**
      * A helper type for aliasing the entries in the mask but behaving like a bool.
@@ -725,6 +725,237 @@ Vc_INTRINSIC Vc_CONST To
     return static_cast<To>(x[0]);
 }
 
+// 64-bit integer Vector casts {{{2
+namespace Detail
+{
+/**\internal
+ * Whether a simd_cast from \p From to \p Return involves a 64-bit integer SSE::Vector.
+ * These casts are implemented generically on top of SSE::convert instead of one
+ * overload per type pair.
+ */
+template <typename Return, typename From> struct is_sse_int64_cast : std::false_type {};
+template <typename T, typename U>
+struct is_sse_int64_cast<SSE::Vector<T>, SSE::Vector<U>>
+    : public std::integral_constant<
+          bool, !std::is_same<T, U>::value &&
+                    ((std::is_integral<T>::value && sizeof(T) == 8) ||
+                     (std::is_integral<U>::value && sizeof(U) == 8))> {
+};
+
+template <typename Return>
+Vc_INTRINSIC void cast_entries(typename Return::EntryType *, std::size_t)
+{
+}
+/**\internal
+ * Converts the entries of \p x, \p xs... one by one into \p mem, starting at index
+ * \p i, until Return::Size entries are written.
+ */
+template <typename Return, typename V, typename... Vs>
+Vc_INTRINSIC void cast_entries(typename Return::EntryType *mem, std::size_t i, V x,
+                                     Vs... xs)
+{
+    for (std::size_t j = 0; j < V::Size && i < Return::Size; ++j, ++i) {
+        mem[i] = static_cast<typename Return::EntryType>(x[j]);
+    }
+    cast_entries<Return>(mem, i, xs...);
+}
+template <typename Return, typename... Vs>
+Vc_INTRINSIC Return cast_entrywise(Vs... xs)
+{
+    typename Return::EntryType mem[Return::Size] = {};
+    cast_entries<Return>(mem, 0, xs...);
+    return Return(mem, Vc::Unaligned);
+}
+
+// strategies for casting several SSE::Vectors to one
+using Int64CastFirst = std::integral_constant<int, 0>;  // x0 fills Return on its own
+using Int64CastTo32 = std::integral_constant<int, 1>;   // 2 x 64-bit -> int_v/uint_v
+using Int64CastToFloat = std::integral_constant<int, 2>;  // 2 x 64-bit -> float_v
+using Int64CastTo16 = std::integral_constant<int, 3>;  // 4 x 64-bit -> short_v/ushort_v
+using Int64CastEntrywise = std::integral_constant<int, 4>;
+template <typename Return, typename V, std::size_t N>
+using int64_cast_strategy = std::integral_constant<
+    int, V::Size >= Return::Size
+             ? 0
+             : N == 2 && std::is_integral<typename Return::EntryType>::value &&
+                       sizeof(typename Return::EntryType) == 4
+                   ? 1
+                   : N == 2 && std::is_same<typename Return::EntryType, float>::value
+                         ? 2
+                         : N == 4 && sizeof(typename Return::EntryType) == 2 ? 3 : 4>;
+
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Return int64_cast(Int64CastFirst, SSE::Vector<T> x0, Ts...)
+{
+    return simd_cast<Return>(x0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Return int64_cast(Int64CastTo32, SSE::Vector<T> x0, SSE::Vector<T> x1)
+{
+    using To = typename Return::EntryType;
+    return _mm_unpacklo_epi64(SSE::convert<T, To>(x0.data()),
+                              SSE::convert<T, To>(x1.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Return int64_cast(Int64CastToFloat, SSE::Vector<T> x0, SSE::Vector<T> x1)
+{
+    return _mm_movelh_ps(SSE::convert<T, float>(x0.data()),
+                         SSE::convert<T, float>(x1.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Return int64_cast(Int64CastTo16, SSE::Vector<T> x0, SSE::Vector<T> x1,
+                               SSE::Vector<T> x2, SSE::Vector<T> x3)
+{
+    return simd_cast<Return>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3));
+}
+template <typename Return, typename... Ts>
+Vc_INTRINSIC Return int64_cast(Int64CastEntrywise, Ts... xs)
+{
+    return cast_entrywise<Return>(xs...);
+}
+}  // namespace Detail
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(SSE::Vector<T> x,
+              enable_if<Detail::is_sse_int64_cast<Return, SSE::Vector<T>>::value> = nullarg)
+{
+    return SSE::convert<T, typename Return::EntryType>(x.data());
+}
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<Detail::is_sse_int64_cast<Return, SSE::Vector<T>>::value, Return>
+    simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, Ts... xs)
+{
+    return Detail::int64_cast<Return>(
+        Detail::int64_cast_strategy<Return, SSE::Vector<T>, 2 + sizeof...(Ts)>(), x0, x1,
+        xs...);
+}
+
+// 8-bit integer Vector casts {{{2
+namespace Detail
+{
+/**\internal
+ * Whether a simd_cast from \p From to \p Return involves an 8-bit integer SSE::Vector
+ * (and no 64-bit integer SSE::Vector, which is_sse_int64_cast handles).
+ */
+template <typename Return, typename From> struct is_sse_int8_cast : std::false_type {};
+template <typename T, typename U>
+struct is_sse_int8_cast<SSE::Vector<T>, SSE::Vector<U>>
+    : public std::integral_constant<
+          bool, !std::is_same<T, U>::value &&
+                    !is_sse_int64_cast<SSE::Vector<T>, SSE::Vector<U>>::value &&
+                    ((std::is_integral<T>::value && sizeof(T) == 1) ||
+                     (std::is_integral<U>::value && sizeof(U) == 1))> {
+};
+
+// strategies for casting several SSE::Vectors to one 8-bit SSE::Vector
+using Int8CastFirst = std::integral_constant<int, 0>;    // x0 fills Return on its own
+using Int8CastFrom16 = std::integral_constant<int, 1>;   // 2 x 16-bit
+using Int8CastFrom32 = std::integral_constant<int, 2>;   // 2 or 4 x 32-bit or float
+using Int8CastCombine = std::integral_constant<int, 3>;  // shift and or every piece
+template <typename Return, typename V, std::size_t N>
+using int8_cast_strategy = std::integral_constant<
+    int, V::Size >= Return::Size
+             ? 0
+             : N == 2 && sizeof(typename V::EntryType) == 2
+                   ? 1
+                   : (N == 2 || N == 4) && sizeof(typename V::EntryType) == 4 ? 2 : 3>;
+
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Return int8_cast(Int8CastFirst, SSE::Vector<T> x0, Ts...)
+{
+    return simd_cast<Return>(x0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Return int8_cast(Int8CastFrom16, SSE::Vector<T> x0, SSE::Vector<T> x1)
+{
+    // masking to the low byte keeps packus from saturating, i.e. it truncates like the
+    // scalar conversion
+    const __m128i mask = _mm_set1_epi16(0xff);
+    return _mm_packus_epi16(_mm_and_si128(x0.data(), mask),
+                            _mm_and_si128(x1.data(), mask));
+}
+/**\internal
+ * Converts \p x to int and masks the low byte, so that the packs following it cannot
+ * saturate.
+ */
+template <typename T> Vc_INTRINSIC __m128i int8_cast_low_byte(SSE::Vector<T> x)
+{
+    return _mm_and_si128(SSE::convert<T, int>(x.data()), _mm_set1_epi32(0xff));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Return int8_cast(Int8CastFrom32, SSE::Vector<T> x0, SSE::Vector<T> x1)
+{
+    return _mm_packus_epi16(
+        _mm_packs_epi32(int8_cast_low_byte(x0), int8_cast_low_byte(x1)),
+        _mm_setzero_si128());
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Return int8_cast(Int8CastFrom32, SSE::Vector<T> x0, SSE::Vector<T> x1,
+                              SSE::Vector<T> x2, SSE::Vector<T> x3)
+{
+    return _mm_packus_epi16(
+        _mm_packs_epi32(int8_cast_low_byte(x0), int8_cast_low_byte(x1)),
+        _mm_packs_epi32(int8_cast_low_byte(x2), int8_cast_low_byte(x3)));
+}
+template <typename Return, int Offset>
+Vc_INTRINSIC __m128i int8_cast_combine(std::integral_constant<int, Offset>)
+{
+    return _mm_setzero_si128();
+}
+/**\internal
+ * Converts \p x to 8-bit entries, shifts them to entry \p Offset, and ors the result
+ * with the conversion of the remaining pieces \p xs.
+ */
+template <typename Return, int Offset, typename T, typename... Ts>
+Vc_INTRINSIC __m128i int8_cast_combine(std::integral_constant<int, Offset>,
+                                       SSE::Vector<T> x, Ts... xs)
+{
+    // _mm_slli_si128 may be a macro, thus the conversion must not appear in its arguments
+    const __m128i converted = SSE::convert<T, typename Return::EntryType>(x.data());
+    return _mm_or_si128(
+        _mm_slli_si128(converted, Offset),
+        int8_cast_combine<Return>(
+            std::integral_constant<int, Offset + SSE::Vector<T>::Size>(), xs...));
+}
+template <typename Return, typename... Ts>
+Vc_INTRINSIC Return int8_cast(Int8CastCombine, Ts... xs)
+{
+    return int8_cast_combine<Return>(std::integral_constant<int, 0>(), xs...);
+}
+}  // namespace Detail
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(SSE::Vector<T> x,
+              enable_if<Detail::is_sse_int8_cast<Return, SSE::Vector<T>>::value> = nullarg)
+{
+    return SSE::convert<T, typename Return::EntryType>(x.data());
+}
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<Detail::is_sse_int8_cast<Return, SSE::Vector<T>>::value, Return>
+    simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, Ts... xs)
+{
+    return Detail::int8_cast<Return>(
+        Detail::int8_cast_strategy<Return, SSE::Vector<T>, 2 + sizeof...(Ts)>(), x0, x1,
+        xs...);
+}
+
+// Scalar::Vector to 8-bit and 64-bit integer SSE::Vector {{{2
+template <typename Return, typename T, typename... Ts>
+Vc_INTRINSIC Vc_CONST
+    enable_if<SSE::is_vector<Return>::value &&
+                  std::is_integral<typename Return::EntryType>::value &&
+                  (sizeof(typename Return::EntryType) == 1 ||
+                   sizeof(typename Return::EntryType) == 8),
+              Return>
+    simd_cast(Scalar::Vector<T> x0, Ts... xs)
+{
+    return Detail::cast_entrywise<Return>(x0, xs...);
+}
+
 // Mask casts without offset {{{1
 // 1 SSE Mask to 1 SSE Mask {{{2
 template <typename Return, typename T>
@@ -764,6 +995,48 @@ Vc_INTRINSIC Vc_CONST Return simd_cast(
     return SSE::sse_cast<__m128>(_mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()),
                                                  _mm_packs_epi16(x2.dataI(), x3.dataI())));
 }
+// 2, 4, or 8 SSE Masks with 2 entries to 1 SSE Mask with 16 entries {{{2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    const __m128i zero = _mm_setzero_si128();
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(
+        _mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()), zero), zero));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    SSE::Mask<T> x2,
+    SSE::Mask<T> x3,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(_mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()),
+                                        _mm_packs_epi16(x2.dataI(), x3.dataI())),
+                        _mm_setzero_si128()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    SSE::Mask<T> x2,
+    SSE::Mask<T> x3,
+    SSE::Mask<T> x4,
+    SSE::Mask<T> x5,
+    SSE::Mask<T> x6,
+    SSE::Mask<T> x7,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(_mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()),
+                                        _mm_packs_epi16(x2.dataI(), x3.dataI())),
+                        _mm_packs_epi16(_mm_packs_epi16(x4.dataI(), x5.dataI()),
+                                        _mm_packs_epi16(x6.dataI(), x7.dataI()))));
+}
 
 // 1 Scalar Mask to 1 SSE Mask {{{2
 template <typename Return, typename T>
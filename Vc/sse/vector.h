@@ -335,17 +335,32 @@ static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  min(const SSE::short_v  &x, const
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v min(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::min_epu16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  min(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_min_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v min(const SSE::double_v &x, const SSE::double_v &y) { return _mm_min_pd(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  min(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::min_epi64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v min(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::min_epu64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::long_v   min(const SSE::long_v   &x, const SSE::long_v   &y) { return SSE::min_epi64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ulong_v  min(const SSE::ulong_v  &x, const SSE::ulong_v  &y) { return SSE::min_epu64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  min(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::min_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  min(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_min_epu8(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    max(const SSE::int_v    &x, const SSE::int_v    &y) { return SSE::max_epi32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   max(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::max_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  max(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_max_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v max(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::max_epu16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  max(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_max_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v max(const SSE::double_v &x, const SSE::double_v &y) { return _mm_max_pd(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  max(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::max_epi64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v max(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::max_epu64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::long_v   max(const SSE::long_v   &x, const SSE::long_v   &y) { return SSE::max_epi64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ulong_v  max(const SSE::ulong_v  &x, const SSE::ulong_v  &y) { return SSE::max_epu64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  max(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::max_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  max(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_max_epu8(x.data(), y.data()); }
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
+                               std::is_same<T, signed char>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, long long>::value ||
+                               std::is_same<T, long>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> abs(Vector<T, VectorAbi::Sse> x)
 {
     return SSE::VectorHelper<T>::abs(x.data());
@@ -30,7 +30,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../common/bitscanintrinsics.h"
 #include "../common/set.h"
 #include "../common/gatherimplementation.h"
+#include "../common/maskedloadstore.h"
 #include "../common/scatterimplementation.h"
+#include "../common/tunedgatherscatter.h"
 #include "../common/transpose.h"
 #include "macros.h"
 
@@ -45,6 +47,8 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8 (a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +56,8 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8 (a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8 (a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +77,8 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8 (a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +98,8 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmplt_epu8 (a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +107,8 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a < b); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +116,43 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a > b); }
+
+// 64-bit integer compares {{{1
+template <typename T>
+using enable_if_int64 = enable_if<std::is_integral<T>::value && sizeof(T) == 8, SSE::Mask<T>>;
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator==(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return SSE::cmpeq_epi64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator!=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return not_(SSE::cmpeq_epi64(a.data(), b.data()));
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator>(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return std::is_signed<T>::value ? SSE::cmpgt_epi64(a.data(), b.data())
+                                    : SSE::cmpgt_epu64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator<(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return b > a;
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator>=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return !(a < b);
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator<=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return !(a > b);
+}
 
 // bitwise operators {{{1
 template <typename T>
@@ -145,7 +194,8 @@ Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, SSE::Vector<T>> operato
 }
 template <typename T>
 Vc_INTRINSIC
-    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value, SSE::Vector<T>>
+    enable_if<std::is_integral<T>::value && (sizeof(T) == 4 || sizeof(T) == 8),
+              SSE::Vector<T>>
     operator/(SSE::Vector<T> a, SSE::Vector<T> b)
 {
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
@@ -163,6 +213,19 @@ operator/(SSE::Vector<T> a, SSE::Vector<T> b)
     return HT::concat(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<schar, T>::value || std::is_same<uchar, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    // the quotient of two 8-bit values is exact in the 16-bit division
+    using HT = SSE::VectorHelper<T>;
+    const SSE::short_v lo =
+        SSE::short_v(HT::expand0(a.data())) / SSE::short_v(HT::expand0(b.data()));
+    const SSE::short_v hi =
+        SSE::short_v(HT::expand1(a.data())) / SSE::short_v(HT::expand1(b.data()));
+    return HT::concat(lo.data(), hi.data());
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, SSE::Vector<T>> operator%(
     SSE::Vector<T> a, SSE::Vector<T> b)
 {
@@ -207,6 +270,30 @@ Vc_INTRINSIC Vector<double, VectorAbi::Sse>::Vector(VectorSpecialInitializerInde
 {
 }
 
+template <>
+Vc_INTRINSIC Vector<llong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<ullong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<long, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<ulong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
 // load member functions {{{1
 template <typename DstT>
 template <typename SrcT, typename Flags>
@@ -220,6 +307,18 @@ load_concept<SrcT, Flags>::type Vector<DstT, VectorAbi::Sse>::load(const SrcT *m
     d.v() = Detail::load<VectorType, DstT>(mem, flags);
 }
 
+// masked load {{{2
+template <typename DstT>
+template <typename SrcT, typename Flags>
+Vc_INTRINSIC typename Vector<DstT, VectorAbi::Sse>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<SrcT, Flags>::type Vector<DstT, VectorAbi::Sse>::load(const SrcT *mem, MaskArgument mask, Flags flags)
+{
+    Common::masked_load(*this, mem, mask, flags);
+}
+
 // zeroing {{{1
 template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::setZero()
 {
@@ -268,7 +367,12 @@ template <typename U, typename Flags, typename>
 Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store(U *mem, Mask mask, Flags flags) const
 {
     Common::handleStorePrefetches(mem, flags);
-    HV::template store<Flags>(mem, data(), sse_cast<VectorType>(mask.data()));
+    // maskmovdqu may fault on inactive lanes that cross into the next page
+    if (Common::is_full_width_access_safe<Size * sizeof(U)>(mem, mask)) {
+        HV::template store<Flags>(mem, data(), sse_cast<VectorType>(mask.data()));
+    } else {
+        Common::masked_store_per_lane(*this, mem, mask);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +397,12 @@ template <> Vc_ALWAYS_INLINE SSE::Vector<   int> Vector<   int, VectorAbi::Sse>:
 template <> Vc_ALWAYS_INLINE SSE::Vector<  uint> Vector<  uint, VectorAbi::Sse>::operator<<(const SSE::Vector<  uint> x) const { return _mm_sllv_epi32(d.v(), x.d.v()); }
 template <> Vc_ALWAYS_INLINE SSE::Vector<   int> Vector<   int, VectorAbi::Sse>::operator>>(const SSE::Vector<   int> x) const { return _mm_srav_epi32(d.v(), x.d.v()); }
 template <> Vc_ALWAYS_INLINE SSE::Vector<  uint> Vector<  uint, VectorAbi::Sse>::operator>>(const SSE::Vector<  uint> x) const { return _mm_srlv_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE SSE::Vector< llong> Vector< llong, VectorAbi::Sse>::operator<<(const SSE::Vector< llong> x) const { return _mm_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE SSE::Vector<ullong> Vector<ullong, VectorAbi::Sse>::operator<<(const SSE::Vector<ullong> x) const { return _mm_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE SSE::Vector<  long> Vector<  long, VectorAbi::Sse>::operator<<(const SSE::Vector<  long> x) const { return _mm_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE SSE::Vector< ulong> Vector< ulong, VectorAbi::Sse>::operator<<(const SSE::Vector< ulong> x) const { return _mm_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE SSE::Vector<ullong> Vector<ullong, VectorAbi::Sse>::operator>>(const SSE::Vector<ullong> x) const { return _mm_srlv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE SSE::Vector< ulong> Vector< ulong, VectorAbi::Sse>::operator>>(const SSE::Vector< ulong> x) const { return _mm_srlv_epi64(d.v(), x.d.v()); }
 #endif
 
 template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Sse> &Vector<T, VectorAbi::Sse>::operator>>=(int shift) {
@@ -368,12 +478,65 @@ Vc_ALWAYS_INLINE void SSE::ushort_v::gatherImplementation(const MT *mem, const I
                     mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]]);
 }
 
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::llong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::ullong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::long_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::ulong_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::schar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_setr_epi8(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+                          mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+                          mem[indexes[8]], mem[indexes[9]], mem[indexes[10]],
+                          mem[indexes[11]], mem[indexes[12]], mem[indexes[13]],
+                          mem[indexes[14]], mem[indexes[15]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::uchar_v::gatherImplementation(const MT *mem, const IT &indexes)
+{
+    d.v() = _mm_setr_epi8(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]],
+                          mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]],
+                          mem[indexes[8]], mem[indexes[9]], mem[indexes[10]],
+                          mem[indexes[11]], mem[indexes[12]], mem[indexes[13]],
+                          mem[indexes[14]], mem[indexes[15]]);
+}
+
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Sse>::gatherImplementation(const MT *mem,
                                                             const IT &indexes,
                                                             MaskArgument mask)
 {
+#ifdef Vc_USE_TUNED_GATHERS
+    Common::executeTunedGather(*this, mem, indexes, mask);
+#else
     using Selector = std::integral_constant < Common::GatherScatterImplementation,
 #ifdef Vc_USE_SET_GATHERS
           Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
@@ -387,6 +550,7 @@ inline void Vector<T, VectorAbi::Sse>::gatherImplementation(const MT *mem,
 #endif
                                                 > ;
     Common::executeGather(Selector(), *this, mem, indexes, mask);
+#endif
 }
 
 // scatters {{{1
@@ -401,6 +565,9 @@ template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Sse>::scatterImplementation(MT *mem, IT &&indexes, MaskArgument mask) const
 {
+#ifdef Vc_USE_TUNED_GATHERS
+    Common::executeTunedScatter(*this, mem, indexes, mask);
+#else
     using Selector = std::integral_constant < Common::GatherScatterImplementation,
 #ifdef Vc_USE_SET_GATHERS
           Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
@@ -414,6 +581,7 @@ inline void Vector<T, VectorAbi::Sse>::scatterImplementation(MT *mem, IT &&index
 #endif
                                                 > ;
     Common::executeScatter(Selector(), *this, mem, indexes, mask);
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -554,6 +722,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  6: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case  7: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case  8: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case  9: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 9 * EntryTypeSizeof));
+    case 10: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case 11: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case 12: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case 13: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case 14: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case 15: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     case -1: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 1 * EntryTypeSizeof));
     case -2: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 2 * EntryTypeSizeof));
     case -3: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 3 * EntryTypeSizeof));
@@ -562,6 +737,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case -6: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case -7: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case -8: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case -9: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 9 * EntryTypeSizeof));
+    case-10: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case-11: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case-12: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case-13: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case-14: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case-15: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     }
     return Zero();
 }
@@ -623,11 +805,19 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  3: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<3 * EntryTypeSizeof>(v, v));
              // warning "Immediate parameter to intrinsic call too large" disabled in VcMacros.cmake.
              // ICC fails to see that the modulo operation (Size == sizeof(VectorType) / sizeof(EntryType))
-             // disables the following four calls unless sizeof(EntryType) == 2.
+             // disables the following calls unless sizeof(EntryType) <= 2.
     case  4: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<4 * EntryTypeSizeof>(v, v));
     case  5: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<5 * EntryTypeSizeof>(v, v));
     case  6: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<6 * EntryTypeSizeof>(v, v));
     case  7: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<7 * EntryTypeSizeof>(v, v));
+    case  8: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<8 * EntryTypeSizeof>(v, v));
+    case  9: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<9 * EntryTypeSizeof>(v, v));
+    case 10: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<10 * EntryTypeSizeof>(v, v));
+    case 11: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<11 * EntryTypeSizeof>(v, v));
+    case 12: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<12 * EntryTypeSizeof>(v, v));
+    case 13: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<13 * EntryTypeSizeof>(v, v));
+    case 14: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<14 * EntryTypeSizeof>(v, v));
+    case 15: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<15 * EntryTypeSizeof>(v, v));
     }
     return Zero();
 }
@@ -640,6 +830,39 @@ inline Vc_CONST SSE::double_v sorted(SSE::double_v x_)
     const __m128d y = _mm_shuffle_pd(x, x, _MM_SHUFFLE2(0, 1));
     return _mm_unpacklo_pd(_mm_min_sd(x, y), _mm_max_sd(x, y));
 }
+inline Vc_CONST SSE::llong_v sorted(SSE::llong_v x)
+{
+    return _mm_unpacklo_epi64(SSE::min_epi64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())),
+                              SSE::max_epi64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())));
+}
+inline Vc_CONST SSE::ullong_v sorted(SSE::ullong_v x)
+{
+    return _mm_unpacklo_epi64(SSE::min_epu64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())),
+                              SSE::max_epu64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())));
+}
+inline Vc_CONST SSE::long_v sorted(SSE::long_v x)
+{
+    return _mm_unpacklo_epi64(SSE::min_epi64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())),
+                              SSE::max_epi64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())));
+}
+inline Vc_CONST SSE::ulong_v sorted(SSE::ulong_v x)
+{
+    return _mm_unpacklo_epi64(SSE::min_epu64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())),
+                              SSE::max_epu64(x.data(), _mm_unpackhi_epi64(x.data(), x.data())));
+}
+/**\internal
+ * Sorts the two halves as short_v and merges them: the minima and the maxima of the low
+ * half and the reversed high half are the lower and the upper half of the result.
+ */
+template <typename T> Vc_INTRINSIC Vc_CONST SSE::Vector<T> sorted_epi8(SSE::Vector<T> x)
+{
+    using HT = SSE::VectorHelper<T>;
+    const SSE::short_v lo = SSE::short_v(HT::expand0(x.data())).sorted();
+    const SSE::short_v hi = SSE::short_v(HT::expand1(x.data())).sorted().reversed();
+    return HT::concat(Vc::min(lo, hi).sorted().data(), Vc::max(lo, hi).sorted().data());
+}
+inline Vc_CONST SSE::schar_v sorted(SSE::schar_v x) { return sorted_epi8(x); }
+inline Vc_CONST SSE::uchar_v sorted(SSE::uchar_v x) { return sorted_epi8(x); }
 }  // namespace Detail
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::sorted()
@@ -660,6 +883,18 @@ template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveLow ( SSE::short
 template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveHigh( SSE::short_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveLow (SSE::ushort_v x) const { return _mm_unpacklo_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveHigh(SSE::ushort_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveLow ( SSE::llong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveHigh( SSE::llong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveLow (SSE::ullong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveHigh(SSE::ullong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC   SSE::long_v   SSE::long_v::interleaveLow (  SSE::long_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC   SSE::long_v   SSE::long_v::interleaveHigh(  SSE::long_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::ulong_v  SSE::ulong_v::interleaveLow ( SSE::ulong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::ulong_v  SSE::ulong_v::interleaveHigh( SSE::ulong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveLow ( SSE::schar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveHigh( SSE::schar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveLow ( SSE::uchar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveHigh( SSE::uchar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
 // }}}1
 // generate {{{1
 template <> template <typename G> Vc_INTRINSIC SSE::double_v SSE::double_v::generate(G gen)
@@ -692,6 +927,30 @@ template <> template <typename G> Vc_INTRINSIC SSE::uint_v SSE::uint_v::generate
     const auto tmp3 = gen(3);
     return _mm_setr_epi32(tmp0, tmp1, tmp2, tmp3);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::llong_v SSE::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::long_v SSE::long_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::ulong_v SSE::ulong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
 template <> template <typename G> Vc_INTRINSIC SSE::short_v SSE::short_v::generate(G gen)
 {
     const auto tmp0 = gen(0);
@@ -716,6 +975,48 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
 // }}}1
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
@@ -734,6 +1035,22 @@ template <> Vc_INTRINSIC Vc_PURE SSE::uint_v SSE::uint_v::reversed() const
 {
     return Mem::permute<X3, X2, X1, X0>(d.v());
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::llong_v SSE::llong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::ullong_v SSE::ullong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::long_v SSE::long_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::ulong_v SSE::ulong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
 template <> Vc_INTRINSIC Vc_PURE SSE::short_v SSE::short_v::reversed() const
 {
     return sse_cast<__m128i>(
@@ -746,6 +1063,28 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
+namespace Detail
+{
+Vc_INTRINSIC Vc_CONST __m128i reversed_epi8(__m128i x)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(
+        x, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // reverse the 16-bit entries, then swap the bytes inside each of them
+    x = SSE::short_v(x).reversed().data();
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+#endif
+}
+}  // namespace Detail
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+    return Detail::reversed_epi8(d.v());
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+    return Detail::reversed_epi8(d.v());
+}
 // }}}1
 // permutation via operator[] {{{1
 template <>
@@ -803,6 +1142,36 @@ Vc_ALWAYS_INLINE void transpose_impl(
     *r[2] = _mm_unpacklo_ps(tmp2, tmp3);
     *r[3] = _mm_unpackhi_ps(tmp2, tmp3);
 }
+
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<std::is_integral<T>::value && sizeof(T) == 4, void>
+transpose_impl(TransposeTag<4, 4>, SSE::Vector<T> *Vc_RESTRICT r[],
+               const TransposeProxy<SSE::Vector<T>, SSE::Vector<T>, SSE::Vector<T>,
+                                    SSE::Vector<T>> &proxy)
+{
+    const auto in0 = std::get<0>(proxy.in).data();
+    const auto in1 = std::get<1>(proxy.in).data();
+    const auto in2 = std::get<2>(proxy.in).data();
+    const auto in3 = std::get<3>(proxy.in).data();
+    const auto tmp0 = _mm_unpacklo_epi32(in0, in1);
+    const auto tmp1 = _mm_unpacklo_epi32(in2, in3);
+    const auto tmp2 = _mm_unpackhi_epi32(in0, in1);
+    const auto tmp3 = _mm_unpackhi_epi32(in2, in3);
+    *r[0] = _mm_unpacklo_epi64(tmp0, tmp1);
+    *r[1] = _mm_unpackhi_epi64(tmp0, tmp1);
+    *r[2] = _mm_unpacklo_epi64(tmp2, tmp3);
+    *r[3] = _mm_unpackhi_epi64(tmp2, tmp3);
+}
+
+Vc_ALWAYS_INLINE void transpose_impl(
+    TransposeTag<2, 2>, SSE::double_v *Vc_RESTRICT r[],
+    const TransposeProxy<SSE::double_v, SSE::double_v> &proxy)
+{
+    const auto in0 = std::get<0>(proxy.in).data();
+    const auto in1 = std::get<1>(proxy.in).data();
+    *r[0] = _mm_unpacklo_pd(in0, in1);
+    *r[1] = _mm_unpackhi_pd(in0, in1);
+}
 // }}}1
 }  // namespace Common
 }
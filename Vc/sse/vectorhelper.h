@@ -59,6 +59,10 @@ namespace SSE
             // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(_mm_castps_si128(x), _mm_castps_si128(m), reinterpret_cast<char *>(mem)); }
 
+            // float16 stores convert to binary16 and write 8 Bytes, which needs no alignment
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VectorType x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), cvtps_ph(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(float16 *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(cvtps_ph(x), _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()), reinterpret_cast<char *>(mem)); }
+
             Vc_OP0(allone, _mm_setallone_ps())
             Vc_OP0(zero, _mm_setzero_ps())
             Vc_OP3(blend, blendv_ps(a, b, c))
@@ -611,6 +615,219 @@ namespace SSE
 #undef Vc_SUFFIX
             static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
         };
+
+        template<> struct VectorHelper<long long> {
+            typedef _M128I VectorType;
+            typedef long long EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return sra_epi64(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi64(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a)));
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned long long> {
+            typedef _M128I VectorType;
+            typedef unsigned long long EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(_mm_srli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epu64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epu64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a)));
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<signed char> {
+            typedef _M128I VectorType;
+            typedef signed char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            // truncates the 16-bit entries of a and b
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I concat(_M128I a, _M128I b) {
+                return _mm_packus_epi16(_mm_and_si128(a, _mm_set1_epi16(0xff)), _mm_and_si128(b, _mm_set1_epi16(0xff)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand0(_M128I x) { return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8); }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand1(_M128I x) { return _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8); }
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) { return sll_epi8(a, shift); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) { return sra_epi8(a, shift); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi8(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_srli_si128(a, 8));
+                a = min(a, _mm_srli_si128(a, 4));
+                a = min(a, _mm_srli_si128(a, 2));
+                a = min(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_srli_si128(a, 8));
+                a = max(a, _mm_srli_si128(a, 4));
+                a = max(a, _mm_srli_si128(a, 2));
+                a = max(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                a = mul(a, _mm_srli_si128(a, 8));
+                a = mul(a, _mm_srli_si128(a, 4));
+                a = mul(a, _mm_srli_si128(a, 2));
+                a = mul(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                // psadbw sums the unsigned bytes of each half; the low byte of the sum is
+                // the same for signed bytes
+                a = _mm_sad_epu8(a, _mm_setzero_si128());
+                return _mm_cvtsi128_si32(_mm_add_epi32(a, _mm_unpackhi_epi64(a, a))); // & 0xff is implicit
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned char> {
+            typedef _M128I VectorType;
+            typedef unsigned char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            // truncates the 16-bit entries of a and b
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I concat(_M128I a, _M128I b) {
+                return _mm_packus_epi16(_mm_and_si128(a, _mm_set1_epi16(0xff)), _mm_and_si128(b, _mm_set1_epi16(0xff)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand0(_M128I x) { return _mm_unpacklo_epi8(x, _mm_setzero_si128()); }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand1(_M128I x) { return _mm_unpackhi_epi8(x, _mm_setzero_si128()); }
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi8(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) { return sll_epi8(a, shift); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) { return srl_epi8(a, shift); }
+            Vc_OP(min) Vc_OP(max)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_srli_si128(a, 8));
+                a = min(a, _mm_srli_si128(a, 4));
+                a = min(a, _mm_srli_si128(a, 2));
+                a = min(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_srli_si128(a, 8));
+                a = max(a, _mm_srli_si128(a, 4));
+                a = max(a, _mm_srli_si128(a, 2));
+                a = max(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return VectorHelper<signed char>::mul(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return VectorHelper<signed char>::add(a);
+            }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        // long is either of the above (LP64) or int/uint (LLP64)
+        template <>
+        struct VectorHelper<long>
+            : public VectorHelper<std::conditional<sizeof(long) == 8, long long, int>::type> {
+            typedef long EntryType;
+        };
+        template <>
+        struct VectorHelper<unsigned long>
+            : public VectorHelper<std::conditional<sizeof(long) == 8, unsigned long long,
+                                                   unsigned int>::type> {
+            typedef unsigned long EntryType;
+        };
 #undef Vc_OP1
 #undef Vc_OP
 #undef Vc_OP_
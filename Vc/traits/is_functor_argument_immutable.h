@@ -79,6 +79,33 @@ template <typename A> std::true_type   test3(void(*)(A));
 template <typename A> std::is_const<A> test3(void(*)(A &));
 template <typename A> std::is_const<A> test3(void(*)(A &&));
 
+// the same for functors with a second (mask) argument of type M
+template <typename F, typename A, typename M> std::true_type   test(void (F::*)(A, M));
+template <typename F, typename A, typename M> std::true_type   test(void (F::*)(A, M) const);
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &, M));
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &, M) const);
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &&, M));
+template <typename F, typename A, typename M> std::is_const<A> test(void (F::*)(A &&, M) const);
+
+#ifdef Vc_MSVC
+#define Vc_TEMPLATE_
+#else
+#define Vc_TEMPLATE_ template
+#endif
+template <typename F, typename A, typename M,
+          typename MemberPtr = decltype(&F::Vc_TEMPLATE_ operator()<A, M>)>
+decltype(is_functor_argument_immutable_impl::test(std::declval<MemberPtr>())) test2m(int);
+#undef Vc_TEMPLATE_
+
+template <typename F, typename A, typename M>
+decltype(
+    is_functor_argument_immutable_impl::test(std::declval<decltype(&F::operator())>()))
+test2m(float);
+
+template <typename A, typename M> std::true_type   test3m(void(*)(A, M));
+template <typename A, typename M> std::is_const<A> test3m(void(*)(A &, M));
+template <typename A, typename M> std::is_const<A> test3m(void(*)(A &&, M));
+
 }  // namespace is_functor_argument_immutable_impl
 
 template <typename F, typename A, bool = std::is_function<F>::value>
@@ -93,6 +120,24 @@ struct is_functor_argument_immutable<F, A, true>
     : public decltype(is_functor_argument_immutable_impl::test3(std::declval<F>())) {
 };
 
+/**\internal
+ * Same as is_functor_argument_immutable for functors that are called with a second
+ * argument of type \p M.
+ */
+template <typename F, typename A, typename M,
+          bool = std::is_function<typename std::remove_pointer<F>::type>::value>
+struct is_masked_functor_argument_immutable;
+template <typename F, typename A, typename M>
+struct is_masked_functor_argument_immutable<F, A, M, false>
+    : public decltype(is_functor_argument_immutable_impl::test2m<
+                      typename std::remove_reference<F>::type, A, M>(int())) {
+};
+template <typename F, typename A, typename M>
+struct is_masked_functor_argument_immutable<F, A, M, true>
+    : public decltype(is_functor_argument_immutable_impl::test3m(
+          std::declval<typename std::decay<F>::type>())) {
+};
+
 }  // namespace Traits
 }  // namespace Vc
 
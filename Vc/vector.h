@@ -242,6 +242,13 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 
 #include "common/vectortuple.h"
 #include "common/algorithms.h"
+#include "common/gathertuning.h"
+#include "common/sort.h"
+#include "common/histogram.h"
+#include "common/bytesearch.h"
+#include "common/divider.h"
+#include "common/saturating.h"
+#include "common/fastmath.h"
 #include "common/where.h"
 #include "common/iif.h"
 
@@ -252,12 +259,19 @@ namespace std
   using Vc::max;
 
   using Vc::abs;
+  using Vc::acos;
   using Vc::asin;
   using Vc::atan;
   using Vc::atan2;
+  using Vc::cbrt;
   using Vc::ceil;
   using Vc::cos;
+  using Vc::cosh;
+  using Vc::erf;
+  using Vc::erfc;
   using Vc::exp;
+  using Vc::exp2;
+  using Vc::expm1;
   using Vc::fma;
   using Vc::trunc;
   using Vc::floor;
@@ -265,10 +279,15 @@ namespace std
   using Vc::ldexp;
   using Vc::log;
   using Vc::log10;
+  using Vc::log1p;
   using Vc::log2;
+  using Vc::pow;
   using Vc::round;
   using Vc::sin;
+  using Vc::sinh;
   using Vc::sqrt;
+  using Vc::tan;
+  using Vc::tanh;
 
   using Vc::isfinite;
   using Vc::isnan;
@@ -0,0 +1,414 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#ifndef VC_BENCHMARKS_BENCHMARK_H_
+#define VC_BENCHMARKS_BENCHMARK_H_
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "tsc.h"
+
+/*
+ * A minimal harness for measuring Vc operations in TSC cycles.
+ *
+ * Every benchmark reports the throughput in cycles per element. Operations that map a
+ * value to a value of the same type additionally report their latency in cycles per
+ * call, measured on a single dependency chain. Floating-point kernels additionally report
+ * GFLOP/s, converted with the measured TSC frequency. The minimum over all repetitions is
+ * reported to filter out interrupts and frequency ramp-up.
+ */
+namespace Benchmark
+{
+// fakeRead / fakeModify {{{1
+/*
+ * fakeRead forces the compiler to materialize \p x in a register, without storing it to
+ * memory. fakeModify makes the compiler forget everything it knows about the contents of
+ * \p x.
+ */
+template <class T>
+Vc_INTRINSIC void fakeReadRegister(const T &x, std::true_type /*is_integral*/)
+{
+#ifdef Vc_GNU_ASM
+    asm volatile("" ::"r"(x));
+#else
+    static volatile T sink;
+    sink = x;
+#endif
+}
+template <class T>
+Vc_INTRINSIC void fakeReadRegister(const T &x, std::false_type /*is_integral*/)
+{
+#ifdef Vc_GNU_ASM
+    asm volatile("" ::"x"(x));
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<const volatile char *>(&x);
+#endif
+}
+template <class T> Vc_INTRINSIC void fakeRead(const T &x);
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC void fakeReadArray(const Vc::SimdArray<T, N, V, M> &x, std::true_type /*atomic*/)
+{
+    fakeRead(internal_data(x));
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC void fakeReadArray(const Vc::SimdArray<T, N, V, M> &x, std::false_type /*atomic*/)
+{
+    fakeRead(internal_data0(x));
+    fakeRead(internal_data1(x));
+}
+template <class T, std::size_t N, class V, std::size_t M>
+Vc_INTRINSIC void fakeReadArray(const Vc::SimdArray<T, N, V, M> &x)
+{
+    fakeReadArray(x, std::integral_constant<bool, N == M>());
+}
+template <class T> Vc_INTRINSIC void fakeReadSimd(const T &x, std::true_type /*SimdArray*/)
+{
+    fakeReadArray(x);
+}
+template <class T> Vc_INTRINSIC void fakeReadSimd(const T &x, std::false_type /*SimdArray*/)
+{
+    fakeRead(x.data());
+}
+template <class T> Vc_INTRINSIC void fakeRead(const T &x, std::true_type /*is_simd*/)
+{
+    fakeReadSimd(x, Vc::Traits::isSimdArray<T>());
+}
+template <class T> Vc_INTRINSIC void fakeRead(const T &x, std::false_type /*is_simd*/)
+{
+    fakeReadRegister(x, std::is_integral<T>());
+}
+template <class T> Vc_INTRINSIC void fakeRead(const T &x)
+{
+    fakeRead(x, std::integral_constant<bool, Vc::is_simd_vector<T>::value ||
+                                                 Vc::is_simd_mask<T>::value>());
+}
+
+template <class T> Vc_INTRINSIC void fakeModify(T &x)
+{
+#ifdef Vc_GNU_ASM
+    asm volatile("" : "+m"(x));
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<volatile char *>(&x);
+#endif
+}
+
+/*
+ * clobberMemory makes the compiler assume that all memory was read and modified.
+ */
+Vc_INTRINSIC void clobberMemory()
+{
+#ifdef Vc_GNU_ASM
+    asm volatile("" ::: "memory");
+#endif
+}
+
+// typeName {{{1
+template <class T> struct EntryTypeName;
+#define Vc_BENCHMARK_NAME_(T_)                                                           \
+    template <> struct EntryTypeName<T_> {                                               \
+        static const char *get() { return #T_; }                                         \
+    }
+Vc_BENCHMARK_NAME_(double);
+Vc_BENCHMARK_NAME_(float);
+Vc_BENCHMARK_NAME_(int);
+Vc_BENCHMARK_NAME_(short);
+#undef Vc_BENCHMARK_NAME_
+template <> struct EntryTypeName<unsigned int> {
+    static const char *get() { return "uint"; }
+};
+template <> struct EntryTypeName<unsigned short> {
+    static const char *get() { return "ushort"; }
+};
+template <> struct EntryTypeName<long long> {
+    static const char *get() { return "llong"; }
+};
+template <> struct EntryTypeName<unsigned long long> {
+    static const char *get() { return "ullong"; }
+};
+template <> struct EntryTypeName<signed char> {
+    static const char *get() { return "schar"; }
+};
+template <> struct EntryTypeName<unsigned char> {
+    static const char *get() { return "uchar"; }
+};
+
+template <class T, class Abi> std::string typeName(const Vc::Vector<T, Abi> *)
+{
+    return std::string(EntryTypeName<T>::get()) + "_v";
+}
+template <class T, std::size_t N, class V, std::size_t M>
+std::string typeName(const Vc::SimdArray<T, N, V, M> *)
+{
+    return "SimdArray<" + std::string(EntryTypeName<T>::get()) + ", " +
+           std::to_string(N) + '>';
+}
+template <class V> std::string typeName() { return typeName(static_cast<const V *>(nullptr)); }
+
+// abiName {{{1
+inline const char *abiName()
+{
+#if defined Vc_IMPL_AVX2
+    return "AVX2";
+#elif defined Vc_IMPL_AVX
+    return "AVX";
+#elif defined Vc_IMPL_SSE
+    return "SSE";
+#else
+    return "Scalar";
+#endif
+}
+
+// Result {{{1
+struct Result {
+    std::string name;
+    std::string type;
+    double throughput;  // cycles per element
+    double latency;     // cycles per call, negative if not measured
+    double gflops;      // negative if not measured
+};
+
+// Runner {{{1
+/*
+ * Parses the command line, measures, prints a table to stdout and optionally writes the
+ * results as JSON.
+ *
+ * \code
+ * benchmark_avx2 [--json <file>] [--filter <substring>] [--repetitions <n>]
+ * \endcode
+ */
+class Runner
+{
+public:
+    Runner(int argc, char **argv)
+    {
+        for (int i = 1; i < argc; ++i) {
+            if (0 == std::strcmp(argv[i], "--json") && i + 1 < argc) {
+                jsonFile = argv[++i];
+            } else if (0 == std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+                filter = argv[++i];
+            } else if (0 == std::strcmp(argv[i], "--repetitions") && i + 1 < argc) {
+                repetitions = std::max(1, std::atoi(argv[++i]));
+            } else {
+                std::cerr << "Usage: " << argv[0]
+                          << " [--json <file>] [--filter <substring>] [--repetitions <n>]\n";
+                std::exit(1);
+            }
+        }
+        std::cout << std::setw(36) << std::left << "benchmark" << std::setw(28) << "type"
+                  << std::right << std::setw(14) << "cycles/elem" << std::setw(14)
+                  << "latency" << std::setw(14) << "GFLOP/s" << '\n';
+    }
+
+    bool enabled(const std::string &name) const
+    {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    /// Returns the minimal TSC cycles per element of \p f over all repetitions.
+    template <class F> double measure(std::size_t elements, F &&f) const
+    {
+        TimeStampCounter tsc;
+        double best = std::numeric_limits<double>::max();
+        for (int n = repetitions; n; --n) {
+            tsc.start();
+            f();
+            tsc.stop();
+            best = std::min(best, double(tsc.cycles()) / elements);
+        }
+        return best;
+    }
+
+    /// Returns the TSC frequency in GHz, measured once against the steady clock.
+    double tscGHz()
+    {
+        if (tscFrequency == 0) {
+            using Clock = std::chrono::steady_clock;
+            TimeStampCounter tsc;
+            const auto t0 = Clock::now();
+            tsc.start();
+            while (Clock::now() - t0 < std::chrono::milliseconds(50)) {
+            }
+            tsc.stop();
+            const std::chrono::duration<double, std::nano> elapsed = Clock::now() - t0;
+            tscFrequency = tsc.cycles() / elapsed.count();
+        }
+        return tscFrequency;
+    }
+
+    void record(Result r)
+    {
+        std::cout << std::setw(36) << std::left << r.name << std::setw(28) << r.type
+                  << std::right << std::fixed << std::setprecision(3) << std::setw(14)
+                  << r.throughput;
+        if (r.latency >= 0) {
+            std::cout << std::setw(14) << r.latency;
+        } else if (r.gflops >= 0) {
+            std::cout << std::setw(14) << "";
+        }
+        if (r.gflops >= 0) {
+            std::cout << std::setw(14) << r.gflops;
+        }
+        std::cout << std::endl;
+        results.push_back(std::move(r));
+    }
+
+    int finish() const
+    {
+        if (jsonFile.empty()) {
+            return 0;
+        }
+        std::ofstream out(jsonFile);
+        if (!out) {
+            std::cerr << "cannot write " << jsonFile << '\n';
+            return 1;
+        }
+        out << "{\n  \"abi\": \"" << abiName() << "\",\n  \"results\": [";
+        const char *separator = "\n";
+        for (const auto &r : results) {
+            out << separator << "    {\"name\": \"" << r.name << "\", \"type\": \"" << r.type
+                << "\", \"cycles_per_element\": " << r.throughput << ", \"latency\": ";
+            if (r.latency >= 0) {
+                out << r.latency;
+            } else {
+                out << "null";
+            }
+            out << ", \"gflops\": ";
+            if (r.gflops >= 0) {
+                out << r.gflops;
+            } else {
+                out << "null";
+            }
+            out << '}';
+            separator = ",\n";
+        }
+        out << "\n  ]\n}\n";
+        return 0;
+    }
+
+private:
+    std::string jsonFile;
+    std::string filter;
+    int repetitions = 200;
+    double tscFrequency = 0;
+    std::vector<Result> results;
+};
+
+// throughput / latency helpers {{{1
+/*
+ * Measures a pass over memory. \p f processes \p elements elements per call.
+ */
+template <class V, class F>
+void memoryOp(Runner &runner, const std::string &name, std::size_t elements, F &&f)
+{
+    if (!runner.enabled(name)) {
+        return;
+    }
+    runner.record({name, typeName<V>(), runner.measure(elements, f), -1., -1.});
+}
+
+/*
+ * Measures a kernel that executes \p flops floating-point operations per call. The
+ * throughput is reported in cycles per FLOP and in GFLOP/s.
+ */
+template <class V, class F>
+void flopOp(Runner &runner, const std::string &name, std::size_t flops, F &&f)
+{
+    if (!runner.enabled(name)) {
+        return;
+    }
+    const double cyclesPerFlop = runner.measure(flops, f);
+    runner.record({name, typeName<V>(), cyclesPerFlop, -1., runner.tscGHz() / cyclesPerFlop});
+}
+
+/*
+ * Measures \p op, which maps V to V. Throughput is determined with independent dependency
+ * chains, latency with a single one.
+ */
+template <class V, class F> void unaryOp(Runner &runner, const std::string &name, V init, F &&op)
+{
+    if (!runner.enabled(name)) {
+        return;
+    }
+    constexpr int Chains = 8;
+    constexpr int Iterations = 64;
+    V x[Chains];
+    std::fill_n(x, Chains, init);
+    fakeModify(x);
+    const double throughput = runner.measure(Chains * Iterations * V::size(), [&] {
+        for (int i = 0; i < Iterations; ++i) {
+            for (int j = 0; j < Chains; ++j) {
+                x[j] = op(x[j]);
+            }
+        }
+    });
+    for (int j = 0; j < Chains; ++j) {
+        fakeRead(x[j]);
+    }
+    V y = init;
+    fakeModify(y);
+    const double latency = runner.measure(Iterations, [&] {
+        for (int i = 0; i < Iterations; ++i) {
+            y = op(y);
+        }
+    });
+    fakeRead(y);
+    runner.record({name, typeName<V>(), throughput, latency, -1.});
+}
+
+// types {{{1
+template <class... Vs> struct Types {
+};
+using Vectors = Types<Vc::double_v, Vc::float_v, Vc::int_v, Vc::uint_v, Vc::short_v, Vc::ushort_v>;
+using SimdArrays = Types<Vc::SimdArray<double, 8>, Vc::SimdArray<float, 16>,
+                         Vc::SimdArray<int, 16>, Vc::SimdArray<short, 32>>;
+
+/// Calls \p f with a default-constructed object of every type in the list.
+template <class... Vs, class F> void forEach(Types<Vs...>, F &&f)
+{
+    auto &&unused = {(f(Vs()), 0)...};
+    (void)unused;
+}
+
+// benchmark groups {{{1
+void memoryBenchmarks(Runner &runner);
+void computeBenchmarks(Runner &runner);
+void linalgBenchmarks(Runner &runner);
+
+//}}}1
+}  // namespace Benchmark
+
+#endif  // VC_BENCHMARKS_BENCHMARK_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Compare two sets of Vc benchmark results.
+
+Usage: compare.py [--threshold <fraction>] <baseline.json>... -- <candidate.json>...
+       compare.py [--threshold <fraction>] <baseline.json> <candidate.json>
+
+Every input file is the output of `benchmark_<impl> --json <file>`. Results are matched
+by ABI, benchmark name and type. A benchmark counts as regressed if its cycles per
+element (or its latency) grew by more than the threshold (default 0.1, i.e. 10%). The
+exit status is 1 if any benchmark regressed, which makes the script usable in CI.
+"""
+
+import json
+import sys
+
+
+def load(files):
+    results = {}
+    for name in files:
+        with open(name) as f:
+            data = json.load(f)
+        for r in data["results"]:
+            results[(data["abi"], r["name"], r["type"])] = r
+    return results
+
+
+def ratio(old, new):
+    if old is None or new is None or old <= 0:
+        return None
+    return new / old
+
+
+def main(argv):
+    threshold = 0.1
+    if len(argv) >= 2 and argv[0] == "--threshold":
+        threshold = float(argv[1])
+        argv = argv[2:]
+    if "--" in argv:
+        split = argv.index("--")
+        old_files, new_files = argv[:split], argv[split + 1:]
+    elif len(argv) == 2:
+        old_files, new_files = argv[:1], argv[1:]
+    else:
+        sys.stderr.write(__doc__)
+        return 2
+    old = load(old_files)
+    new = load(new_files)
+
+    regressions = 0
+    print("%-6s %-36s %-28s %10s %10s %8s %8s" %
+          ("abi", "benchmark", "type", "old", "new", "speedup", "latency"))
+    for key in sorted(set(old) & set(new)):
+        o, n = old[key], new[key]
+        throughput = ratio(o["cycles_per_element"], n["cycles_per_element"])
+        latency = ratio(o["latency"], n["latency"])
+        regressed = any(x is not None and x > 1 + threshold for x in (throughput, latency))
+        regressions += regressed
+        print("%-6s %-36s %-28s %10.3f %10.3f %8s %8s%s" % (
+            key[0], key[1], key[2], o["cycles_per_element"], n["cycles_per_element"],
+            "%.2f" % (1 / throughput) if throughput else "-",
+            "%.2f" % (1 / latency) if latency else "-",
+            "  REGRESSION" if regressed else ""))
+    for key in sorted(set(old) - set(new)):
+        print("%-6s %-36s %-28s  only in baseline" % key)
+    for key in sorted(set(new) - set(old)):
+        print("%-6s %-36s %-28s  only in candidate" % key)
+    print("%d regression(s) above %.0f%%" % (regressions, threshold * 100))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
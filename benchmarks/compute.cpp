@@ -0,0 +1,194 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include "benchmark.h"
+
+namespace Benchmark
+{
+// math functions {{{1
+template <class V> void math(Runner &, std::false_type)
+{
+}
+template <class V> void math(Runner &runner, std::true_type)
+{
+    using T = typename V::EntryType;
+    // the operations are chosen such that repeated application neither leaves the domain
+    // of the function nor produces denormals
+    const V x(T(0.5));
+    unaryOp(runner, "sqrt", x, [](V y) { return Vc::sqrt(y); });
+    unaryOp(runner, "rsqrt", x, [](V y) { return Vc::rsqrt(y); });
+    unaryOp(runner, "reciprocal", x, [](V y) { return Vc::reciprocal(y); });
+    unaryOp(runner, "abs", x, [](V y) { return Vc::abs(y); });
+    unaryOp(runner, "floor", x, [](V y) { return Vc::floor(y); });
+    unaryOp(runner, "ceil", x, [](V y) { return Vc::ceil(y); });
+    unaryOp(runner, "round", x, [](V y) { return Vc::round(y); });
+    unaryOp(runner, "fma", x, [](V y) { return Vc::fma(y, V(T(0.5)), V(T(0.25))); });
+    unaryOp(runner, "sin", x, [](V y) { return Vc::sin(y); });
+    unaryOp(runner, "cos", x, [](V y) { return Vc::cos(y); });
+    unaryOp(runner, "asin(x / 2)", x, [](V y) { return Vc::asin(y * V(T(0.5))); });
+    unaryOp(runner, "atan", x, [](V y) { return Vc::atan(y); });
+    unaryOp(runner, "atan2(x, 1)", x, [](V y) { return Vc::atan2(y, V(T(1))); });
+    unaryOp(runner, "exp(-x)", x, [](V y) { return Vc::exp(-y); });
+    unaryOp(runner, "log(x + 2)", x, [](V y) { return Vc::log(y + V(T(2))); });
+    unaryOp(runner, "log2(x + 2)", x, [](V y) { return Vc::log2(y + V(T(2))); });
+    unaryOp(runner, "log10(x + 2)", x, [](V y) { return Vc::log10(y + V(T(2))); });
+}
+
+// simd_cast {{{1
+/*
+ * Casts are measured as a round trip From -> To -> From, so that the result can feed the
+ * next iteration.
+ */
+template <class From, class To> void castRoundTrip(Runner &runner)
+{
+    using T = typename From::EntryType;
+    unaryOp(runner, "simd_cast<" + typeName<To>() + ">", From([](int i) { return T(i); }),
+            [](From x) { return Vc::simd_cast<From>(Vc::simd_cast<To>(x)); });
+}
+
+void casts(Runner &runner)
+{
+    using namespace Vc;
+    castRoundTrip<float_v, int_v>(runner);
+    castRoundTrip<float_v, uint_v>(runner);
+    castRoundTrip<float_v, double_v>(runner);
+    castRoundTrip<float_v, short_v>(runner);
+    castRoundTrip<double_v, int_v>(runner);
+    castRoundTrip<double_v, float_v>(runner);
+    castRoundTrip<int_v, short_v>(runner);
+    castRoundTrip<uint_v, ushort_v>(runner);
+    castRoundTrip<short_v, int_v>(runner);
+    castRoundTrip<ushort_v, float_v>(runner);
+    castRoundTrip<SimdArray<float, 16>, SimdArray<int, 16>>(runner);
+    castRoundTrip<SimdArray<double, 8>, SimdArray<float, 8>>(runner);
+    castRoundTrip<SimdArray<short, 32>, SimdArray<float, 32>>(runner);
+    castRoundTrip<SimdArray<long long, 8>, SimdArray<double, 8>>(runner);
+    castRoundTrip<SimdArray<long long, 8>, SimdArray<int, 8>>(runner);
+    castRoundTrip<uchar_v, SimdArray<short, uchar_v::Size>>(runner);
+    castRoundTrip<schar_v, SimdArray<float, schar_v::Size>>(runner);
+}
+
+// sorted and masked operations {{{1
+template <class V> void sortedAndMasked(Runner &runner)
+{
+    using T = typename V::EntryType;
+    const V x([](int i) { return T((i * 7) % 13); });
+    unaryOp(runner, "sorted", x, [](V y) { return y.sorted(); });
+    unaryOp(runner, "where(x < 64) | x += 1", x, [](V y) {
+        where(y < V(T(64))) | y += V(T(1));
+        return y;
+    });
+    unaryOp(runner, "iif", x, [](V y) {
+        return Vc::iif(y < V(T(64)), y + V(T(1)), y - V(T(3)));
+    });
+    unaryOp(runner, "min/max", x, [](V y) {
+        return Vc::max(Vc::min(y, V(T(100))), V(T(1)));
+    });
+}
+
+// integer division {{{1
+template <class V> void integerDivision(Runner &, std::false_type)
+{
+}
+template <class V> void integerDivision(Runner &runner, std::true_type)
+{
+    using T = typename V::EntryType;
+    // the offset keeps the iteration away from the trivial fixed point 0; the divisors
+    // are hidden from the optimizer, as they would be at runtime
+    const V x([](int i) { return T(12345 - i); });
+    T d7 = 7, d1000 = 1000;
+    fakeModify(d7);
+    fakeModify(d1000);
+    const V seven(d7), thousand(d1000);
+    const Vc::divider<T> divider7(d7), divider1000(d1000);
+    unaryOp(runner, "x / 7 + 12345", x, [&](V y) { return y / seven + V(T(12345)); });
+    unaryOp(runner, "x / divider(7) + 12345", x,
+            [&](V y) { return y / divider7 + V(T(12345)); });
+    unaryOp(runner, "x % 1000 + 12345", x,
+            [&](V y) { return y % thousand + V(T(12345)); });
+    unaryOp(runner, "x % divider(1000) + 12345", x,
+            [&](V y) { return y % divider1000 + V(T(12345)); });
+}
+
+// 64-bit integers {{{1
+// 64-bit IDs and hashes are mixed with multiplies, shifts, and xors
+template <class V> void int64Ops(Runner &runner)
+{
+    using T = typename V::EntryType;
+    const V x([](int i) { return T(0x9e3779b97f4a7c15ull * (i + 1)); });
+    unaryOp(runner, "hash mix", x, [](V y) {
+        y ^= y >> 33;
+        y *= V(T(0xff51afd7ed558ccdull));
+        return y ^ (y >> 29);
+    });
+    sortedAndMasked<V>(runner);
+}
+
+// 8-bit integers {{{1
+// pixel and quantized-weight kernels: saturating blends, averaging, 8-bit dot products
+template <class V> void int8Ops(Runner &runner)
+{
+    using T = typename V::EntryType;
+    const V x([](int i) { return T(i * 37); });
+    unaryOp(runner, "adds(x, 3) - subs(x, 5)", x, [](V y) {
+        return Vc::adds(y, V(T(3))) - Vc::subs(y, V(T(5)));
+    });
+    unaryOp(runner, "x * 3 >> 1", x, [](V y) { return (y * V(T(3))) >> 1; });
+    sortedAndMasked<V>(runner);
+}
+template <class V> void int8DotProducts(Runner &runner)
+{
+    using S = Vc::SimdArray<signed char, V::Size>;
+    const V x([](int i) { return Vc::uchar(i * 37); });
+    const S w([](int i) { return static_cast<signed char>(i * 5 - 40); });
+    unaryOp(runner, "avg(x, maddubs(x, w))", x, [&](V y) {
+        return Vc::avg(y, Vc::simd_cast<V>(Vc::maddubs(y, w)));
+    });
+    unaryOp(runner, "x + sad(x, avg(x, 7))", x, [](V y) {
+        return y + Vc::simd_cast<V>(Vc::sad(y, Vc::avg(y, V(Vc::uchar(7)))));
+    });
+}
+
+// computeBenchmarks {{{1
+void computeBenchmarks(Runner &runner)
+{
+    const auto all = [&](auto v) {
+        using V = decltype(v);
+        math<V>(runner, std::is_floating_point<typename V::EntryType>());
+        sortedAndMasked<V>(runner);
+        integerDivision<V>(runner, std::is_integral<typename V::EntryType>());
+    };
+    forEach(Vectors(), all);
+    forEach(SimdArrays(), all);
+    forEach(Types<Vc::llong_v, Vc::ullong_v, Vc::SimdArray<long long, 8>>(),
+            [&](auto v) { int64Ops<decltype(v)>(runner); });
+    forEach(Types<Vc::schar_v, Vc::uchar_v, Vc::SimdArray<unsigned char, 64>>(),
+            [&](auto v) { int8Ops<decltype(v)>(runner); });
+    forEach(Types<Vc::SimdArray<unsigned char, 32>, Vc::SimdArray<unsigned char, 64>>(),
+            [&](auto v) { int8DotProducts<decltype(v)>(runner); });
+    casts(runner);
+}
+//}}}1
+}  // namespace Benchmark
+
+// vim: foldmethod=marker
@@ -0,0 +1,287 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/Allocator>
+#include <Vc/linalg>
+#include <cmath>
+
+namespace Benchmark
+{
+// fixed-size matrices {{{1
+/*
+ * Every call multiplies Calls independent pairs of N × N matrices, so that the TSC
+ * overhead is negligible.
+ */
+template <class V, std::size_t N> void fixedGemm(Runner &runner)
+{
+    using T = typename V::EntryType;
+    using M = Vc::Memory<V, N, N>;
+    constexpr std::size_t Calls = 64;
+    std::vector<M, Vc::Allocator<M>> a(Calls), b(Calls), c(Calls);
+    for (std::size_t n = 0; n < Calls; ++n) {
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                a[n][i][j] = T(i + j + n) / T(N);
+                b[n][i][j] = T(int(i) - int(j)) / T(N);
+            }
+        }
+    }
+    const std::string size = std::to_string(N) + 'x' + std::to_string(N);
+    const std::size_t flops = Calls * 2 * N * N * N;
+    flopOp<V>(runner, "gemm " + size + " naive", flops, [&] {
+        for (std::size_t n = 0; n < Calls; ++n) {
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    T sum = 0;
+                    for (std::size_t k = 0; k < N; ++k) {
+                        sum += a[n][i][k] * b[n][k][j];
+                    }
+                    c[n][i][j] = sum;
+                }
+            }
+        }
+        clobberMemory();
+    });
+    flopOp<V>(runner, "gemm " + size, flops, [&] {
+        for (std::size_t n = 0; n < Calls; ++n) {
+            Vc::gemm(a[n], b[n], c[n]);
+        }
+        clobberMemory();
+    });
+}
+
+// runtime-size matrices {{{1
+template <class V> void largeGemm(Runner &runner, std::size_t n)
+{
+    using T = typename V::EntryType;
+    std::vector<T, Vc::Allocator<T>> a(n * n), b(n * n), c(n * n);
+    for (std::size_t i = 0; i < n * n; ++i) {
+        a[i] = T(i % 17) / T(17);
+        b[i] = T(i % 13) / T(13);
+    }
+    const std::string size = std::to_string(n);
+    flopOp<V>(runner, "gemm " + size + " naive", 2 * n * n * n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                T sum = 0;
+                for (std::size_t k = 0; k < n; ++k) {
+                    sum += a[i * n + k] * b[k * n + j];
+                }
+                c[i * n + j] = sum;
+            }
+        }
+        clobberMemory();
+    });
+    flopOp<V>(runner, "gemm " + size, 2 * n * n * n, [&] {
+        Vc::gemm(n, n, n, T(1), a.data(), n, b.data(), n, T(0), c.data(), n);
+        clobberMemory();
+    });
+}
+
+template <class V> void largeGemv(Runner &runner, std::size_t n)
+{
+    using T = typename V::EntryType;
+    std::vector<T, Vc::Allocator<T>> a(n * n), x(n), y(n);
+    for (std::size_t i = 0; i < n * n; ++i) {
+        a[i] = T(i % 17) / T(17);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = T(i % 13) / T(13);
+    }
+    const std::string size = std::to_string(n);
+    flopOp<V>(runner, "gemv " + size + " naive", 2 * n * n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            T sum = 0;
+            for (std::size_t j = 0; j < n; ++j) {
+                sum += a[i * n + j] * x[j];
+            }
+            y[i] = sum;
+        }
+        clobberMemory();
+    });
+    flopOp<V>(runner, "gemv " + size, 2 * n * n, [&] {
+        Vc::gemv(n, n, T(1), a.data(), n, x.data(), T(0), y.data());
+        clobberMemory();
+    });
+}
+
+template <class V> void largeTranspose(Runner &runner, std::size_t n)
+{
+    using T = typename V::EntryType;
+    std::vector<T, Vc::Allocator<T>> a(n * n), b(n * n);
+    for (std::size_t i = 0; i < n * n; ++i) {
+        a[i] = T(i % 17);
+    }
+    const std::string size = std::to_string(n);
+    memoryOp<V>(runner, "transpose " + size + " naive", n * n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                b[j * n + i] = a[i * n + j];
+            }
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "transpose_matrix " + size, n * n, [&] {
+        Vc::transpose_matrix(n, n, a.data(), n, b.data(), n);
+        clobberMemory();
+    });
+}
+
+// batched small matrices {{{1
+/*
+ * The scalar reference for simd_matrix: one problem at a time, with the same algorithms.
+ */
+template <class T, std::size_t D> void scalarInverseSpd(const T *a, T *out)
+{
+    T l[D][D], invDiag[D], m[D][D];
+    for (std::size_t j = 0; j < D; ++j) {
+        T s = a[j * D + j];
+        for (std::size_t k = 0; k < j; ++k) {
+            s -= l[j][k] * l[j][k];
+        }
+        l[j][j] = std::sqrt(s);
+        invDiag[j] = T(1) / l[j][j];
+        for (std::size_t i = j + 1; i < D; ++i) {
+            T t = a[i * D + j];
+            for (std::size_t k = 0; k < j; ++k) {
+                t -= l[i][k] * l[j][k];
+            }
+            l[i][j] = t * invDiag[j];
+        }
+    }
+    for (std::size_t j = 0; j < D; ++j) {
+        m[j][j] = invDiag[j];
+        for (std::size_t i = j + 1; i < D; ++i) {
+            T t = 0;
+            for (std::size_t k = j; k < i; ++k) {
+                t += l[i][k] * m[k][j];
+            }
+            m[i][j] = -t * invDiag[i];
+        }
+    }
+    for (std::size_t i = 0; i < D; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            T sum = 0;
+            for (std::size_t k = i; k < D; ++k) {
+                sum += m[k][i] * m[k][j];
+            }
+            out[i * D + j] = out[j * D + i] = sum;
+        }
+    }
+}
+
+template <class T, std::size_t D> void scalarSimilarity(const T *f, const T *c, T *out)
+{
+    T fc[D][D];
+    for (std::size_t i = 0; i < D; ++i) {
+        for (std::size_t j = 0; j < D; ++j) {
+            T sum = 0;
+            for (std::size_t k = 0; k < D; ++k) {
+                sum += f[i * D + k] * c[k * D + j];
+            }
+            fc[i][j] = sum;
+        }
+    }
+    for (std::size_t i = 0; i < D; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            T sum = 0;
+            for (std::size_t k = 0; k < D; ++k) {
+                sum += fc[i][k] * f[j * D + k];
+            }
+            out[i * D + j] = out[j * D + i] = sum;
+        }
+    }
+}
+
+/*
+ * Count independent D × D problems, stored as consecutive row-major matrices. The
+ * simd_matrix variants include the gathers and scatters from and to this layout.
+ */
+template <class V, std::size_t D> void batchedMatrices(Runner &runner)
+{
+    using T = typename V::EntryType;
+    using M = Vc::simd_matrix<T, D, D>;
+    constexpr std::size_t Count = 256;
+    std::vector<T> a(Count * D * D), f(Count * D * D), out(Count * D * D);
+    for (std::size_t t = 0; t < Count; ++t) {
+        for (std::size_t i = 0; i < D; ++i) {
+            for (std::size_t j = 0; j < D; ++j) {
+                // diagonally dominant and symmetric, thus positive definite
+                a[(t * D + i) * D + j] = i == j ? T(D + t % 7) : T(1) / T(1 + i + j);
+                f[(t * D + i) * D + j] = T((i + 2 * j + t) % 5) / T(5);
+            }
+        }
+    }
+    const std::string size = std::to_string(D) + 'x' + std::to_string(D);
+    memoryOp<V>(runner, "inverse_spd " + size + " scalar", Count, [&] {
+        for (std::size_t t = 0; t < Count; ++t) {
+            scalarInverseSpd<T, D>(&a[t * D * D], &out[t * D * D]);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "inverse_spd " + size, Count, [&] {
+        for (std::size_t t = 0; t < Count; t += M::size()) {
+            M m;
+            m.load(&a[t * D * D]);
+            Vc::inverse_spd(m).store(&out[t * D * D]);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "similarity " + size + " scalar", Count, [&] {
+        for (std::size_t t = 0; t < Count; ++t) {
+            scalarSimilarity<T, D>(&f[t * D * D], &a[t * D * D], &out[t * D * D]);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "similarity_transform " + size, Count, [&] {
+        for (std::size_t t = 0; t < Count; t += M::size()) {
+            M fm, cm;
+            fm.load(&f[t * D * D]);
+            cm.load(&a[t * D * D]);
+            Vc::similarity_transform(fm, cm).store(&out[t * D * D]);
+        }
+        clobberMemory();
+    });
+}
+
+// linalgBenchmarks {{{1
+void linalgBenchmarks(Runner &runner)
+{
+    const auto all = [&](auto v) {
+        using V = decltype(v);
+        fixedGemm<V, 3>(runner);
+        fixedGemm<V, 4>(runner);
+        fixedGemm<V, 6>(runner);
+        largeGemm<V>(runner, 256);
+        largeGemv<V>(runner, 1024);
+        largeTranspose<V>(runner, 1024);
+        batchedMatrices<V, 5>(runner);
+        batchedMatrices<V, 6>(runner);
+    };
+    forEach(Types<Vc::float_v, Vc::double_v>(), all);
+}
+//}}}1
+}  // namespace Benchmark
+
+// vim: foldmethod=marker
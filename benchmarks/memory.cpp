@@ -0,0 +1,616 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include "benchmark.h"
+#include <random>
+
+namespace Benchmark
+{
+// number of entries processed per pass; chosen to stay within the L1 cache
+constexpr std::size_t N = 2048;
+
+template <class T> struct Buffer {
+    explicit Buffer(std::size_t size = N + 64) : data(Vc::malloc<T, Vc::AlignOnCacheline>(size))
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = T(i & 127);
+        }
+    }
+    ~Buffer() { Vc::free(data); }
+    Buffer(const Buffer &) = delete;
+    Buffer &operator=(const Buffer &) = delete;
+    T *const data;
+};
+
+// loads and stores {{{1
+template <class V> void loadStore(Runner &runner)
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    constexpr std::size_t Size = V::Size;
+    Buffer<T> mem;
+    clobberMemory();
+    memoryOp<V>(runner, "load aligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            fakeRead(V(mem.data + i, Vc::Aligned));
+        }
+    });
+    memoryOp<V>(runner, "load unaligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            fakeRead(V(mem.data + i + 1, Vc::Unaligned));
+        }
+    });
+
+    V x([](int i) { return T(i); });
+    fakeModify(x);
+    memoryOp<V>(runner, "store aligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            x.store(mem.data + i, Vc::Aligned);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "store unaligned", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            x.store(mem.data + i + 1, Vc::Unaligned);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "store streaming", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            x.store(mem.data + i, Vc::Aligned | Vc::Streaming);
+        }
+        clobberMemory();
+    });
+    const M mask = x > V(T(Size / 4));
+    memoryOp<V>(runner, "store masked", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            x.store(mem.data + i, mask, Vc::Aligned);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "compress_store", N, [&] {
+        T *out = mem.data;
+        for (std::size_t i = 0; i < N; i += Size) {
+            out += Vc::compress_store(x, mask, out);
+        }
+        clobberMemory();
+    });
+}
+
+// gathers and scatters {{{1
+template <class V> struct GatherData {
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    using IndexEntry = typename IT::EntryType;
+    GatherData()
+    {
+        std::default_random_engine rne;
+        std::uniform_int_distribution<int> dist(0, N - 1);
+        for (std::size_t i = 0; i < N; ++i) {
+            indexes.data[i] = dist(rne);
+            masks[i] = dist(rne) < int(N * 3 / 4);
+        }
+        clobberMemory();
+    }
+    IT index(std::size_t i) const { return IT(indexes.data + i, Vc::Aligned); }
+    typename V::mask_type mask(std::size_t i) const
+    {
+        return typename V::mask_type(&masks[i]);
+    }
+
+    Buffer<T> mem;
+    Buffer<IndexEntry> indexes;
+    bool masks[N];
+};
+
+template <class V> void gatherScatterImplementations(Runner &, GatherData<V> &, std::false_type)
+{
+}
+
+#ifndef Vc_IMPL_Scalar
+template <class V, class Impl>
+void gatherImpl(Runner &runner, GatherData<V> &d, const std::string &implName, Impl impl)
+{
+    constexpr std::size_t Size = V::Size;
+    memoryOp<V>(runner, "gather " + implName, N, [&] {
+        V x(0);
+        for (std::size_t i = 0; i < N; i += Size) {
+            Vc::Common::executeGather(impl, x, d.mem.data, d.index(i), d.mask(i));
+            fakeRead(x);
+        }
+    });
+}
+
+template <class V, class Impl>
+void scatterImpl(Runner &runner, GatherData<V> &d, const std::string &implName, Impl impl)
+{
+    constexpr std::size_t Size = V::Size;
+    memoryOp<V>(runner, "scatter " + implName, N, [&] {
+        V x([](int i) { return typename V::EntryType(i); });
+        for (std::size_t i = 0; i < N; i += Size) {
+            Vc::Common::executeScatter(impl, x, d.mem.data, d.index(i), d.mask(i));
+        }
+        clobberMemory();
+    });
+}
+
+// BitScanLoop and PopcntSwitch need Mask::toInt, which requires BMI2 for 16 lanes on AVX2
+template <class V>
+using HasMaskBits = std::integral_constant<bool,
+#if defined Vc_IMPL_AVX2 && !defined Vc_IMPL_BMI2
+                                           V::Size != 16
+#else
+                                           true
+#endif
+                                           >;
+
+template <class V> void maskBitsImplementations(Runner &, GatherData<V> &, std::false_type)
+{
+}
+template <class V> void maskBitsImplementations(Runner &runner, GatherData<V> &d, std::true_type)
+{
+    using namespace Vc::Common;
+    gatherImpl(runner, d, "BitScanLoop", BitScanLoopT());
+    gatherImpl(runner, d, "PopcntSwitch", PopcntSwitchT());
+    scatterImpl(runner, d, "BitScanLoop", BitScanLoopT());
+    scatterImpl(runner, d, "PopcntSwitch", PopcntSwitchT());
+}
+
+template <class V>
+void gatherScatterImplementations(Runner &runner, GatherData<V> &d, std::true_type)
+{
+    using namespace Vc::Common;
+    gatherImpl(runner, d, "SimpleLoop", SimpleLoopT());
+    gatherImpl(runner, d, "SetIndexZero", SetIndexZeroT());
+    // there is no SetIndexZero strategy for scatters
+    scatterImpl(runner, d, "SimpleLoop", SimpleLoopT());
+    maskBitsImplementations(runner, d, HasMaskBits<V>());
+}
+#endif  // Vc_IMPL_Scalar
+
+template <class V> void gatherScatter(Runner &runner)
+{
+    constexpr std::size_t Size = V::Size;
+    GatherData<V> d;
+    memoryOp<V>(runner, "gather", N, [&] {
+        for (std::size_t i = 0; i < N; i += Size) {
+            fakeRead(V(d.mem.data, d.index(i)));
+        }
+    });
+    memoryOp<V>(runner, "gather masked", N, [&] {
+        V x(0);
+        for (std::size_t i = 0; i < N; i += Size) {
+            x.gather(d.mem.data, d.index(i), d.mask(i));
+            fakeRead(x);
+        }
+    });
+    memoryOp<V>(runner, "scatter", N, [&] {
+        const V x([](int i) { return typename V::EntryType(i); });
+        for (std::size_t i = 0; i < N; i += Size) {
+            x.scatter(d.mem.data, d.index(i));
+        }
+        clobberMemory();
+    });
+    // the GatherScatterImplementation strategies only exist for the SIMD Vector types
+    gatherScatterImplementations(
+        runner, d, std::integral_constant<bool, Vc::Traits::is_simd_vector<V>::value &&
+                                                    !Vc::Traits::isSimdArray<V>::value &&
+                                                    (Size > 1)>());
+}
+
+// interleaved memory {{{1
+template <class T, std::size_t K> struct Struct {
+    T d[K];
+};
+
+template <class V> void interleavedMemory(Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Size = V::Size;
+    constexpr std::size_t Structs = N / 4;
+    Buffer<T> mem(4 * (Structs + Size));
+    const Vc::InterleavedMemoryWrapper<Struct<T, 2>, V> data2(
+        reinterpret_cast<Struct<T, 2> *>(mem.data));
+    const Vc::InterleavedMemoryWrapper<Struct<T, 3>, V> data3(
+        reinterpret_cast<Struct<T, 3> *>(mem.data));
+    Vc::InterleavedMemoryWrapper<Struct<T, 4>, V> data4(
+        reinterpret_cast<Struct<T, 4> *>(mem.data));
+    memoryOp<V>(runner, "deinterleave 2", Structs * 2, [&] {
+        V a, b;
+        for (std::size_t i = 0; i < Structs; i += Size) {
+            Vc::tie(a, b) = data2[i];
+            fakeRead(a);
+            fakeRead(b);
+        }
+    });
+    memoryOp<V>(runner, "deinterleave 3", Structs * 3, [&] {
+        V a, b, c;
+        for (std::size_t i = 0; i < Structs; i += Size) {
+            Vc::tie(a, b, c) = data3[i];
+            fakeRead(a);
+            fakeRead(b);
+            fakeRead(c);
+        }
+    });
+    memoryOp<V>(runner, "deinterleave 4", Structs * 4, [&] {
+        V a, b, c, d;
+        for (std::size_t i = 0; i < Structs; i += Size) {
+            Vc::tie(a, b, c, d) = data4[i];
+            fakeRead(a);
+            fakeRead(b);
+            fakeRead(c);
+            fakeRead(d);
+        }
+    });
+    memoryOp<V>(runner, "interleave 4", Structs * 4, [&] {
+        V a([](int i) { return T(i); });
+        fakeModify(a);
+        for (std::size_t i = 0; i < Structs; i += Size) {
+            data4[i] = Vc::tie(a, a, a, a);
+        }
+        clobberMemory();
+    });
+}
+
+// AoS <-> SoA conversion {{{1
+template <class V, std::size_t K> void aosSoa(Runner &runner)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    constexpr std::size_t Size = V::Size;
+    constexpr std::size_t Structs = N / 4;
+    Buffer<T> aos(K * Structs + 64);
+    std::vector<Buffer<T>> soa(K);
+    T *ptrs[K];
+    for (std::size_t m = 0; m < K; ++m) {
+        ptrs[m] = soa[m].data;
+    }
+    const std::string suffix = ' ' + std::to_string(K);
+    memoryOp<V>(runner, "aos_to_soa" + suffix, Structs * K, [&] {
+        Vc::aos_to_soa(aos.data, Structs, ptrs);
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "aos_to_soa gather" + suffix, Structs * K, [&] {
+        for (std::size_t i = 0; i < Structs; i += Size) {
+            const IT indexes = (IT(Vc::IndexesFromZero) + int(i)) * int(K);
+            for (std::size_t m = 0; m < K; ++m) {
+                V(aos.data + m, indexes).store(ptrs[m] + i, Vc::Aligned);
+            }
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "soa_to_aos" + suffix, Structs * K, [&] {
+        Vc::soa_to_aos(ptrs, Structs, aos.data);
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "soa_to_aos scatter" + suffix, Structs * K, [&] {
+        for (std::size_t i = 0; i < Structs; i += Size) {
+            const IT indexes = (IT(Vc::IndexesFromZero) + int(i)) * int(K);
+            for (std::size_t m = 0; m < K; ++m) {
+                V(ptrs[m] + i, Vc::Aligned).scatter(aos.data + m, indexes);
+            }
+        }
+        clobberMemory();
+    });
+}
+
+// bandwidth: regular vs. streaming stores {{{1
+/*
+ * Copies, fills, and transforms 64 MiB, far beyond the cache sizes. The results are
+ * cycles per element; divide sizeof(T) by them for bytes per cycle.
+ */
+template <class V> void bandwidth(Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Size = V::Size;
+    constexpr std::size_t Elements = (64 << 20) / sizeof(T);
+    Buffer<T> in(Elements);
+    Buffer<T> out(Elements);
+    const auto scale = [](V x) { return x * T(3); };
+    memoryOp<V>(runner, "copy 64MiB", Elements, [&] {
+        std::copy(in.data, in.data + Elements, out.data);
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "stream_copy 64MiB", Elements, [&] {
+        Vc::stream_copy(in.data, in.data + Elements, out.data);
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "fill 64MiB", Elements, [&] {
+        std::fill(out.data, out.data + Elements, T(1));
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "stream_fill 64MiB", Elements, [&] {
+        Vc::stream_fill(out.data, out.data + Elements, T(1));
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "transform 64MiB", Elements, [&] {
+        for (std::size_t i = 0; i < Elements; i += Size) {
+            scale(V(in.data + i, Vc::Aligned)).store(out.data + i, Vc::Aligned);
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "stream_transform 64MiB", Elements, [&] {
+        Vc::stream_transform(in.data, in.data + Elements, out.data, scale);
+        clobberMemory();
+    });
+}
+
+// software prefetching {{{1
+/*
+ * Streams over 64 MiB with and without software prefetches, and gathers from a 64 MiB
+ * table at random indexes with and without prefetching the gathers 8 vectors ahead.
+ */
+template <class V> void prefetching(Runner &runner)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    constexpr std::size_t Size = V::Size;
+    constexpr std::size_t Elements = (64 << 20) / sizeof(T);
+    constexpr std::size_t Lookups = 1 << 20;
+    constexpr std::size_t Lead = 8 * Size;
+    Buffer<T> data(Elements);
+    Buffer<int> indexes(Lookups + Lead);
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> dist(0, Elements - 1);
+    for (std::size_t i = 0; i < Lookups + Lead; ++i) {
+        indexes.data[i] = dist(rne);
+    }
+    const auto scale = [](auto &x) { x *= T(3); };
+    memoryOp<V>(runner, "simd_for_each 64MiB", Elements, [&] {
+        Vc::simd_for_each(data.data, data.data + Elements, scale);
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "simd_for_each prefetch 64MiB", Elements, [&] {
+        Vc::simd_for_each(Vc::prefetch, data.data, data.data + Elements, scale);
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "random gather 64MiB", Lookups, [&] {
+        for (std::size_t i = 0; i < Lookups; i += Size) {
+            fakeRead(V(data.data, IT(indexes.data + i, Vc::Aligned)));
+        }
+    });
+    memoryOp<V>(runner, "random gather prefetch 64MiB", Lookups, [&] {
+        for (std::size_t i = 0; i < Lookups; i += Size) {
+            Vc::prefetch_gather(data.data, IT(indexes.data + i + Lead, Vc::Aligned));
+            fakeRead(V(data.data, IT(indexes.data + i, Vc::Aligned)));
+        }
+    });
+}
+
+// memory expressions {{{1
+/*
+ * `a = b * c + d` over 16 MiB arrays: with one compound assignment pass per operation,
+ * fused into one pass, and fused with Vc::parallel.
+ */
+template <class V> void memoryExpressions(Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Elements = (16 << 20) / sizeof(T);
+    Vc::Memory<V> a(Elements), b(Elements), c(Elements), d(Elements);
+    for (std::size_t i = 0; i < Elements; ++i) {
+        b[i] = T(i & 127);
+        c[i] = T(3);
+        d[i] = T(1);
+    }
+    memoryOp<V>(runner, "b*c+d per operation 16MiB", Elements, [&] {
+        a = b;
+        a *= c;
+        a += d;
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "b*c+d expression 16MiB", Elements, [&] {
+        a = b * c + d;
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "b*c+d expression parallel 16MiB", Elements, [&] {
+        Vc::evaluate(Vc::parallel, a, b * c + d);
+        clobberMemory();
+    });
+}
+
+// histograms {{{1
+template <class V> void histogram(Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Bins = 256;
+    Buffer<T> data;
+    std::default_random_engine rne;
+    std::normal_distribution<double> dist(Bins / 2, Bins / 8);
+    for (std::size_t i = 0; i < N; ++i) {
+        data.data[i] = T(dist(rne));
+    }
+    std::vector<unsigned> counts(Bins);
+    memoryOp<V>(runner, "histogram scalar", N, [&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            const T x = data.data[i];
+            if (x >= T(0) && x < T(Bins)) {
+                ++counts[std::size_t(x)];
+            }
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "simd_histogram", N, [&] {
+        Vc::simd_histogram(data.data, data.data + N, counts.data(), Bins, T(0), T(Bins));
+        clobberMemory();
+    });
+}
+
+template <class V> void bincount(Runner &runner)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Bins = 256;
+    Buffer<T> data;
+    std::default_random_engine rne;
+    std::normal_distribution<double> dist(Bins / 2, Bins / 8);
+    for (std::size_t i = 0; i < N; ++i) {
+        data.data[i] = T(dist(rne));
+    }
+    std::vector<unsigned> counts(Bins);
+    memoryOp<V>(runner, "bincount scalar", N, [&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            const T x = data.data[i];
+            if (x >= T(0) && x < T(Bins)) {
+                ++counts[std::size_t(x)];
+            }
+        }
+        clobberMemory();
+    });
+    memoryOp<V>(runner, "simd_bincount", N, [&] {
+        Vc::simd_bincount(data.data, data.data + N, counts.data(), Bins);
+        clobberMemory();
+    });
+}
+
+// byte search {{{1
+template <class F>
+void byteOp(Runner &runner, const std::string &name, std::size_t bytes, F &&f)
+{
+    if (runner.enabled(name)) {
+        runner.record({name, "char", runner.measure(bytes, f), -1., -1.});
+    }
+}
+
+void byteSearch(Runner &runner)
+{
+    // log-like text: lines of 40-120 bytes with some multi-byte UTF-8 and a single '|'
+    // at the end
+    constexpr std::size_t Bytes = 64 * 1024;
+    std::vector<char> text;
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> lineLength(40, 120), letter(0, 25), rare(0, 200);
+    while (text.size() < Bytes - 128) {
+        for (int n = lineLength(rne); n; --n) {
+            if (rare(rne) == 0) {
+                text.insert(text.end(), {'\xc3', '\xa9'});  // é
+            } else {
+                text.push_back(n % 9 == 0 ? ' ' : char('a' + letter(rne)));
+            }
+        }
+        text.push_back('\n');
+    }
+    text.push_back('|');
+    const char *const first = text.data();
+    const char *const last = first + text.size();
+    const auto offset = [&](const char *p) { return std::size_t(p - first); };
+    std::size_t count;
+
+    byteOp(runner, "memchr std::find", text.size(), [&] {
+        fakeRead(offset(std::find(first, last, '|')));
+    });
+    byteOp(runner, "memchr std::memchr", text.size(), [&] {
+        const void *p = std::memchr(first, '|', text.size());
+        fakeRead(offset(static_cast<const char *>(p)));
+    });
+    byteOp(runner, "simd_memchr", text.size(), [&] {
+        fakeRead(offset(Vc::simd_memchr(first, last, '|')));
+    });
+
+    const char needles[] = "|;=\t";
+    byteOp(runner, "find_first_of std", text.size(), [&] {
+        fakeRead(offset(std::find_first_of(first, last, needles, needles + 4)));
+    });
+    byteOp(runner, "simd_find_first_of", text.size(), [&] {
+        fakeRead(offset(Vc::simd_find_first_of(first, last, needles, needles + 4)));
+    });
+
+    const char pattern[] = "zzzzz|";
+    byteOp(runner, "search std::search", text.size(), [&] {
+        fakeRead(offset(std::search(first, last, pattern, pattern + 6)));
+    });
+    byteOp(runner, "simd_search", text.size(), [&] {
+        fakeRead(offset(Vc::simd_search(first, last, pattern, pattern + 6)));
+    });
+
+    byteOp(runner, "count lines std::count", text.size(), [&] {
+        count = std::count(first, last, '\n');
+        fakeRead(count);
+    });
+    byteOp(runner, "simd_count lines", text.size(), [&] {
+        count = Vc::simd_count(first, last, '\n');
+        fakeRead(count);
+    });
+
+    byteOp(runner, "split lines memchr", text.size(), [&] {
+        count = 0;
+        for (const char *begin = first;;) {
+            const char *end = static_cast<const char *>(
+                std::memchr(begin, '\n', last - begin));
+            count += (end ? end : last) - begin;
+            if (!end) {
+                break;
+            }
+            begin = end + 1;
+        }
+        fakeRead(count);
+    });
+    byteOp(runner, "simd_split lines", text.size(), [&] {
+        count = 0;
+        Vc::simd_split(first, last, '\n',
+                       [&](const char *b, const char *e) { count += e - b; });
+        fakeRead(count);
+    });
+
+    byteOp(runner, "utf8 validate scalar", text.size(), [&] {
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *end = reinterpret_cast<const unsigned char *>(last);
+        count = Vc::Common::utf8_decode_until(p, end, end) != nullptr;
+        fakeRead(count);
+    });
+    byteOp(runner, "simd_utf8_validate", text.size(), [&] {
+        count = Vc::simd_utf8_validate(first, last);
+        fakeRead(count);
+    });
+}
+
+// memoryBenchmarks {{{1
+void memoryBenchmarks(Runner &runner)
+{
+    const auto all = [&](auto v) {
+        using V = decltype(v);
+        loadStore<V>(runner);
+        gatherScatter<V>(runner);
+    };
+    forEach(Vectors(), all);
+    forEach(SimdArrays(), all);
+    forEach(Vectors(), [&](auto v) { interleavedMemory<decltype(v)>(runner); });
+    forEach(Vectors(), [&](auto v) {
+        using V = decltype(v);
+        aosSoa<V, 3>(runner);
+        aosSoa<V, 7>(runner);
+        aosSoa<V, 16>(runner);
+    });
+    bandwidth<Vc::float_v>(runner);
+    bandwidth<Vc::double_v>(runner);
+    prefetching<Vc::float_v>(runner);
+    memoryExpressions<Vc::float_v>(runner);
+    memoryExpressions<Vc::double_v>(runner);
+    histogram<Vc::float_v>(runner);
+    histogram<Vc::double_v>(runner);
+    bincount<Vc::int_v>(runner);
+    bincount<Vc::ushort_v>(runner);
+    byteSearch(runner);
+}
+//}}}1
+}  // namespace Benchmark
+
+// vim: foldmethod=marker
@@ -44,10 +44,14 @@ typedef bool int_m;
 #endif
 #else
 #include <Vc/Vc>
+#include <Vc/simdize>
+#include <tuple>
+#include <vector>
 
 using Vc::float_v;
 using Vc::float_m;
-using int_v = Vc::SimdArray<int, float_v::size()>;
+// the type simdize uses for the int members of the worklist state
+using int_v = Vc::simdize<int, float_v::size()>;
 using int_m = int_v::mask_type;
 #endif
 
@@ -506,33 +510,70 @@ void Baker::createImage()
         }
     }
 #else
-    const float imagStep2 = imagStep * float_v::Size;
-    const float_v imagMin2 = imagMin + imagStep * float_v::IndexesFromZero();
+    // The escape iteration counts of neighboring points differ wildly. Therefore, the
+    // escape test runs as a simd_worklist over the imag steps of each real, which refills
+    // lanes as soon as their point escaped (or was found to be inside). The state per lane
+    // is (z.real, z.imag, c.imag, n). Only the escaping points that took at least
+    // overallLowerBound iterations are collected and their orbits drawn afterwards.
+    typedef Vc::simdize<std::tuple<float, float, float, int>> State;
+    typedef Vc::worklist_index<State> Items;
+    const int nImag = static_cast<int>((imagMax - imagMin) / imagStep) + 1;
+    std::vector<float> candidates;
+    Vc::worklist_statistics stats;
     for (float real = realMin; real <= realMax; real += realStep) {
         m_progress.setValue(99.f * (real - realMin) / (realMax - realMin));
-        for (float_v imag = imagMin2; all_of(imag <= imagMax); imag += imagStep2) {
-            // FIXME: extra "tracks" if nSteps[1] is not a multiple of float_v::Size
+        candidates.clear();
+        const Vc::worklist_statistics realStats = Vc::simd_worklist<State>(
+            nImag,
+            [&](const Items &items) {
+                State s;
+                const float_v imag = imagMin + Vc::simd_cast<float_v>(items) * imagStep;
+                const Z c2{1.08f * real + 0.15f, imag};
+                const float_m skip = fastNorm(Z{real + 1.f, imag}) < 0.06f ||
+                                     (c2.real < 0.42f && fastNorm(c2) < 0.417f);
+                std::get<0>(s) = real;
+                std::get<1>(s) = imag;
+                std::get<2>(s) = imag;
+                // points inside the main cardioid or the period-2 bulb finish immediately
+                std::get<3>(s) = Vc::iif(Vc::simd_cast<int_m>(skip),
+                                         int_v(maxIterations + 1), int_v(Vc::Zero));
+                return s;
+            },
+            [&](State &s) {
+                int_v &n = std::get<3>(s);
+                const Z z{std::get<0>(s), std::get<1>(s)};
+                const float_m go =
+                    Vc::simd_cast<float_m>(n <= maxIterations) && fastNorm(z) < S;
+                const Z next = P(z, Z{real, std::get<2>(s)});
+                std::get<0>(s)(go) = next.real;
+                std::get<1>(s)(go) = next.imag;
+                ++n(Vc::simd_cast<int_m>(go));
+                return go;
+            },
+            [&](const State &s, const Items &, const Items::mask_type &done) {
+                // point is outside of the Mandelbrot set and required enough
+                // (overallLowerBound) iterations to reach the cut-off value S
+                const int_v &n = std::get<3>(s);
+                const int_m escaped = Vc::simd_cast<int_m>(done) && n <= maxIterations &&
+                                      n >= overallLowerBound;
+                for (int j : where(escaped)) {
+                    candidates.push_back(std::get<2>(s)[j]);
+                }
+            });
+        stats.iterations += realStats.iterations;
+        stats.active_lanes += realStats.active_lanes;
+        stats.lanes = realStats.lanes;
+
+        const int nCandidates = static_cast<int>(candidates.size());
+        candidates.resize((nCandidates + float_v::Size - 1) / float_v::Size * float_v::Size,
+                          imagMin);
+        for (int k = 0; k < nCandidates; k += float_v::Size) {
+            const float_v imag(&candidates[k], Vc::Unaligned);
+            const float_m inside = float_v::IndexesFromZero() >= float(nCandidates - k);
             Z c{real, imag};
-            Z c2 = Z{1.08f * real + 0.15f, imag};
-            if (all_of(fastNorm(Z{real + 1.f, imag}) < 0.06f ||
-                       (c2.real < 0.42f && fastNorm(c2) < 0.417f))) {
-                continue;
-            }
-            Z z = c;
-            int_v n(Vc::Zero);
-            int_m inside = fastNorm(z) < S;
-            while (!(inside && n <= maxIterations).isEmpty()) {
-                z = P(z, c);
-                ++n(inside);
-                inside &= fastNorm(z) < S;
-            }
-            inside |= n < overallLowerBound;
-            if (inside.isFull()) {
-                continue;
-            }
             Z cn{real, -imag};
+            Z z = c;
             Z zn = cn;
-            z = c;
             for (int i = 0; i <= overallUpperBound; ++i) {
                 const float_v y2 = (z.imag - m_y) * yFact;
                 const float_v yn2 = (zn.imag - m_y) * yFact;
@@ -555,6 +596,7 @@ void Baker::createImage()
             }
         }
     }
+    qDebug() << "escape test lane utilization:" << stats.utilization();
 #endif
     canvas.toQImage(&m_image);
 
@@ -27,6 +27,8 @@
 #include "../tsc.h"
 
 #include <Vc/vector.h>
+#include <Vc/simdize>
+#include <tuple>
 
 using Vc::float_v;
 using Vc::float_m;
@@ -144,6 +146,9 @@ class MyComplex
             return m_real2 + m_imag2;
         }
 
+        T real() const { return m_real; }
+        T imag() const { return m_imag; }
+
     private:
         T m_real, m_imag;
         T m_real2, m_imag2;
@@ -157,41 +162,57 @@ template<typename T> inline MyComplex<T> P(MyComplex<T> z, T c_real, T c_imag)
 }
 //! [P function]
 
+/**
+ * The points of a scanline need very different numbers of iterations. Instead of iterating
+ * float_v::Size points until the slowest of them escapes, simd_worklist loads the next
+ * point into every lane that finished. The per-lane state is (z.real, z.imag, c_real, n).
+ */
 template<> void Mandel<VcImpl>::mandelMe(QImage &image, float x0,
         float y0, float scale, int maxIt)
 {
     typedef MyComplex<float_v> Z;
+    typedef Vc::simdize<std::tuple<float, float, float, float>> State;
+    typedef Vc::worklist_index<State> Items;
     const unsigned int height = image.height();
     const unsigned int width = image.width();
     const float_v colorScale = 0xff / static_cast<float>(maxIt);
+    Vc::worklist_statistics stats;
     for (unsigned int y = 0; y < height; ++y) {
         unsigned int *Vc_RESTRICT line = reinterpret_cast<unsigned int *>(image.scanLine(y));
         const float_v c_imag = y0 + y * scale;
-        uint_m toStore;
-        for (uint_v x = uint_v::IndexesFromZero(); !(toStore = x < width).isEmpty();
-                x += float_v::Size) {
-            const float_v c_real = x0 + simd_cast<float_v>(x) * scale;
-            Z z(c_real, c_imag);
-            float_v n = float_v::Zero();
-            float_m inside = z.norm() < S;
-            while (!(inside && n < maxIt).isEmpty()) {
-                z = P(z, c_real, c_imag);
+        const Vc::worklist_statistics lineStats = Vc::simd_worklist<State>(
+            width,
+            [&](const Items &x) {
+                State s;
+                std::get<2>(s) = x0 + simd_cast<float_v>(x) * scale;
+                std::get<0>(s) = std::get<2>(s);
+                std::get<1>(s) = c_imag;
+                std::get<3>(s) = float_v::Zero();
+                return s;
+            },
+            [&](State &s) {
+                float_v &n = std::get<3>(s);
+                const Z z(std::get<0>(s), std::get<1>(s));
+                const float_m inside = z.norm() < S && n < maxIt;
+                const Z next = P(z, std::get<2>(s), c_imag);
+                std::get<0>(s)(inside) = next.real();
+                std::get<1>(s)(inside) = next.imag();
                 ++n(inside);
-                inside = z.norm() < S;
-            }
-            uint_v colorValue = simd_cast<uint_v>((maxIt - n) * colorScale) * 0x10101;
-            if (toStore.isFull()) {
-                colorValue.store(line, Vc::Unaligned);
-                line += uint_v::Size;
-            } else {
-                colorValue.store(line, toStore, Vc::Unaligned);
-                break; // we don't need to check again wether x[0] + float_v::Size < width to break out of the loop
-            }
-        }
+                return inside;
+            },
+            [&](const State &s, const Items &x, const Items::mask_type &done) {
+                const uint_v colorValue =
+                    simd_cast<uint_v>((maxIt - std::get<3>(s)) * colorScale) * 0x10101;
+                colorValue.scatter(line, x, simd_cast<uint_m>(done));
+            });
+        stats.iterations += lineStats.iterations;
+        stats.active_lanes += lineStats.active_lanes;
+        stats.lanes = lineStats.lanes;
         if (restart()) {
             break;
         }
     }
+    qDebug() << "lane utilization:" << stats.utilization();
 }
 
 template<> void Mandel<ScalarImpl>::mandelMe(QImage &image, float x0,
@@ -0,0 +1,98 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+// prevents the compiler from optimizing away the benchmarked computation
+template <class T> static void keep(const T &x) { asm volatile("" ::"m"(x)); }
+
+template <class F> static double measure(std::size_t N, F &&f)
+{
+    const std::size_t repetitions = 1 + 100000000 / N;
+    TimeStampCounter tsc;
+    double best = 0;
+    for (auto n = repetitions; n; --n) {
+        tsc.start();
+        f();
+        tsc.stop();
+        const double x = double(tsc.cycles()) / N;
+        if (best == 0 || x < best) {
+            best = x;
+        }
+    }
+    return best;
+}
+
+static void print(const char *name, std::size_t N, double std_cycles, double vc_cycles)
+{
+    std::cout << std::setw(16) << name << std::setw(12) << N << std::setw(16) << std_cycles
+              << std::setw(16) << vc_cycles << std::setw(12) << std_cycles / vc_cycles
+              << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setw(16) << "algorithm" << std::setw(12) << "N" << std::setw(16)
+              << "std cycles/elem" << std::setw(16) << "Vc cycles/elem" << std::setw(12)
+              << "speedup" << '\n';
+    std::default_random_engine rne;
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    for (std::size_t N = 1000; N <= 10000000; N *= 10) {
+        std::vector<float> a(N), b(N), out(N);
+        for (std::size_t i = 0; i < N; ++i) {
+            a[i] = dist(rne);
+            b[i] = dist(rne);
+        }
+
+        print("reduce", N,
+              measure(N, [&] { keep(std::accumulate(a.begin(), a.end(), 0.f)); }),
+              measure(N, [&] { keep(Vc::simd_reduce(a.begin(), a.end(), 0.f)); }));
+        print("transform_reduce", N,
+              measure(N, [&] { keep(std::inner_product(a.begin(), a.end(), b.begin(), 0.f)); }),
+              measure(N, [&] {
+                  keep(Vc::simd_transform_reduce(a.begin(), a.end(), b.begin(), 0.f));
+              }));
+        print("inclusive_scan", N, measure(N,
+                                           [&] {
+#if __cplusplus >= 201703L
+                                               std::inclusive_scan(a.begin(), a.end(),
+                                                                   out.begin());
+#else
+                                               std::partial_sum(a.begin(), a.end(),
+                                                                out.begin());
+#endif
+                                               keep(out[N - 1]);
+                                           }),
+              measure(N, [&] {
+                  Vc::simd_inclusive_scan(a.begin(), a.end(), out.begin());
+                  keep(out[N - 1]);
+              }));
+    }
+    return 0;
+}
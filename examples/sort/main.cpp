@@ -0,0 +1,84 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+template <class T, class Sort>
+static double measure(const std::vector<T> &input, std::size_t repetitions, Sort &&sort)
+{
+    TimeStampCounter tsc;
+    double best = 0;
+    for (auto n = repetitions; n; --n) {
+        std::vector<T> data = input;
+        tsc.start();
+        sort(data);
+        tsc.stop();
+        const double x = tsc.cycles();
+        if (best == 0 || x < best) {
+            best = x;
+        }
+        if (!std::is_sorted(data.begin(), data.end())) {
+            std::cerr << "sort result is not sorted\n";
+        }
+    }
+    return best;
+}
+
+template <class T, class Dist> static void benchmark(const char *name, Dist dist)
+{
+    std::cout << name << '\n';
+    std::cout << std::setw(12) << "N" << std::setw(18) << "std cycles/elem"
+              << std::setw(18) << "Vc cycles/elem" << std::setw(12) << "speedup"
+              << '\n';
+    std::default_random_engine rne;
+    for (std::size_t N = 1000; N <= 100000000; N *= 10) {
+        std::vector<T> input(N);
+        for (auto &x : input) {
+            x = dist(rne);
+        }
+        const std::size_t repetitions = N >= 10000000 ? 1 : 10000000 / N;
+        const double std_cycles = measure(input, repetitions, [](std::vector<T> &v) {
+            std::sort(v.begin(), v.end());
+        });
+        const double vc_cycles = measure(input, repetitions, [](std::vector<T> &v) {
+            Vc::sort(v.begin(), v.end());
+        });
+        std::cout << std::setw(12) << N << std::setw(18) << std_cycles / N
+                  << std::setw(18) << vc_cycles / N << std::setw(12)
+                  << std_cycles / vc_cycles << '\n';
+    }
+}
+
+int Vc_CDECL main()
+{
+    benchmark<float>("float", std::uniform_real_distribution<float>(-1000.f, 1000.f));
+    benchmark<int>("int", std::uniform_int_distribution<int>(-1000000, 1000000));
+    benchmark<double>("double", std::uniform_real_distribution<double>(0., 1.));
+    return 0;
+}
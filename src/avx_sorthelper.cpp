@@ -306,6 +306,70 @@ Vc_CONST AVX2::uint_v sorted<CurrentImplementation::current()>(AVX2::uint_v x_)
 
     return concat(_mm_unpacklo_epi32(l, h), _mm_unpackhi_epi32(l, h));
 }
+
+// sorting network for four 64-bit entries: [01][23], [03][12], [01][23]
+template <typename Min, typename Max>
+static Vc_INTRINSIC __m256i sorted4x64(__m256i x, Min min, Max max)
+{
+    __m256i y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(min(x, y), max(x, y), 0xcc);
+    y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(0, 1, 2, 3));
+    x = _mm256_blend_epi32(min(x, y), max(x, y), 0xf0);
+    y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_blend_epi32(min(x, y), max(x, y), 0xcc);
+}
+template <>
+Vc_CONST AVX2::llong_v sorted<CurrentImplementation::current()>(AVX2::llong_v x)
+{
+    return sorted4x64(x.data(), AVX::min_epi64, AVX::max_epi64);
+}
+template <>
+Vc_CONST AVX2::ullong_v sorted<CurrentImplementation::current()>(AVX2::ullong_v x)
+{
+    return sorted4x64(x.data(), AVX::min_epu64, AVX::max_epu64);
+}
+template <>
+Vc_CONST AVX2::long_v sorted<CurrentImplementation::current()>(AVX2::long_v x)
+{
+    return sorted4x64(x.data(), AVX::min_epi64, AVX::max_epi64);
+}
+template <>
+Vc_CONST AVX2::ulong_v sorted<CurrentImplementation::current()>(AVX2::ulong_v x)
+{
+    return sorted4x64(x.data(), AVX::min_epu64, AVX::max_epu64);
+}
+
+// sorts both halves as short_v and merges them: the minima and the maxima of the low half
+// and the reversed high half are the lower and the upper half of the result
+static Vc_INTRINSIC __m256i sorted_epi8(__m256i lo16, __m256i hi16)
+{
+    const __m256i lo = AVX2::short_v(lo16).sorted().data();
+    const __m256i reverse8x16 = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                                 2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9,
+                                                 6, 7, 4, 5, 2, 3, 0, 1);
+    const __m256i hi = _mm256_permute4x64_epi64(
+        _mm256_shuffle_epi8(AVX2::short_v(hi16).sorted().data(), reverse8x16),
+        _MM_SHUFFLE(1, 0, 3, 2));
+    const __m256i m = _mm256_set1_epi16(0xff);
+    const AVX2::short_v l = _mm256_min_epi16(lo, hi);
+    const AVX2::short_v h = _mm256_max_epi16(lo, hi);
+    return _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(_mm256_and_si256(l.sorted().data(), m),
+                            _mm256_and_si256(h.sorted().data(), m)),
+        _MM_SHUFFLE(3, 1, 2, 0));
+}
+template <>
+Vc_CONST AVX2::schar_v sorted<CurrentImplementation::current()>(AVX2::schar_v x)
+{
+    return sorted_epi8(_mm256_cvtepi8_epi16(AVX::lo128(x.data())),
+                       _mm256_cvtepi8_epi16(AVX::hi128(x.data())));
+}
+template <>
+Vc_CONST AVX2::uchar_v sorted<CurrentImplementation::current()>(AVX2::uchar_v x)
+{
+    return sorted_epi8(_mm256_cvtepu8_epi16(AVX::lo128(x.data())),
+                       _mm256_cvtepu8_epi16(AVX::hi128(x.data())));
+}
 #endif  // AVX2
 
 template <>
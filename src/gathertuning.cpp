@@ -0,0 +1,175 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include <Vc/global.h>
+#include <Vc/common/gathertuning.h>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace
+{
+constexpr int strategyCount = 5;
+// the names of GatherScatterImplementation, as used in calibration files
+const char *const strategyNames[strategyCount] = {
+    "SimpleLoop", "SetIndexZero", "BitScanLoop", "PopcntSwitch", "HardwareGather"};
+const char *const operationNames[] = {"masked-gather", "masked-scatter", "gather"};
+const char *const implementationNames[] = {"Scalar", "SSE2", "SSE3",  "SSSE3", "SSE4_1",
+                                           "SSE4_2", "AVX",  "AVX2", "MIC"};
+
+/**\internal
+ * Formats \p key as e.g. "AVX2+0x80000 f32x8 masked-gather": the implementation with the
+ * extra instructions, the entry type and vector width, and the operation.
+ */
+std::string keyString(const Detail::GatherTuningKey &key)
+{
+    const unsigned int impl = key.implementation & ImplementationMask;
+    const unsigned int extra = key.implementation & ExtraInstructionsMask;
+    std::ostringstream s;
+    s << (impl <= MICImpl ? implementationNames[impl] : "unknown");
+    if (extra != 0) {
+        s << "+0x" << std::hex << extra << std::dec;
+    }
+    s << ' ' << key.kind << key.entryBits << 'x' << key.size << ' '
+      << operationNames[int(key.operation)];
+    return s.str();
+}
+
+struct Registry {
+    // never held during a calibration: it may execute other tuned operations (e.g.
+    // PopcntSwitch uses an unmasked gather if all lanes are active), whose function-local
+    // static initialization takes a guard of its own
+    std::mutex lock;
+    std::map<std::string, int> strategies;
+    bool environmentRead = false;
+};
+
+Registry &registry()
+{
+    static Registry r;
+    return r;
+}
+
+/**\internal
+ * Reads the "<key>: <strategy>" lines of \p filename. Existing entries are only replaced
+ * if \p overwrite is \c true.
+ */
+bool read(Registry &r, const char *filename, bool overwrite)
+{
+    std::ifstream file(filename);
+    if (!file) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto separator = line.rfind(": ");
+        if (line.empty() || line[0] == '#' || separator == std::string::npos) {
+            continue;
+        }
+        std::string name = line.substr(separator + 2);
+        name.erase(name.find_last_not_of(" \t\r") + 1);
+        for (int i = 0; i < strategyCount; ++i) {
+            if (name == strategyNames[i]) {
+                const std::string key = line.substr(0, separator);
+                if (overwrite) {
+                    r.strategies[key] = i;
+                } else {
+                    r.strategies.insert({key, i});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool write(const Registry &r, const char *filename)
+{
+    std::ofstream file(filename);
+    if (!file) {
+        return false;
+    }
+    file << "# Vc gather/scatter calibration\n";
+    for (const auto &entry : r.strategies) {
+        file << entry.first << ": " << strategyNames[entry.second] << '\n';
+    }
+    return bool(file);
+}
+}  // unnamed namespace
+
+bool save_gather_calibration(const char *filename)
+{
+    Registry &r = registry();
+    std::lock_guard<std::mutex> l(r.lock);
+    return write(r, filename);
+}
+
+bool load_gather_calibration(const char *filename)
+{
+    Registry &r = registry();
+    std::lock_guard<std::mutex> l(r.lock);
+    return read(r, filename, true);
+}
+
+namespace Detail
+{
+int tuned_gather_implementation(const GatherTuningKey &key, int (*calibrate)())
+{
+    Registry &r = registry();
+    const char *file = std::getenv("VC_GATHER_CALIBRATION");
+    const std::string name = keyString(key);
+    {
+        std::lock_guard<std::mutex> l(r.lock);
+        if (!r.environmentRead) {
+            r.environmentRead = true;
+            if (file) {
+                read(r, file, false);
+            }
+        }
+        const auto it = r.strategies.find(name);
+        if (it != r.strategies.end()) {
+            return it->second;
+        }
+    }
+    // calibrate without the lock; if another thread finished first, its result is kept
+    const int strategy = calibrate();
+    std::lock_guard<std::mutex> l(r.lock);
+    const auto inserted = r.strategies.insert({name, strategy});
+    if (inserted.second && file) {
+        write(r, file);
+    }
+    return inserted.first->second;
+}
+}  // namespace Detail
+}  // namespace Vc
+
+// vim: sw=4 sts=4 et tw=100
@@ -0,0 +1,241 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <Vc/common/parallel.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+namespace
+{
+/**\internal
+ * The chunk indexes [begin, end) a thread still has to process. The owner takes from the
+ * front, thieves take the back half.
+ */
+struct ChunkRange {
+    std::mutex lock;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+};
+
+thread_local bool insideParallelRegion = false;
+
+class ThreadPool
+{
+public:
+    static ThreadPool &instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    void run(std::size_t chunks, unsigned threads, void (*body)(void *, std::size_t),
+             void *context)
+    {
+        std::lock_guard<std::mutex> job(jobLock);
+        for (unsigned i = 0; i < threads; ++i) {
+            ranges[i].begin = chunks * i / threads;
+            ranges[i].end = chunks * (i + 1) / threads;
+        }
+        {
+            std::lock_guard<std::mutex> l(lock);
+            participants = threads;
+            active = threads - 1;
+            jobBody = body;
+            jobContext = context;
+            error = nullptr;
+            failed.store(false, std::memory_order_relaxed);
+            ++generation;
+        }
+        wake.notify_all();
+
+        insideParallelRegion = true;
+        work(0);
+        insideParallelRegion = false;
+
+        std::unique_lock<std::mutex> l(lock);
+        done.wait(l, [&] { return active == 0; });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    ThreadPool()
+    {
+        const unsigned n = std::max(1u, std::thread::hardware_concurrency());
+        ranges.reset(new ChunkRange[n]);
+        workers.reserve(n - 1);
+        for (unsigned id = 1; id < n; ++id) {
+            workers.emplace_back([this, id] { workerLoop(id); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> l(lock);
+            stop = true;
+        }
+        wake.notify_all();
+        for (auto &t : workers) {
+            t.join();
+        }
+    }
+
+    void workerLoop(unsigned id)
+    {
+        insideParallelRegion = true;
+        std::uint64_t seen = 0;
+        std::unique_lock<std::mutex> l(lock);
+        for (;;) {
+            wake.wait(l, [&] { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+            if (id >= participants) {
+                continue;
+            }
+            l.unlock();
+            work(id);
+            l.lock();
+            if (--active == 0) {
+                done.notify_all();
+            }
+        }
+    }
+
+    bool take(unsigned id, std::size_t &chunk)
+    {
+        ChunkRange &r = ranges[id];
+        std::lock_guard<std::mutex> l(r.lock);
+        if (r.begin == r.end) {
+            return false;
+        }
+        chunk = r.begin++;
+        return true;
+    }
+
+    bool steal(unsigned id, std::size_t &chunk)
+    {
+        for (unsigned k = 1; k < participants; ++k) {
+            ChunkRange &victim = ranges[(id + k) % participants];
+            std::size_t begin, end;
+            {
+                std::lock_guard<std::mutex> l(victim.lock);
+                const std::size_t remaining = victim.end - victim.begin;
+                if (remaining == 0) {
+                    continue;
+                }
+                end = victim.end;
+                begin = end - (remaining + 1) / 2;
+                victim.end = begin;
+            }
+            chunk = begin;
+            ChunkRange &own = ranges[id];
+            std::lock_guard<std::mutex> l(own.lock);
+            own.begin = begin + 1;
+            own.end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void work(unsigned id)
+    {
+        std::size_t chunk;
+        while (take(id, chunk) || steal(id, chunk)) {
+            if (failed.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            try {
+                jobBody(jobContext, chunk);
+            } catch (...) {
+                std::lock_guard<std::mutex> l(lock);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<ChunkRange[]> ranges;
+    std::mutex jobLock;  // serializes concurrent parallel regions
+    std::mutex lock;     // protects the members below
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::uint64_t generation = 0;
+    unsigned participants = 0;
+    unsigned active = 0;
+    bool stop = false;
+    void (*jobBody)(void *, std::size_t) = nullptr;
+    void *jobContext = nullptr;
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+};
+}  // unnamed namespace
+
+unsigned parallel_thread_count()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void parallel_for_chunks(std::size_t chunks, unsigned threads,
+                         void (*body)(void *context, std::size_t chunk), void *context)
+{
+    if (threads == 0 || threads > parallel_thread_count()) {
+        threads = parallel_thread_count();
+    }
+    if (threads > chunks) {
+        threads = static_cast<unsigned>(chunks);
+    }
+    if (threads <= 1 || insideParallelRegion) {
+        for (std::size_t i = 0; i < chunks; ++i) {
+            body(context, i);
+        }
+        return;
+    }
+    ThreadPool::instance().run(chunks, threads, body, context);
+}
+}  // namespace Detail
+}  // namespace Vc
+
+// vim: sw=4 sts=4 et tw=100
@@ -0,0 +1,118 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <Vc/common/prefetch.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+namespace
+{
+// the L1 stride of PrefetchDefault; kept unless a calibrated distance is clearly better
+constexpr std::size_t defaultDistance = 16 * 64;
+
+#ifdef Vc_IMPL_SSE
+/**\internal
+ * Returns the time of one pass of a streaming read loop over \p data with prefetches
+ * \p distance bytes ahead.
+ */
+double timeStreamingRead(const float *data, std::size_t size, std::size_t distance,
+                         volatile float &sink)
+{
+    const auto start = std::chrono::steady_clock::now();
+    __m128 sum = _mm_setzero_ps();
+    for (std::size_t i = 0; i < size; i += 16) {
+        const char *p = reinterpret_cast<const char *>(data + i);
+        _mm_prefetch(p + distance, _MM_HINT_T0);
+        sum = _mm_add_ps(sum, _mm_load_ps(data + i));
+        sum = _mm_add_ps(sum, _mm_load_ps(data + i + 4));
+        sum = _mm_add_ps(sum, _mm_load_ps(data + i + 8));
+        sum = _mm_add_ps(sum, _mm_load_ps(data + i + 12));
+    }
+    sink = _mm_cvtss_f32(sum);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**\internal
+ * Times a streaming read over a buffer larger than typical last-level caches with
+ * different prefetch distances and returns the fastest one.
+ */
+std::size_t calibrate()
+{
+    constexpr std::size_t size = (16 << 20) / sizeof(float);
+    std::unique_ptr<float[]> buffer(new float[size + 16]);
+    float *data = reinterpret_cast<float *>(
+        (reinterpret_cast<std::uintptr_t>(buffer.get()) + 63) & ~std::uintptr_t(63));
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = 1.f;
+    }
+    volatile float sink;
+    constexpr std::size_t candidateCount = 5;
+    static const std::size_t candidates[candidateCount] = {256, 512, defaultDistance, 2048,
+                                                           4096};
+    double best[candidateCount];
+    std::fill_n(best, candidateCount, 1e9);
+    // interleave the candidates, so that frequency changes affect all of them alike
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t c = 0; c < candidateCount; ++c) {
+            best[c] = std::min(best[c], timeStreamingRead(data, size, candidates[c], sink));
+        }
+    }
+    std::size_t chosen = 2;
+    for (std::size_t c = 0; c < candidateCount; ++c) {
+        if (best[c] < 0.95 * best[chosen]) {
+            chosen = c;
+        }
+    }
+    return candidates[chosen];
+}
+#else
+std::size_t calibrate() { return defaultDistance; }
+#endif
+}  // unnamed namespace
+
+std::size_t calibrate_prefetch_distance()
+{
+    if (const char *env = std::getenv("VC_PREFETCH_DISTANCE")) {
+        const long distance = std::strtol(env, nullptr, 0);
+        if (distance > 0) {
+            return std::size_t(distance);
+        }
+    }
+    return calibrate();
+}
+}  // namespace Detail
+}  // namespace Vc
+
+// vim: sw=4 sts=4 et tw=100
@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <Vc/global.h>
 #include <Vc/support.h>
+#include <Vc/dispatch.h>
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -35,6 +36,19 @@ bool isImplementationSupported(Implementation impl) { return impl == ScalarImpl;
 Vc::Implementation bestImplementationSupported() { return Vc::ScalarImpl; }
 
 unsigned int extraInstructionsSupported() { return 0; }
+
+namespace Detail
+{
+int selectImplementation(const Implementation *impls, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        if (impls[i] == ScalarImpl) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+}  // namespace Detail
 }
 
 #undef Vc_TARGET_NO_SIMD
@@ -28,6 +28,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Vc/global.h>
 #include <Vc/cpuid.h>
 #include <Vc/support.h>
+#include <Vc/dispatch.h>
+#include <cstdlib>
+#include <cstring>
 
 #ifdef Vc_MSVC
 #include <intrin.h>
@@ -128,6 +131,57 @@ unsigned int extraInstructionsSupported()
     return flags;
 }
 
+namespace Detail
+{
+/**\internal
+ * Returns the Implementation named by the \c VC_IMPL environment variable, or
+ * ImplementationMask if it is not set or not recognized.
+ */
+Vc_TARGET_NO_SIMD
+static Implementation implementationLimitFromEnvironment()
+{
+    const char *name = std::getenv("VC_IMPL");
+    if (name == nullptr) {
+        return ImplementationMask;
+    }
+    static const struct {
+        const char *name;
+        Implementation impl;
+    } names[] = {{"Scalar", ScalarImpl}, {"SSE2", SSE2Impl},     {"SSE3", SSE3Impl},
+                 {"SSSE3", SSSE3Impl},   {"SSE4_1", SSE41Impl},  {"SSE4_2", SSE42Impl},
+                 {"AVX", AVXImpl},       {"AVX2", AVX2Impl}};
+    for (const auto &entry : names) {
+        if (std::strcmp(name, entry.name) == 0) {
+            return entry.impl;
+        }
+    }
+    return ImplementationMask;
+}
+
+Vc_TARGET_NO_SIMD
+int selectImplementation(const Implementation *impls, std::size_t count)
+{
+    const Implementation limit = implementationLimitFromEnvironment();
+    const unsigned int extra = extraInstructionsSupported();
+    int best = -1;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Implementation impl = impls[i];
+        if (impl > limit || !isImplementationSupported(impl)) {
+            continue;
+        }
+        // the AVX2 target of vc_compile_for_all_implementations also uses FMA and BMI2
+        if (impl == AVX2Impl && (extra & (FmaInstructions | Bmi2Instructions)) !=
+                                    (FmaInstructions | Bmi2Instructions)) {
+            continue;
+        }
+        if (best < 0 || impl > impls[best]) {
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+}  // namespace Detail
+
 }
 
 #undef Vc_TARGET_NO_SIMD
@@ -0,0 +1,146 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <vector>
+
+using namespace Vc;
+
+template <class T, class U, std::size_t N> void roundTrip(std::size_t count)
+{
+    // one guard element after every array detects writes past the end
+    std::vector<T> aos(count * N + 1, T(-3));
+    for (std::size_t i = 0; i < count * N; ++i) {
+        aos[i] = T(i % 101);
+    }
+    std::vector<std::vector<U>> soa(N, std::vector<U>(count + 1, U(-7)));
+    U *ptrs[N];
+    for (std::size_t m = 0; m < N; ++m) {
+        ptrs[m] = soa[m].data();
+    }
+
+    aos_to_soa(aos.data(), count, ptrs);
+    for (std::size_t m = 0; m < N; ++m) {
+        for (std::size_t i = 0; i < count; ++i) {
+            COMPARE(soa[m][i], U(T((i * N + m) % 101)))
+                << "m: " << m << ", i: " << i << ", count: " << count;
+        }
+        COMPARE(soa[m][count], U(-7)) << "m: " << m << ", count: " << count;
+    }
+
+    std::fill(aos.begin(), aos.begin() + count * N, T(0));
+    soa_to_aos(ptrs, count, aos.data());
+    for (std::size_t i = 0; i < count * N; ++i) {
+        COMPARE(aos[i], T(i % 101)) << "i: " << i << ", count: " << count;
+    }
+    COMPARE(aos[count * N], T(-3)) << "count: " << count;
+}
+
+template <class T, class U, std::size_t N> void roundTrips()
+{
+    for (std::size_t count : {0, 1, 2, 3, 5, 8, 9, 16, 17, 31, 64, 101, 1000}) {
+        roundTrip<T, U, N>(count);
+    }
+}
+
+TEST_TYPES(V, memberCounts, AllVectors)
+{
+    using T = typename V::EntryType;
+    roundTrips<T, T, 1>();
+    roundTrips<T, T, 2>();
+    roundTrips<T, T, 3>();
+    roundTrips<T, T, 4>();
+    roundTrips<T, T, 5>();
+    roundTrips<T, T, 6>();
+    roundTrips<T, T, 7>();
+    roundTrips<T, T, 8>();
+    roundTrips<T, T, 9>();
+    roundTrips<T, T, 12>();
+    roundTrips<T, T, 15>();
+    roundTrips<T, T, 16>();
+}
+
+TEST(mixedMemberTypes)
+{
+    roundTrips<short, float, 3>();
+    roundTrips<float, double, 7>();
+    roundTrips<int, float, 5>();
+    roundTrips<unsigned short, int, 16>();
+    roundTrips<double, float, 2>();
+}
+
+struct Hit {
+    float x, y, z, t, e, q, w;
+};
+
+TEST(structures)
+{
+    std::vector<Hit> hits(53);
+    for (int i = 0; i < 53; ++i) {
+        hits[i] = {1.f * i, 2.f * i, 3.f * i, 4.f * i, 5.f * i, 6.f * i, -1.f * i};
+    }
+    std::vector<float> soa[7];
+    float *ptrs[7];
+    for (int m = 0; m < 7; ++m) {
+        soa[m].resize(hits.size());
+        ptrs[m] = soa[m].data();
+    }
+    aos_to_soa(hits.data(), hits.size(), ptrs);
+    for (int i = 0; i < 53; ++i) {
+        COMPARE(soa[0][i], 1.f * i);
+        COMPARE(soa[3][i], 4.f * i);
+        COMPARE(soa[6][i], -1.f * i);
+    }
+
+    std::vector<Hit> back(hits.size());
+    soa_to_aos(ptrs, hits.size(), back.data());
+    for (int i = 0; i < 53; ++i) {
+        COMPARE(back[i].x, hits[i].x);
+        COMPARE(back[i].e, hits[i].e);
+        COMPARE(back[i].w, hits[i].w);
+    }
+}
+
+TEST(streaming)
+{
+    // large enough for the non-temporal store path
+    constexpr std::size_t count = 3 * 100000 + 5;
+    std::vector<float> aos(count * 4);
+    for (std::size_t i = 0; i < aos.size(); ++i) {
+        aos[i] = float(i % 4) + float(i / 4 % 1000) * 4;
+    }
+    Vc::Memory<float_v> soa[4] = {Vc::Memory<float_v>(count), Vc::Memory<float_v>(count),
+                                  Vc::Memory<float_v>(count), Vc::Memory<float_v>(count)};
+    float *ptrs[4] = {soa[0], soa[1], soa[2], soa[3]};
+    aos_to_soa(aos.data(), count, ptrs);
+    for (std::size_t i = 0; i < count; i += 997) {
+        for (std::size_t m = 0; m < 4; ++m) {
+            COMPARE(soa[m][i], aos[i * 4 + m]) << "i: " << i;
+        }
+    }
+    COMPARE(soa[2][count - 1], aos[count * 4 - 2]);
+}
@@ -0,0 +1,175 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Vc;
+
+// text with a period of 7 bytes, so that matches fall on every offset of a register
+static std::string periodicText(std::size_t size)
+{
+    std::string text(size, 'a');
+    for (std::size_t i = 0; i < size; ++i) {
+        text[i] = "abcdefg"[i % 7];
+    }
+    return text;
+}
+
+TEST(memchr)
+{
+    const std::string text = periodicText(300);
+    // all combinations of unaligned begin and end, including empty ranges
+    for (std::size_t b = 0; b < 70; ++b) {
+        for (std::size_t e = b; e < text.size(); e += 13) {
+            const char *first = text.data() + b;
+            const char *last = text.data() + e;
+            for (char c : {'a', 'g', 'x'}) {
+                COMPARE(simd_memchr(first, last, c), std::find(first, last, c))
+                    << "b: " << b << ", e: " << e << ", c: " << c;
+            }
+        }
+    }
+    std::string zeros(1000, '\0');
+    zeros[777] = 'z';
+    COMPARE(simd_memchr(zeros.data() + 1, zeros.data() + zeros.size(), 'z'),
+            zeros.data() + 777);
+    COMPARE(simd_memchr(zeros.data() + 1, zeros.data() + 777, 'z'), zeros.data() + 777);
+}
+
+TEST(count)
+{
+    const std::string text = periodicText(5000);
+    for (std::size_t b = 0; b < 70; ++b) {
+        for (std::size_t e = b; e < text.size(); e += 97) {
+            const char *first = text.data() + b;
+            const char *last = text.data() + e;
+            const std::size_t expected = std::count(first, last, 'c');
+            COMPARE(simd_count(first, last, 'c'), expected) << "b: " << b << ", e: " << e;
+        }
+    }
+    // more than 255 matches per byte counter
+    const std::string same(20000, '\n');
+    COMPARE(simd_count(same.data() + 3, same.data() + same.size(), '\n'),
+            same.size() - 3);
+}
+
+TEST(findFirstOf)
+{
+    const std::string text = periodicText(300);
+    const std::string needleSets[] = {"", "f", "xf", "xyzd", "xyzwvutsrqg", "!@#$%^&*()"};
+    for (const std::string &needles : needleSets) {
+        for (std::size_t b = 0; b < 70; ++b) {
+            const char *first = text.data() + b;
+            const char *last = text.data() + text.size() - b / 2;
+            COMPARE(simd_find_first_of(first, last, needles.data(),
+                                       needles.data() + needles.size()),
+                    std::find_first_of(first, last, needles.begin(), needles.end()))
+                << "needles: " << needles << ", b: " << b;
+        }
+    }
+}
+
+TEST(search)
+{
+    std::string text = periodicText(400);
+    text.replace(333, 5, "hello");
+    const std::string patterns[] = {"", "a", "ab", "gab", "fgabcdefga", "hello", "hellp",
+                                    "fgabcdefgabcdefgabcdefgabcdefgabcdefgx"};
+    for (const std::string &pattern : patterns) {
+        for (std::size_t b = 0; b < 70; ++b) {
+            const char *first = text.data() + b;
+            const char *last = text.data() + text.size() - b;
+            COMPARE(simd_search(first, last, pattern.data(),
+                                pattern.data() + pattern.size()),
+                    std::search(first, last, pattern.begin(), pattern.end()))
+                << "pattern: " << pattern << ", b: " << b;
+        }
+    }
+}
+
+TEST(split)
+{
+    const std::string texts[] = {"", "\n", "a\n\nbc\n", "no delimiter",
+                                 periodicText(200) + '\n' + periodicText(50)};
+    for (const std::string &text : texts) {
+        for (char delimiter : {'\n', 'd'}) {
+            std::vector<std::string> expected(1);
+            for (char c : text) {
+                if (c == delimiter) {
+                    expected.emplace_back();
+                } else {
+                    expected.back() += c;
+                }
+            }
+            std::vector<std::string> fields;
+            simd_split(text.data(), text.data() + text.size(), delimiter,
+                       [&](const char *b, const char *e) { fields.emplace_back(b, e); });
+            VERIFY(fields == expected) << "text: " << text;
+        }
+    }
+}
+
+TEST(utf8)
+{
+    const std::string ascii = periodicText(100);
+    const std::pair<std::string, std::size_t> cases[] = {
+        // the position of the first ill-formed sequence, or npos
+        {"", std::string::npos},
+        {"\xc3\xa9t\xc3\xa9", std::string::npos},                // U+00E9
+        {"\xe2\x82\xac", std::string::npos},                     // U+20AC
+        {"\xf0\x9f\x98\x80", std::string::npos},                 // U+1F600
+        {"\xf4\x8f\xbf\xbf", std::string::npos},                 // U+10FFFF
+        {"\xed\x9f\xbf", std::string::npos},                     // U+D7FF
+        {"ab\x80", 2},                                           // lone continuation
+        {"\xc0\xaf", 0},                                         // overlong
+        {"\xe0\x80\xaf", 0},                                     // overlong
+        {"\xf0\x80\x80\xaf", 0},                                 // overlong
+        {"\xed\xa0\x80", 0},                                     // surrogate
+        {"\xf4\x90\x80\x80", 0},                                 // above U+10FFFF
+        {"\xf5\x80\x80\x80", 0},                                 // invalid lead byte
+        {"x\xe2\x82", 1},                                        // truncated
+        {"\xe2\x82x", 0},                                        // missing continuation
+    };
+    for (const auto &c : cases) {
+        // place the sequence at every offset of a register, after and before ASCII
+        for (std::size_t offset = 0; offset < 40; ++offset) {
+            const std::string text =
+                ascii.substr(0, offset) + c.first + ascii.substr(offset);
+            const char *first = text.data();
+            const char *last = first + text.size();
+            const char *expected =
+                c.second == std::string::npos ? last : first + offset + c.second;
+            COMPARE(simd_utf8_find_invalid(first, last), expected)
+                << "case: " << c.first << ", offset: " << offset;
+            COMPARE(simd_utf8_validate(first, last), c.second == std::string::npos);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TEST_TYPES(V, compressExpand,
+           concat<AllVectors, vir::Typelist<Vc::schar_v, Vc::uchar_v>, SimdArrays<15>,
+                  SimdArrays<8>, SimdArrays<3>>)
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    const T sentinel = T(-1);
+    const V values([](int i) { return T(i + 1); });
+    std::mt19937 rne;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const unsigned pattern = repetition < 2 ? -repetition : rne();
+        const M mask = V([&](int i) { return T((pattern >> (i % 32)) & 1); }) != V(0);
+
+        T buffer[2 * V::Size];
+        std::fill_n(buffer, 2 * V::Size, sentinel);
+        const std::size_t n = Vc::compress_store(values, mask, buffer);
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (mask[i]) {
+                COMPARE(buffer[k], values[i]) << "k: " << k << ", " << mask;
+                ++k;
+            }
+        }
+        COMPARE(n, k) << mask;
+        for (; k < 2 * V::Size; ++k) {
+            COMPARE(buffer[k], sentinel) << "k: " << k << ", " << mask;
+        }
+
+        const V expanded = Vc::expand_load(&buffer[0], mask);
+        COMPARE(expanded, Vc::iif(mask, values, V(0))) << mask;
+    }
+}
+
+TEST_TYPES(V, simdCopyIf, concat<AllVectors, vir::Typelist<Vc::schar_v, Vc::uchar_v>>)
+{
+    using T = typename V::EntryType;
+    for (std::size_t size : {0, 1, 3, 16, 17, 100, 1001}) {
+        std::vector<T> in(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            in[i] = T((i * 7) % 13);
+        }
+        std::vector<T> out(size + 1, T(-1)), ref(size + 1, T(-1));
+        const auto pred = [](auto x) { return x > 5; };
+        const auto refEnd = std::copy_if(in.begin(), in.end(), ref.begin(), pred);
+        const auto end = Vc::simd_copy_if(in.begin(), in.end(), out.begin(), pred);
+        COMPARE(end - out.begin(), refEnd - ref.begin()) << "size: " << size;
+        COMPARE(out == ref, true) << "size: " << size;
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,98 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include "dispatch_kernel.h"
+#include <cstdlib>
+
+using Dispatcher = Vc::Dispatch<DispatchTestKernel, Vc::ScalarImpl, Vc::SSE2Impl,
+                                Vc::SSE42Impl, Vc::AVXImpl, Vc::AVX2Impl>;
+
+static void setImplementationLimit(const char *name)
+{
+#ifdef _WIN32
+    _putenv_s("VC_IMPL", name);
+#else
+    setenv("VC_IMPL", name, 1);
+#endif
+}
+
+static void verifyKernel(Vc::Implementation expected)
+{
+    float in[37], out[37];
+    for (int i = 0; i < 37; ++i) {
+        in[i] = i;
+    }
+    COMPARE(Dispatcher::call(&in[0], &out[0], 37u), expected);
+    for (int i = 0; i < 37; ++i) {
+        COMPARE(out[i], 2.f * i + 1.f) << "i: " << i;
+    }
+}
+
+TEST(selectsBestSupported)
+{
+    const Vc::Implementation best = Vc::bestImplementationSupported();
+    const Vc::Implementation selected = Dispatcher::selected();
+    VERIFY(Vc::isImplementationSupported(selected));
+    VERIFY(selected <= best);
+    if (best == Vc::AVX2Impl && std::getenv("VC_IMPL") == nullptr) {
+        const unsigned int fmaBmi2 = Vc::FmaInstructions | Vc::Bmi2Instructions;
+        if ((Vc::extraInstructionsSupported() & fmaBmi2) == fmaBmi2) {
+            COMPARE(selected, Vc::AVX2Impl);
+        } else {
+            COMPARE(selected, Vc::AVXImpl);
+        }
+    }
+    verifyKernel(selected);
+}
+
+TEST(environmentOverride)
+{
+    const struct {
+        const char *name;
+        Vc::Implementation expected;
+    } overrides[] = {{"Scalar", Vc::ScalarImpl}, {"SSE2", Vc::SSE2Impl},
+                     {"SSSE3", Vc::SSE2Impl},    {"SSE4_2", Vc::SSE42Impl},
+                     {"AVX", Vc::AVXImpl},       {"AVX2", Vc::AVX2Impl}};
+    const unsigned int fmaBmi2 = Vc::FmaInstructions | Vc::Bmi2Instructions;
+    for (const auto &o : overrides) {
+        if (!Vc::isImplementationSupported(o.expected) ||
+            (o.expected == Vc::AVX2Impl &&
+             (Vc::extraInstructionsSupported() & fmaBmi2) != fmaBmi2)) {
+            continue;
+        }
+        setImplementationLimit(o.name);
+        Dispatcher::resolve();
+        COMPARE(Dispatcher::selected(), o.expected) << "VC_IMPL=" << o.name;
+        verifyKernel(o.expected);
+    }
+    setImplementationLimit("unknown");
+    Dispatcher::resolve();
+    VERIFY(Vc::isImplementationSupported(Dispatcher::selected()));
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,166 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+template <class T> static std::vector<T> interestingDivisors()
+{
+    using L = std::numeric_limits<T>;
+    std::vector<T> divisors = {T(L::max() / 3), T(L::max() - 1), L::max()};
+    for (unsigned long long d : {1ull, 2ull, 3ull, 5ull, 6ull, 7ull, 10ull, 25ull, 100ull,
+                                 641ull, 1000ull, 4096ull, 1000000007ull, 1ull << 40}) {
+        if (d < (unsigned long long)L::max()) {
+            divisors.push_back(T(d));
+        }
+    }
+    if (std::is_signed<T>::value) {
+        const std::size_t n = divisors.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            divisors.push_back(T(-divisors[i]));
+        }
+        divisors.push_back(L::min());
+    }
+    std::mt19937_64 rne;
+    for (int i = 0; i < 200; ++i) {
+        const T d = T(rne());
+        if (d != 0) {
+            divisors.push_back(d);
+        }
+    }
+    return divisors;
+}
+
+TEST_TYPES(V, divide,
+           concat<IntVectors, IntSimdArrays<7>, IntSimdArrays<19>, schar_v, uchar_v,
+                  llong_v, ullong_v, SimdArray<schar, 19>, SimdArray<ullong, 7>>)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937_64 rne;
+    for (const T d : interestingDivisors<T>()) {
+        const divider<T> div(d);
+        COMPARE(div.divisor(), d);
+        for (int i = 0; i < 200; ++i) {
+            const V n = V::generate([&](int lane) {
+                switch ((i + lane) % 5) {
+                case 0: return L::min();
+                case 1: return L::max();
+                case 2: return T(i * int(V::size()) + lane);
+                case 3: return T(-(i * int(V::size()) + lane));
+                default: return T(rne());
+                }
+            });
+            const V q = n / div;
+            const V r = n % div;
+            V q2 = n;
+            q2 /= div;
+            for (std::size_t lane = 0; lane < V::size(); ++lane) {
+                const T x = n[lane];
+                if (std::is_signed<T>::value && x == L::min() && d == T(-1)) {
+                    continue;  // overflows
+                }
+                COMPARE(T(q[lane]), T(x / d)) << "x: " << x << ", d: " << d;
+                COMPARE(T(r[lane]), T(x % d)) << "x: " << x << ", d: " << d;
+                COMPARE(T(q2[lane]), T(x / d)) << "x: " << x << ", d: " << d;
+            }
+        }
+    }
+}
+
+TEST(scalarUshort)
+{
+    // every divisor, a spread of numerators including the extremes
+    for (unsigned d = 1; d <= 0xffffu; ++d) {
+        const divider<ushort> div(d);
+        for (unsigned x = 0; x <= 0xffffu; x += 251) {
+            COMPARE(ushort(x) / div, ushort(x / d)) << "x: " << x << ", d: " << d;
+        }
+        COMPARE(ushort(0xffff) / div, ushort(0xffffu / d)) << "d: " << d;
+        COMPARE(ushort(0xffff) % div, ushort(0xffffu % d)) << "d: " << d;
+    }
+}
+
+TEST(scalarShort)
+{
+    for (int d = -0x8000; d <= 0x7fff; ++d) {
+        if (d == 0) {
+            continue;
+        }
+        const divider<short> div(d);
+        for (int x = -0x8000; x <= 0x7fff; x += 251) {
+            COMPARE(short(x) / div, short(x / d)) << "x: " << x << ", d: " << d;
+            COMPARE(short(x) % div, short(x % d)) << "x: " << x << ", d: " << d;
+        }
+        COMPARE(short(0x7fff) / div, short(0x7fff / d)) << "d: " << d;
+    }
+}
+
+TEST(scalar8)
+{
+    for (int d = 1; d <= 0xff; ++d) {
+        const divider<uchar> div(d);
+        for (int x = 0; x <= 0xff; ++x) {
+            COMPARE(uchar(x) / div, uchar(x / d)) << "x: " << x << ", d: " << d;
+            COMPARE(uchar(x) % div, uchar(x % d)) << "x: " << x << ", d: " << d;
+        }
+    }
+    for (int d = -0x80; d <= 0x7f; ++d) {
+        if (d == 0) {
+            continue;
+        }
+        const divider<schar> div(d);
+        for (int x = -0x80; x <= 0x7f; ++x) {
+            if (x == -0x80 && d == -1) {
+                continue;  // overflows
+            }
+            COMPARE(schar(x) / div, schar(x / d)) << "x: " << x << ", d: " << d;
+            COMPARE(schar(x) % div, schar(x % d)) << "x: " << x << ", d: " << d;
+        }
+    }
+}
+
+TEST_TYPES(T, scalar64, concat<long long, unsigned long long>)
+{
+    using L = std::numeric_limits<T>;
+    std::mt19937_64 rne;
+    for (const T d : interestingDivisors<T>()) {
+        const divider<T> div(d);
+        for (int i = 0; i < 1000; ++i) {
+            const T x = i == 0 ? L::min() : i == 1 ? L::max() : T(rne() >> (i % 64));
+            if (std::is_signed<T>::value && x == L::min() && d == T(-1)) {
+                continue;  // overflows
+            }
+            COMPARE(x / div, T(x / d)) << "x: " << x << ", d: " << d;
+            COMPARE(x % div, T(x % d)) << "x: " << x << ", d: " << d;
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <cmath>
+
+using namespace Vc;
+
+// The references are computed in double precision. For double they are off by up to
+// ½ ulp themselves, thus the tolerance for double is one ulp larger than documented.
+template <typename T> static void setTolerance(int maxUlp)
+{
+    setFuzzyness<T>(std::is_same<T, double>::value ? maxUlp + 1 : maxUlp);
+}
+
+// compares f against the double-precision std function g on random inputs in [lo, hi] {{{1
+template <typename V, typename F, typename G>
+static void compareToStd(F &&f, G &&g, typename V::EntryType lo, typename V::EntryType hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * (hi - lo) + lo;
+        const V reference = x.apply([&](T _x) { return T(g(double(_x))); });
+        FUZZY_COMPARE(f(x), reference) << ", x = " << x << ", i = " << i;
+    }
+}
+
+// exp {{{1
+template <int Ulp, typename V> static void checkExp()
+{
+    typedef typename V::EntryType T;
+    setTolerance<T>(Common::FastExp<T, Ulp>::max_ulp);
+    const T lo = std::is_same<T, float>::value ? -87 : -708;
+    const T hi = std::is_same<T, float>::value ? 88 : 709;
+    compareToStd<V>([](V x) { return Vc::fast::exp<Ulp>(x); },
+                    [](double x) { return std::exp(x); }, lo, hi);
+    compareToStd<V>([](V x) { return Vc::fast::exp<Ulp>(x); },
+                    [](double x) { return std::exp(x); }, -1, 1);
+}
+
+TEST_TYPES(V, testExp, RealTypes)
+{
+    checkExp<4, V>();
+    checkExp<192, V>();
+    checkExp<2048, V>();
+    checkExp<1 << 22, V>();
+
+    // clamped inputs saturate
+    COMPARE(Vc::fast::exp(V(1000)), Vc::fast::exp(V(1000000)));
+    VERIFY(all_of(Vc::fast::exp(V(-1000)) > V(0)));
+}
+
+// log {{{1
+template <int Ulp, typename V> static void checkLog()
+{
+    typedef typename V::EntryType T;
+    setTolerance<T>(Common::FastLog<T, Ulp>::max_ulp);
+    compareToStd<V>([](V x) { return Vc::fast::log<Ulp>(x); },
+                    [](double x) { return std::log(x); }, T(0.25), T(4));
+    compareToStd<V>([](V x) { return Vc::fast::log<Ulp>(x); },
+                    [](double x) { return std::log(x); }, std::numeric_limits<T>::min(),
+                    T(1e30));
+}
+
+TEST_TYPES(V, testLog, RealTypes)
+{
+    checkLog<4, V>();
+    checkLog<32, V>();
+    checkLog<2048, V>();
+    checkLog<1 << 26, V>();
+    COMPARE(Vc::fast::log(V(1)), V(0));
+}
+
+// sin & cos {{{1
+template <int Ulp, typename V> static void checkSinCos()
+{
+    typedef typename V::EntryType T;
+    setTolerance<T>(Common::FastSinCos<T, Ulp>::max_ulp);
+    const T range = std::is_same<T, float>::value ? 128 : 1e6;
+    compareToStd<V>([](V x) { return Vc::fast::sin<Ulp>(x); },
+                    [](double x) { return std::sin(x); }, -range, range);
+    compareToStd<V>([](V x) { return Vc::fast::cos<Ulp>(x); },
+                    [](double x) { return std::cos(x); }, -range, range);
+    compareToStd<V>([](V x) { return Vc::fast::sin<Ulp>(x); },
+                    [](double x) { return std::sin(x); }, -4, 4);
+    compareToStd<V>([](V x) { return Vc::fast::cos<Ulp>(x); },
+                    [](double x) { return std::cos(x); }, -4, 4);
+}
+
+TEST_TYPES(V, testSinCos, RealTypes)
+{
+    checkSinCos<4, V>();
+    checkSinCos<1024, V>();
+    checkSinCos<1 << 22, V>();
+    COMPARE(Vc::fast::sin(V(0)), V(0));
+    COMPARE(Vc::fast::cos(V(0)), V(1));
+}
+
+// vim: foldmethod=marker
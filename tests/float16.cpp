@@ -0,0 +1,137 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <cstring>
+
+using namespace Vc;
+
+static std::uint32_t bits(float x)
+{
+    std::uint32_t r;
+    std::memcpy(&r, &x, 4);
+    return r;
+}
+static float from_bits(std::uint32_t x)
+{
+    float r;
+    std::memcpy(&r, &x, 4);
+    return r;
+}
+
+TEST(scalarConversion)
+{
+    COMPARE(float16(1.f).bits(), 0x3c00);
+    COMPARE(float16(-2.f).bits(), 0xc000);
+    COMPARE(float16(65504.f).bits(), 0x7bff);  // largest finite
+    COMPARE(float16(65520.f).bits(), 0x7c00);  // rounds to inf
+    COMPARE(float16(-1e10f).bits(), 0xfc00);
+    COMPARE(float16(5.9604645e-08f).bits(), 0x0001);  // smallest subnormal
+    COMPARE(float16(2.9802322e-08f).bits(), 0x0000);  // tie rounds to even (zero)
+    COMPARE(float16(8.9406967e-08f).bits(), 0x0002);  // tie rounds to even
+    COMPARE(float16(1.f + 1.f / 2048).bits(), 0x3c00);  // tie rounds to even
+    COMPARE(float16(1.f + 3.f / 2048).bits(), 0x3c02);  // tie rounds to even
+    COMPARE(float16(std::numeric_limits<float>::infinity()).bits(), 0x7c00);
+    COMPARE(float16(from_bits(0x7fc00000u)).bits(), 0x7e00);
+    COMPARE(float16(from_bits(0xffa00000u)).bits(), 0xfe00 | 0x100);
+
+    // every binary16 value converts to float and back unchanged, except that NaNs are
+    // quieted
+    for (std::uint32_t h = 0; h < 0x10000; ++h) {
+        const float f = float16::from_bits(h);
+        const bool nan = (h & 0x7fff) > 0x7c00;
+        COMPARE(float16(f).bits(), nan ? h | 0x0200 : h) << "h = " << std::hex << h;
+    }
+    COMPARE(bits(float16::from_bits(0x0001)), 0x33800000u);
+    COMPARE(bits(float16::from_bits(0x8000)), 0x80000000u);
+    COMPARE(bits(float16::from_bits(0x7d00)), 0x7fe00000u);
+}
+
+TEST_TYPES(V, loadStore, float_v, SimdArray<float, 1>, SimdArray<float, 3>,
+           SimdArray<float, 8>, SimdArray<float, 17>)
+{
+    constexpr std::size_t Count = 0x10000;
+    alignas(Vc::VectorAlignment) static float16 mem[Count];
+    for (std::size_t i = 0; i < Count; ++i) {
+        mem[i] = float16::from_bits(i);
+    }
+    for (std::size_t i = 0; i + V::Size <= Count; i += V::Size) {
+        const V x(&mem[i], Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            // compare bit patterns, NaN != NaN
+            COMPARE(bits(x[j]), bits(mem[i + j])) << "i + j = " << i + j;
+        }
+    }
+
+    alignas(Vc::VectorAlignment) float16 out[V::Size];
+    for (float scale : {1e-6f, 1.f, 1e5f}) {
+        for (int repetition = 0; repetition < 10000; ++repetition) {
+            const V x = (V::Random() - 0.5f) * scale;
+            x.store(out, Vc::Aligned);
+            for (std::size_t j = 0; j < V::Size; ++j) {
+                COMPARE(out[j].bits(), float16(x[j]).bits()) << "x = " << x;
+            }
+            V y;
+            y.load(out, Vc::Aligned);
+            COMPARE(y, V::generate([&](std::size_t j) { return float(out[j]); }));
+        }
+    }
+}
+
+TEST_TYPES(V, maskedStore, float_v, SimdArray<float, 1>, SimdArray<float, 3>,
+           SimdArray<float, 8>, SimdArray<float, 17>)
+{
+    float16 out[V::Size];
+    const V x = V::IndexesFromZero();
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        out[j] = -1.f;
+    }
+    x.store(out, x > 1, Vc::Unaligned);
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        COMPARE(float(out[j]), j > 1 ? float(j) : -1.f);
+    }
+}
+
+TEST_TYPES(V, gatherScatter, float_v, SimdArray<float, 1>, SimdArray<float, 3>,
+           SimdArray<float, 8>, SimdArray<float, 17>)
+{
+    using IV = SimdArray<int, V::Size>;
+    float16 mem[3 * V::Size + 1];
+    for (std::size_t i = 0; i < 3 * V::Size + 1; ++i) {
+        mem[i] = float(i) + 0.5f;
+    }
+    const IV indexes = IV::IndexesFromZero() * 3;
+    V x(mem, indexes);
+    COMPARE(x, V::IndexesFromZero() * 3 + 0.5f);
+    x = -x;
+    x.scatter(mem, indexes);
+    for (std::size_t i = 0; i < 3 * V::Size + 1; ++i) {
+        const bool scattered = i % 3 == 0 && i < 3 * V::Size;
+        COMPARE(float(mem[i]), (scattered ? -1.f : 1.f) * (float(i) + 0.5f));
+    }
+}
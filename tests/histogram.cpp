@@ -0,0 +1,155 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <vector>
+
+using namespace Vc;
+
+TEST_TYPES(V, scatterAdd, AllVectors)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    // few bins, so that every pattern produces duplicate indexes
+    for (int bins = 1; bins <= 5; ++bins) {
+        for (int shift = 0; shift < 3; ++shift) {
+            const IT indexes([&](int n) { return (n * n + shift) % bins; });
+            const V values([](int n) { return n + 1; });
+            std::vector<T> mem(bins, T(10));
+            std::vector<T> expected(mem);
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                expected[indexes[i]] += values[i];
+            }
+            scatter_add(mem.data(), indexes, values);
+            for (int b = 0; b < bins; ++b) {
+                COMPARE(mem[b], expected[b]) << "bins: " << bins << ", indexes: " << indexes;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, scatterAddMasked, AllVectors)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    const int bins = 3;
+    const IT indexes([](int n) { return n % bins; });
+    const V values([](int n) { return n + 1; });
+    for (unsigned bits = 0; bits < (1u << std::min<std::size_t>(V::Size, 8)); ++bits) {
+        // an index mask, to cover the conversion to V::mask_type
+        const typename IT::mask_type mask =
+            IT([&](int n) { return n < 8 ? (bits >> n) & 1 : 0; }) != 0;
+        std::vector<T> mem(bins, T(1));
+        std::vector<T> expected(mem);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (mask[i]) {
+                expected[indexes[i]] += values[i];
+            }
+        }
+        scatter_add(mem.data(), indexes, values, mask);
+        for (int b = 0; b < bins; ++b) {
+            COMPARE(mem[b], expected[b]) << "mask: " << mask;
+        }
+    }
+}
+
+// all lengths around the vector width, to cover the partial last vector
+static const std::size_t histogramSizes[] = {0, 1, 3, 17, 64, 1000, 4099};
+
+TEST_TYPES(T, histogram, concat<float, double>)
+{
+    for (std::size_t size : histogramSizes) {
+        std::vector<T> in(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            // covers all bins, both edges, and values outside of [lo, hi)
+            in[i] = T(int(i * 7919 % 130) - 10) * T(0.25);
+        }
+        const std::size_t bins = 11;
+        const T lo = 0, hi = 27.5;
+        std::vector<unsigned> expected(bins, 1u);
+        for (T x : in) {
+            if (x >= lo && x < hi) {
+                ++expected[std::min(bins - 1, std::size_t((x - lo) * T(bins) / (hi - lo)))];
+            }
+        }
+        std::vector<unsigned> counts(bins, 1u);
+        simd_histogram(in.data(), in.data() + size, counts.data(), bins, lo, hi);
+        for (std::size_t b = 0; b < bins; ++b) {
+            COMPARE(counts[b], expected[b]) << "size: " << size << ", bin: " << b;
+        }
+
+        std::vector<unsigned> parallelCounts(bins, 1u);
+        simd_histogram(parallel_policy(4), in.data(), in.data() + size,
+                       parallelCounts.data(), bins, lo, hi);
+        for (std::size_t b = 0; b < bins; ++b) {
+            COMPARE(parallelCounts[b], expected[b]) << "size: " << size << ", bin: " << b;
+        }
+    }
+}
+
+TEST_TYPES(T, bincount, concat<int, unsigned int, short, unsigned short>)
+{
+    for (std::size_t size : histogramSizes) {
+        std::vector<T> in(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            in[i] = T(int(i * 31 % 23) - 2);
+        }
+        const std::size_t bins = 17;
+        std::vector<int> expected(bins, 0);
+        for (T x : in) {
+            if (x >= T(0) && std::size_t(x) < bins) {
+                ++expected[std::size_t(x)];
+            }
+        }
+        std::vector<int> counts(bins, 0);
+        simd_bincount(in.data(), in.data() + size, counts.data(), bins);
+        for (std::size_t b = 0; b < bins; ++b) {
+            COMPARE(counts[b], expected[b]) << "size: " << size << ", bin: " << b;
+        }
+
+        std::vector<int> parallelCounts(bins, 0);
+        simd_bincount(parallel, in.data(), in.data() + size, parallelCounts.data(), bins);
+        for (std::size_t b = 0; b < bins; ++b) {
+            COMPARE(parallelCounts[b], expected[b]) << "size: " << size << ", bin: " << b;
+        }
+    }
+}
+
+TEST_TYPES(T, bincountOutOfRange, concat<long long, unsigned long long>)
+{
+    // values that become valid bins if truncated to int before the range check
+    const T big = T(1) << 32;
+    const std::vector<T> in = {T(1), T(2), T(3), big + 3, big << 1, T(-1), big + 1, T(4)};
+    for (std::size_t size = 1; size <= in.size(); ++size) {
+        std::vector<int> counts(4, 0);
+        simd_bincount(in.data(), in.data() + size, counts.data(), counts.size());
+        COMPARE(counts[0], 0) << "size: " << size;
+        COMPARE(counts[1], 1) << "size: " << size;
+        COMPARE(counts[2], size >= 2 ? 1 : 0) << "size: " << size;
+        COMPARE(counts[3], size >= 3 ? 1 : 0) << "size: " << size;
+    }
+}
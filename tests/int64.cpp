@@ -0,0 +1,267 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace Vc;
+
+using Int64Vectors = vir::Typelist<llong_v, ullong_v, long_v, ulong_v>;
+using Int64Types =
+    vir::concat<Int64Vectors,
+                vir::Typelist<fixed_size_simd<long long, 8>,
+                              fixed_size_simd<unsigned long long, 5>, fixed_size_simd<long, 3>>>;
+
+// test data {{{1
+/*
+ * Returns a vector mixing the extreme values with small and random ones; \p i selects a
+ * different mix for every call.
+ */
+template <class V> V testData(int i)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    static std::mt19937_64 rng;
+    return V::generate([&](int lane) {
+        switch ((i + lane) % 6) {
+        case 0: return L::min();
+        case 1: return L::max();
+        case 2: return T(i * 3 - lane);
+        case 3: return T(rng() >> (rng() % 64));
+        default: return T(rng());
+        }
+    });
+}
+
+// unsigned arithmetic has defined overflow; use it for the reference results
+template <class T> T wrap(unsigned long long x) { return T(x); }
+template <class T> unsigned long long u(T x) { return static_cast<unsigned long long>(x); }
+
+TEST_TYPES(V, arithmetics, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i), b = testData<V>(i + 1);
+        COMPARE(a + b, V::generate([&](int n) { return wrap<T>(u(a[n]) + u(b[n])); }));
+        COMPARE(a - b, V::generate([&](int n) { return wrap<T>(u(a[n]) - u(b[n])); }));
+        COMPARE(a * b, V::generate([&](int n) { return wrap<T>(u(a[n]) * u(b[n])); }));
+        COMPARE(-a, V::generate([&](int n) { return wrap<T>(0ull - u(a[n])); }));
+        COMPARE(a & b, V::generate([&](int n) { return T(a[n] & b[n]); }));
+        COMPARE(a | b, V::generate([&](int n) { return T(a[n] | b[n]); }));
+        COMPARE(a ^ b, V::generate([&](int n) { return T(a[n] ^ b[n]); }));
+    }
+}
+
+TEST_TYPES(V, division, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        V b = testData<V>(i + 2);
+        where(b == 0) | b = T(7);
+        // L::min() / -1 overflows
+        where(b == T(-1)) | b = T(3);
+        COMPARE(a / b, V::generate([&](int n) { return T(a[n] / b[n]); }));
+        COMPARE(a % b, V::generate([&](int n) { return T(a[n] % b[n]); }));
+    }
+}
+
+TEST_TYPES(V, compares, Int64Types) //{{{1
+{
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        const V b = i % 5 == 0 ? a : testData<V>(i + 1);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE((a == b)[n], a[n] == b[n]);
+            COMPARE((a != b)[n], a[n] != b[n]);
+            COMPARE((a < b)[n], a[n] < b[n]) << a << b;
+            COMPARE((a <= b)[n], a[n] <= b[n]);
+            COMPARE((a > b)[n], a[n] > b[n]);
+            COMPARE((a >= b)[n], a[n] >= b[n]);
+        }
+    }
+}
+
+TEST_TYPES(V, minmax, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i), b = testData<V>(i + 1);
+        COMPARE(min(a, b), V::generate([&](int n) { return std::min<T>(a[n], b[n]); }));
+        COMPARE(max(a, b), V::generate([&](int n) { return std::max<T>(a[n], b[n]); }));
+        T lo = a[0], hi = a[0], sum = 0;
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            lo = std::min<T>(lo, a[n]);
+            hi = std::max<T>(hi, a[n]);
+            sum = wrap<T>(u(sum) + u(a[n]));
+        }
+        COMPARE(a.min(), lo);
+        COMPARE(a.max(), hi);
+        COMPARE(a.sum(), sum);
+        const V sorted = a.sorted();
+        for (std::size_t n = 1; n < V::size(); ++n) {
+            VERIFY(sorted[n - 1] <= sorted[n]) << sorted;
+        }
+    }
+}
+
+TEST_TYPES(V, shifts, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        const int shift = i % 64;
+        COMPARE(a << shift, V::generate([&](int n) { return wrap<T>(u(a[n]) << shift); }));
+        COMPARE(a >> shift, V::generate([&](int n) { return T(a[n] >> shift); }));
+    }
+}
+
+TEST_TYPES(V, vectorShifts, Int64Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        const V shifts([&](int n) { return T((i + 13 * n) % 64); });
+        COMPARE(a << shifts,
+                V::generate([&](int n) { return wrap<T>(u(a[n]) << int(shifts[n])); }));
+        COMPARE(a >> shifts, V::generate([&](int n) { return T(a[n] >> int(shifts[n])); }));
+    }
+}
+
+TEST_TYPES(V, indexesFromZero, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    COMPARE(V::IndexesFromZero(), V::generate([](int n) { return T(n); }));
+}
+
+TEST_TYPES(V, gatherScatter, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    std::vector<T> mem(97);
+    for (std::size_t i = 0; i < mem.size(); ++i) {
+        mem[i] = wrap<T>(0x0123456789abcdefull * (i + 1));
+    }
+    for (int i = 0; i < 97; ++i) {
+        const IT indexes([&](int n) { return (i + 7 * n) % 97; });
+        const V gathered(mem.data(), indexes);
+        COMPARE(gathered, V::generate([&](int n) { return mem[indexes[n]]; }));
+
+        std::vector<T> out(97, T(1));
+        const V values = testData<V>(i);
+        const IT scatterIndexes([&](int n) { return (i + 3 * n) % 97; });
+        values.scatter(out.data(), scatterIndexes);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE(out[scatterIndexes[n]], values[n]);
+        }
+    }
+}
+
+TEST_TYPES(V, maskedStore, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    alignas(V::MemoryAlignment) T mem[2 * V::Size + 1];
+    for (int i = 0; i < 100; ++i) {
+        const V values = testData<V>(i);
+        const M mask = i == 0 ? M(true) : testData<V>(i + 1) > testData<V>(i + 2);
+        std::fill(std::begin(mem), std::end(mem), T(7));
+        values.store(&mem[0], mask, Vc::Aligned);
+        values.store(&mem[V::Size + 1], mask, Vc::Unaligned);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE(mem[n], mask[n] ? values[n] : T(7)) << "mask: " << mask;
+            COMPARE(mem[n + V::Size + 1], mem[n]) << "mask: " << mask;
+        }
+        COMPARE(mem[V::Size], T(7));
+    }
+}
+
+TEST_TYPES(V, simdize, Int64Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    VERIFY((std::is_same<simdize<T>, V>::value));
+    VERIFY((std::is_same<simdize<T, 3>, SimdArray<T, 3>>::value));
+    VERIFY((std::is_same<typename simdize<std::tuple<T, float>>::base_type,
+                         std::tuple<V, simdize<float, V::Size>>>::value));
+}
+
+TEST_TYPES(V, simdForEach, Int64Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    std::vector<T> data(3 * V::Size + 1);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = wrap<T>(0x0123456789abcdefull * (i + 1));
+    }
+    const std::vector<T> ref = data;
+
+    Vc::simd_for_each(data.begin(), data.end(), [](auto &x) { x += T(1); });
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        COMPARE(data[i], wrap<T>(u(ref[i]) + 1u));
+    }
+
+    unsigned long long sum = 0;
+    Vc::simd_for_each(data.begin(), data.end(), [&](auto x, auto k) {
+        static_assert(std::is_same<decltype(x), V>::value, "");
+        sum += u(x.sum(k));
+    });
+    unsigned long long refSum = 0;
+    for (T x : data) {
+        refSum += u(x);
+    }
+    COMPARE(wrap<T>(sum), wrap<T>(refSum));
+}
+
+TEST_TYPES(V, casts, Int64Types) //{{{1
+{
+    using T = typename V::EntryType;
+    using D = fixed_size_simd<double, V::Size>;
+    using I = fixed_size_simd<int, V::Size>;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        COMPARE(simd_cast<D>(a), D::generate([&](int n) { return double(a[n]); }));
+        COMPARE(simd_cast<I>(a), I::generate([&](int n) { return int(a[n]); }));
+
+        const V bSource = testData<V>(i + 3);
+        const I b([&](int n) { return int(bSource[n]); });
+        COMPARE(simd_cast<V>(b), V::generate([&](int n) { return T(b[n]); }));
+
+        // doubles that are representable in T
+        const D c([&](int n) {
+            return double(std::is_signed<T>::value ? i * 1000003ll - n * 4000000000ll
+                                                   : i * 1000003ull + n * 4000000000ull) +
+                   0.5;
+        });
+        COMPARE(simd_cast<V>(c), V::generate([&](int n) { return T(c[n]); }));
+    }
+}
+
+// vim: foldmethod=marker
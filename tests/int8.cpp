@@ -0,0 +1,348 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace Vc;
+
+using Int8Vectors = vir::Typelist<schar_v, uchar_v>;
+using Int8Types =
+    vir::concat<Int8Vectors,
+                vir::Typelist<fixed_size_simd<signed char, 32>,
+                              fixed_size_simd<unsigned char, 7>,
+                              fixed_size_simd<signed char, 19>,
+                              fixed_size_simd<unsigned char, 64>>>;
+
+// test data {{{1
+/*
+ * Returns a vector mixing the extreme values with small and random ones; \p i selects a
+ * different mix for every call.
+ */
+template <class V> V testData(int i)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    static std::mt19937 rng;
+    return V::generate([&](int lane) {
+        switch ((i + lane) % 6) {
+        case 0: return L::min();
+        case 1: return L::max();
+        case 2: return T(i * 3 - lane);
+        default: return T(rng());
+        }
+    });
+}
+
+template <class T> T saturate(int x)
+{
+    using L = std::numeric_limits<T>;
+    return x < L::min() ? L::min() : x > L::max() ? L::max() : T(x);
+}
+
+TEST_TYPES(V, arithmetics, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i), b = testData<V>(i + 1);
+        COMPARE(a + b, V::generate([&](int n) { return T(a[n] + b[n]); }));
+        COMPARE(a - b, V::generate([&](int n) { return T(a[n] - b[n]); }));
+        COMPARE(a * b, V::generate([&](int n) { return T(a[n] * b[n]); }));
+        COMPARE(-a, V::generate([&](int n) { return T(-a[n]); }));
+        COMPARE(a & b, V::generate([&](int n) { return T(a[n] & b[n]); }));
+        COMPARE(a | b, V::generate([&](int n) { return T(a[n] | b[n]); }));
+        COMPARE(a ^ b, V::generate([&](int n) { return T(a[n] ^ b[n]); }));
+    }
+}
+
+TEST_TYPES(V, division, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        V b = testData<V>(i + 2);
+        where(b == 0) | b = T(7);
+        // L::min() / -1 overflows
+        where(b == T(-1)) | b = T(3);
+        COMPARE(a / b, V::generate([&](int n) { return T(a[n] / b[n]); }));
+        COMPARE(a % b, V::generate([&](int n) { return T(a[n] % b[n]); }));
+    }
+}
+
+TEST_TYPES(V, compares, Int8Types) //{{{1
+{
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        const V b = i % 5 == 0 ? a : testData<V>(i + 1);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE((a == b)[n], a[n] == b[n]);
+            COMPARE((a != b)[n], a[n] != b[n]);
+            COMPARE((a < b)[n], a[n] < b[n]) << a << b;
+            COMPARE((a <= b)[n], a[n] <= b[n]);
+            COMPARE((a > b)[n], a[n] > b[n]);
+            COMPARE((a >= b)[n], a[n] >= b[n]);
+        }
+        int less = 0;
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            less += a[n] < b[n];
+        }
+        COMPARE((a < b).count(), less);
+    }
+}
+
+TEST_TYPES(V, minmax, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i), b = testData<V>(i + 1);
+        COMPARE(min(a, b), V::generate([&](int n) { return std::min<T>(a[n], b[n]); }));
+        COMPARE(max(a, b), V::generate([&](int n) { return std::max<T>(a[n], b[n]); }));
+        T lo = a[0], hi = a[0], sum = 0;
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            lo = std::min<T>(lo, a[n]);
+            hi = std::max<T>(hi, a[n]);
+            sum = T(sum + a[n]);
+        }
+        COMPARE(a.min(), lo);
+        COMPARE(a.max(), hi);
+        COMPARE(a.sum(), sum);
+        const V sorted = a.sorted();
+        for (std::size_t n = 1; n < V::size(); ++n) {
+            VERIFY(sorted[n - 1] <= sorted[n]) << sorted;
+        }
+    }
+}
+
+TEST_TYPES(V, shifts, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        const int shift = i % 8;
+        COMPARE(a << shift, V::generate([&](int n) { return T(unsigned(a[n]) << shift); }));
+        COMPARE(a >> shift, V::generate([&](int n) { return T(a[n] >> shift); }));
+    }
+}
+
+TEST_TYPES(V, vectorShifts, Int8Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        const V shifts([&](int n) { return T((i + 13 * n) % 8); });
+        COMPARE(a << shifts,
+                V::generate([&](int n) { return T(unsigned(a[n]) << int(shifts[n])); }));
+        COMPARE(a >> shifts, V::generate([&](int n) { return T(a[n] >> int(shifts[n])); }));
+    }
+}
+
+TEST_TYPES(V, gatherScatter, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    std::vector<T> mem(97);
+    for (std::size_t i = 0; i < mem.size(); ++i) {
+        mem[i] = T(i * 37 + 5);
+    }
+    for (int i = 0; i < 97; ++i) {
+        const IT indexes([&](int n) { return (i + 7 * n) % 97; });
+        const V gathered(mem.data(), indexes);
+        COMPARE(gathered, V::generate([&](int n) { return mem[indexes[n]]; }));
+
+        std::vector<T> out(97, T(1));
+        const V values = testData<V>(i);
+        const IT scatterIndexes([&](int n) { return (i + 3 * n) % 97; });
+        values.scatter(out.data(), scatterIndexes);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE(out[scatterIndexes[n]], values[n]);
+        }
+    }
+}
+
+TEST_TYPES(V, maskedLoadStore, Int8Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    // place the vector across a page boundary, which takes the per-lane paths
+    alignas(4096) static T page[2 * 4096];
+    T *const mem = &page[4096 - V::Size / 2];
+    const V values = V::IndexesFromZero() + T(1);
+    const M masks[] = {M(true), values > T(V::Size / 2), (values & T(1)) == T(0),
+                       values == T(V::Size)};
+    for (const M &mask : masks) {
+        std::fill(mem, mem + V::Size, T(7));
+        values.store(mem, mask, Vc::Unaligned);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE(mem[n], mask[n] ? values[n] : T(7)) << "mask: " << mask;
+        }
+        V loaded = V(T(9));
+        loaded.load(mem, mask, Vc::Unaligned);
+        COMPARE(loaded, iif(mask, values, V(T(9)))) << "mask: " << mask;
+
+        std::fill(mem, mem + V::Size, T(7));
+        values.store(page, mask, Vc::Aligned);
+        loaded.setZero();
+        loaded.load(page, mask, Vc::Aligned);
+        COMPARE(loaded, iif(mask, values, V::Zero())) << "mask: " << mask;
+    }
+}
+
+TEST_TYPES(V, simdize, Int8Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    VERIFY((std::is_same<simdize<T>, V>::value));
+    VERIFY((std::is_same<simdize<T, 7>, SimdArray<T, 7>>::value));
+    VERIFY((std::is_same<typename simdize<std::tuple<T, short>>::base_type,
+                         std::tuple<V, simdize<short, V::Size>>>::value));
+}
+
+TEST_TYPES(V, simdForEach, Int8Vectors) //{{{1
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    for (std::size_t size : {std::size_t(1), V::Size - 1, V::Size, 3 * V::Size + 1}) {
+        std::vector<T> data(size + 1);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = T(i * 5);
+        }
+
+        // the tail is one masked iteration, inactive lanes are neither loaded nor stored
+        std::size_t active = 0;
+        Vc::simd_for_each(data.begin(), data.begin() + size, [&](auto &x, auto k) {
+            static_assert(std::is_same<decltype(x), V &>::value, "");
+            static_assert(std::is_same<decltype(k), M>::value, "");
+            VERIFY(Vc::none_of(!k && x != V::Zero())) << "inactive lanes must be zero";
+            x(k) += T(3);
+            active += k.count();
+        });
+        COMPARE(active, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(data[i], T(i * 5 + 3));
+        }
+        COMPARE(data[size], T(size * 5)) << "masked store wrote past the end";
+
+        unsigned sum = 0;
+        Vc::simd_for_each(data.begin(), data.begin() + size, [&](auto x) {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                sum += static_cast<unsigned char>(x[i]);
+            }
+        });
+        unsigned refSum = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            refSum += static_cast<unsigned char>(data[i]);
+        }
+        COMPARE(sum, refSum);
+    }
+}
+
+TEST_TYPES(V, casts, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    using S = fixed_size_simd<short, V::Size>;
+    using I = fixed_size_simd<int, V::Size>;
+    using F = fixed_size_simd<float, V::Size>;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i);
+        COMPARE(simd_cast<S>(a), S::generate([&](int n) { return short(a[n]); }));
+        COMPARE(simd_cast<I>(a), I::generate([&](int n) { return int(a[n]); }));
+        COMPARE(simd_cast<F>(a), F::generate([&](int n) { return float(a[n]); }));
+
+        // narrowing keeps the low bits
+        const I b([&](int n) { return i * 1000 + n * 77; });
+        COMPARE(simd_cast<V>(b), V::generate([&](int n) { return T(b[n]); }));
+        COMPARE(simd_cast<V>(simd_cast<S>(a)), a);
+
+        const auto k = a > T(10);
+        const auto kI = simd_cast<typename I::mask_type>(k);
+        for (std::size_t n = 0; n < V::size(); ++n) {
+            COMPARE(kI[n], a[n] > T(10));
+        }
+        COMPARE(simd_cast<typename V::mask_type>(kI), k);
+    }
+}
+
+TEST_TYPES(V, saturating, Int8Types) //{{{1
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    COMPARE(adds(V(L::max()), V(1)), V(L::max()));
+    COMPARE(subs(V(L::min()), V(1)), V(L::min()));
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i), b = testData<V>(i + 1);
+        COMPARE(adds(a, b), V::generate([&](int n) { return saturate<T>(a[n] + b[n]); }));
+        COMPARE(subs(a, b), V::generate([&](int n) { return saturate<T>(a[n] - b[n]); }));
+        COMPARE(adds(T(a[0]), T(b[0])), saturate<T>(a[0] + b[0]));
+    }
+}
+
+TEST_TYPES(V, average, vir::Typelist<uchar_v, ushort_v, fixed_size_simd<unsigned char, 33>>) //{{{1
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 1000; ++i) {
+        const V a = testData<V>(i), b = testData<V>(i + 1);
+        COMPARE(avg(a, b), V::generate([&](int n) { return T((a[n] + b[n] + 1) >> 1); }));
+    }
+}
+
+TEST_TYPES(N, maddubsAndSad, //{{{1
+           vir::Typelist<std::integral_constant<std::size_t, 8>,
+                         std::integral_constant<std::size_t, 16>,
+                         std::integral_constant<std::size_t, 24>,
+                         std::integral_constant<std::size_t, 32>,
+                         std::integral_constant<std::size_t, 64>>)
+{
+    using U = fixed_size_simd<unsigned char, N::value>;
+    using S = fixed_size_simd<signed char, N::value>;
+    using R = fixed_size_simd<short, N::value / 2>;
+    using D = fixed_size_simd<ullong, N::value / 8>;
+    // the extremes saturate the sum of the two products
+    COMPARE(maddubs(U(255), S(127)), R(32767));
+    COMPARE(maddubs(U(255), S(-128)), R(-32768));
+    for (int i = 0; i < 1000; ++i) {
+        const U a = testData<U>(i), c = testData<U>(i + 2);
+        const S b = testData<S>(i + 1);
+        COMPARE(maddubs(a, b), R::generate([&](int n) {
+                    return saturate<short>(a[2 * n] * b[2 * n] +
+                                           a[2 * n + 1] * b[2 * n + 1]);
+                }));
+        COMPARE(sad(a, c), D::generate([&](int n) {
+                    ullong sum = 0;
+                    for (int j = 8 * n; j < 8 * n + 8; ++j) {
+                        sum += std::abs(a[j] - c[j]);
+                    }
+                    return sum;
+                }));
+    }
+}
+
+// vim: foldmethod=marker
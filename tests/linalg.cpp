@@ -0,0 +1,204 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/linalg>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Vc;
+
+TEST_TYPES(T, transpose4x4, concat<float, double, int, unsigned int, short>)
+{
+    using A = SimdArray<T, 4>;
+    const A a([](int n) { return T(n); });
+    const A b([](int n) { return T(n + 4); });
+    const A c([](int n) { return T(n + 8); });
+    const A d([](int n) { return T(n + 12); });
+    A r[4];
+    tie(r[0], r[1], r[2], r[3]) = transpose(a, b, c, d);
+    for (int i = 0; i < 4; ++i) {
+        COMPARE(r[i], A([&](int n) { return T(4 * n + i); }));
+    }
+}
+
+// reference product in double precision; also returns the sum of the absolute values of
+// the terms for the error bound
+template <class T>
+double referenceDot(const T *a, const T *b, std::size_t ldb, std::size_t k, double &abs)
+{
+    double sum = 0;
+    abs = 0;
+    for (std::size_t p = 0; p < k; ++p) {
+        sum += double(a[p]) * double(b[p * ldb]);
+        abs += std::abs(double(a[p]) * double(b[p * ldb]));
+    }
+    return sum;
+}
+
+template <class T> T tolerance() { return std::is_same<T, float>::value ? 1e-6 : 1e-14; }
+
+TEST_TYPES(T, gemm, concat<float, double>)
+{
+    const std::size_t sizes[] = {1, 3, 4, 5, 17, 130, 300};
+    for (std::size_t m : sizes) {
+        for (std::size_t n : sizes) {
+            for (std::size_t k : {std::size_t(0), std::size_t(1), std::size_t(13),
+                                  std::size_t(600)}) {
+                const std::size_t lda = k + 3, ldb = n + 1, ldc = n + 2;
+                std::vector<T> a(m * lda), b(k * ldb), c(m * ldc);
+                for (std::size_t i = 0; i < a.size(); ++i) {
+                    a[i] = T(int(i % 19) - 9) / T(7);
+                }
+                for (std::size_t i = 0; i < b.size(); ++i) {
+                    b[i] = T(int(i % 23) - 11) / T(5);
+                }
+                for (std::size_t i = 0; i < c.size(); ++i) {
+                    c[i] = T(i % 5);
+                }
+                const std::vector<T> c0 = c;
+                const T alpha = T(0.5), beta = T(2);
+                gemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc);
+                for (std::size_t i = 0; i < m; ++i) {
+                    for (std::size_t j = 0; j < ldc; ++j) {
+                        if (j >= n) {
+                            // the padding between the rows is not touched
+                            COMPARE(c[i * ldc + j], c0[i * ldc + j]);
+                            continue;
+                        }
+                        double abs;
+                        const double ref =
+                            alpha * referenceDot(&a[i * lda], &b[j], ldb, k, abs) +
+                            beta * double(c0[i * ldc + j]);
+                        VERIFY(std::abs(ref - c[i * ldc + j]) <=
+                               tolerance<T>() * (k + 1) * (abs + std::abs(ref)))
+                            << "m: " << m << ", n: " << n << ", k: " << k << ", i: " << i
+                            << ", j: " << j << ", ref: " << ref << ", c: " << c[i * ldc + j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, gemmBetaZero, concat<float, double>)
+{
+    // with beta = 0 the previous contents of C, here NaNs, must not be read
+    const std::size_t n = 9;
+    std::vector<T> a(n * n, T(1)), b(n * n, T(2)), c(n * n, std::numeric_limits<T>::quiet_NaN());
+    gemm(n, n, n, T(1), a.data(), n, b.data(), n, T(0), c.data(), n);
+    for (T x : c) {
+        COMPARE(x, T(2 * n));
+    }
+}
+
+TEST_TYPES(T, gemv, concat<float, double>)
+{
+    for (std::size_t m : {0, 1, 4, 7, 33}) {
+        for (std::size_t n : {0, 1, 3, 8, 9, 100}) {
+            const std::size_t lda = n + 1;
+            std::vector<T> a(m * lda), x(n), y(m);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                a[i] = T(int(i % 19) - 9) / T(7);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i] = T(int(i % 5) - 2);
+            }
+            for (std::size_t i = 0; i < m; ++i) {
+                y[i] = T(i);
+            }
+            gemv(m, n, T(2), a.data(), lda, x.data(), T(-1), y.data());
+            for (std::size_t i = 0; i < m; ++i) {
+                double abs;
+                const double ref = 2 * referenceDot(&a[i * lda], x.data(), 1, n, abs) - i;
+                VERIFY(std::abs(ref - y[i]) <= tolerance<T>() * (n + 1) * (abs + i))
+                    << "m: " << m << ", n: " << n << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, transposeMatrix, concat<float, double, int, short>)
+{
+    for (std::size_t rows : {1, 3, 4, 13, 70, 130}) {
+        for (std::size_t cols : {1, 2, 4, 9, 65}) {
+            const std::size_t lda = cols + 2, ldb = rows + 3;
+            std::vector<T> a(rows * lda), b(cols * ldb, T(-1));
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                a[i] = T(i % 101);
+            }
+            transpose_matrix(rows, cols, a.data(), lda, b.data(), ldb);
+            for (std::size_t j = 0; j < cols; ++j) {
+                for (std::size_t i = 0; i < ldb; ++i) {
+                    COMPARE(b[j * ldb + i], i < rows ? a[i * lda + j] : T(-1))
+                        << "rows: " << rows << ", cols: " << cols;
+                }
+            }
+        }
+    }
+}
+
+template <class V, std::size_t N> void fixedSize()
+{
+    using T = typename V::EntryType;
+    Memory<V, N, N> a, b, c, t;
+    Memory<V, N> x, y;
+    for (std::size_t i = 0; i < N; ++i) {
+        x[i] = T(int(i) - 2);
+        for (std::size_t j = 0; j < N; ++j) {
+            a[i][j] = T((i * N + j) % 16);
+            b[i][j] = T(int(i) - int(j));
+        }
+    }
+    gemm(a, b, c);
+    gemv(a, x, y);
+    transpose_matrix(a, t);
+    // all products are small integers and therefore exact
+    for (std::size_t i = 0; i < N; ++i) {
+        T yi = 0;
+        for (std::size_t j = 0; j < N; ++j) {
+            T cij = 0;
+            for (std::size_t k = 0; k < N; ++k) {
+                cij += a[i][k] * b[k][j];
+            }
+            COMPARE(c[i][j], cij) << "N: " << N << ", i: " << i << ", j: " << j;
+            COMPARE(t[j][i], a[i][j]);
+            yi += a[i][j] * x[j];
+        }
+        COMPARE(y[i], yi) << "N: " << N << ", i: " << i;
+    }
+}
+
+TEST_TYPES(V, fixedSizeMatrices, RealVectors)
+{
+    fixedSize<V, 3>();
+    fixedSize<V, 4>();
+    fixedSize<V, 6>();
+    // large enough for the cache-blocked implementation
+    fixedSize<V, 70>();
+}
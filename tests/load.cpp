@@ -160,6 +160,53 @@ TEST_TYPES(Vec, streamingLoad, ALL_TYPES)
     }
 }
 
+TEST_TYPES(Vec, maskedLoad, ALL_TYPES)
+{
+    typedef typename Vec::EntryType T;
+    typedef typename Vec::Mask M;
+    enum { count = 4 * Vec::Size + 3 };
+    Vc::Memory<Vec, count> data;
+    for (int i = 0; i < count; ++i) {
+        data[i] = T(i + 1);
+    }
+
+    const Vec old = Vec(T(-1));
+    for (int i = 0; i + int(Vec::Size) <= count; ++i) {
+        for (int n = 0; n <= int(Vec::Size); ++n) {
+            const M mask = Vec(IndexesFromZero) < T(n);
+            Vec v = old;
+            if (i % Vec::Size == 0) {
+                v.load(&data[i], mask, Vc::Aligned);
+            } else {
+                v.load(&data[i], mask, Vc::Unaligned);
+            }
+            for (int j = 0; j < int(Vec::Size); ++j) {
+                COMPARE(v[j], j < n ? T(i + j + 1) : T(-1)) << "i: " << i << ", n: " << n;
+            }
+        }
+    }
+
+    // the remainder of the range with a mask that ends at the last element
+    const int tail = count % Vec::Size;
+    const M mask = Vec(IndexesFromZero) < T(tail);
+    Vec v = Vec::Zero();
+    v.load(&data[count - tail], mask, Vc::Unaligned);
+    for (int j = 0; j < int(Vec::Size); ++j) {
+        COMPARE(v[j], j < tail ? T(count - tail + j + 1) : T(0));
+    }
+
+    // alternating masks
+    M odd;
+    for (int j = 0; j < int(Vec::Size); ++j) {
+        odd[j] = j % 2 == 1;
+    }
+    v = old;
+    v.load(&data[0], odd, Vc::Aligned);
+    for (int j = 0; j < int(Vec::Size); ++j) {
+        COMPARE(v[j], j % 2 == 1 ? T(j + 1) : T(-1));
+    }
+}
+
 TEST_TYPES(
     Pair, loadCvt,
     concat<outer_product<Typelist<float>,
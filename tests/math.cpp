@@ -112,6 +112,159 @@ TEST_TYPES(V, testExp, RealTypes) //{{{1
     COMPARE(Vc::exp(V(0)), V(1));
 }
 
+// compares f against the double-precision std function g on random inputs in [lo, hi] {{{1
+template <typename V, typename F, typename G>
+static void compareToStd(F &&f, G &&g, typename V::EntryType lo, typename V::EntryType hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * (hi - lo) + lo;
+        const V reference = x.apply([&](T _x) { return T(g(double(_x))); });
+        FUZZY_COMPARE(f(x), reference) << ", x = " << x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testExp2, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    compareToStd<V>([](V x) { return Vc::exp2(x); }, [](double x) { return std::exp2(x); },
+                    -100, 100);
+    COMPARE(Vc::exp2(V(0)), V(1));
+    COMPARE(Vc::exp2(V(10)), V(1024));
+    COMPARE(Vc::exp2(V(-std::numeric_limits<T>::infinity())), V(0));
+    COMPARE(Vc::exp2(V(std::numeric_limits<T>::infinity())),
+            V(std::numeric_limits<T>::infinity()));
+    COMPARE(Vc::exp2(V(T(std::numeric_limits<T>::min_exponent - 3))),
+            V(std::numeric_limits<T>::min() / 4));
+}
+
+TEST_TYPES(V, testExp10, RealTypes) //{{{1
+{
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    compareToStd<V>([](V x) { return Vc::exp10(x); },
+                    [](double x) { return std::pow(10., x); }, -30, 30);
+    COMPARE(Vc::exp10(V(0)), V(1));
+    COMPARE(Vc::exp10(V(3)), V(1000));
+}
+
+TEST_TYPES(V, testExpm1, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    compareToStd<V>([](V x) { return Vc::expm1(x); }, [](double x) { return std::expm1(x); },
+                    -20, 20);
+    compareToStd<V>([](V x) { return Vc::expm1(x); }, [](double x) { return std::expm1(x); },
+                    T(-1e-3), T(1e-3));
+    COMPARE(Vc::expm1(V(0)), V(0));
+    COMPARE(Vc::expm1(V(-std::numeric_limits<T>::infinity())), V(-1));
+    const V tiny = std::numeric_limits<T>::denorm_min();
+    COMPARE(Vc::expm1(tiny), tiny);
+}
+
+TEST_TYPES(V, testLog1p, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    compareToStd<V>([](V x) { return Vc::log1p(x); }, [](double x) { return std::log1p(x); },
+                    T(-0.999), 1000);
+    compareToStd<V>([](V x) { return Vc::log1p(x); }, [](double x) { return std::log1p(x); },
+                    T(-1e-3), T(1e-3));
+    COMPARE(Vc::log1p(V(0)), V(0));
+    COMPARE(Vc::log1p(V(-1)), V(-std::numeric_limits<T>::infinity()));
+    VERIFY(all_of(isnan(Vc::log1p(V(-2)))));
+}
+
+TEST_TYPES(V, testHyperbolic, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const T max = std::is_same<T, float>::value ? 89 : 710;
+    compareToStd<V>([](V x) { return Vc::sinh(x); }, [](double x) { return std::sinh(x); },
+                    -max, max);
+    compareToStd<V>([](V x) { return Vc::sinh(x); }, [](double x) { return std::sinh(x); },
+                    -2, 2);
+    compareToStd<V>([](V x) { return Vc::cosh(x); }, [](double x) { return std::cosh(x); },
+                    -max, max);
+    compareToStd<V>([](V x) { return Vc::cosh(x); }, [](double x) { return std::cosh(x); },
+                    -2, 2);
+    compareToStd<V>([](V x) { return Vc::tanh(x); }, [](double x) { return std::tanh(x); },
+                    -20, 20);
+    compareToStd<V>([](V x) { return Vc::tanh(x); }, [](double x) { return std::tanh(x); },
+                    -1, 1);
+    COMPARE(Vc::sinh(V(0)), V(0));
+    COMPARE(Vc::cosh(V(0)), V(1));
+    COMPARE(Vc::tanh(V(0)), V(0));
+    COMPARE(Vc::tanh(V(1000)), V(1));
+    COMPARE(Vc::tanh(V(-1000)), V(-1));
+    COMPARE(Vc::sinh(V(1000)), V(std::numeric_limits<T>::infinity()));
+    COMPARE(Vc::cosh(V(-1000)), V(std::numeric_limits<T>::infinity()));
+}
+
+TEST_TYPES(V, testCbrt, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    compareToStd<V>([](V x) { return Vc::cbrt(x); }, [](double x) { return std::cbrt(x); },
+                    -1000, 1000);
+    compareToStd<V>([](V x) { return Vc::cbrt(x * x * x * x); },
+                    [](double x) { return std::cbrt(double(T(T(x * x) * T(x * x)))); }, T(-1e-9),
+                    T(1e-9));
+    COMPARE(Vc::cbrt(V(27)), V(3));
+    COMPARE(Vc::cbrt(V(-8)), V(-2));
+    COMPARE(Vc::cbrt(V(0)), V(0));
+}
+
+TEST_TYPES(V, testPow, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    const T inf = std::numeric_limits<T>::infinity();
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * T(100);
+        const V y = (V::Random() - T(0.5)) * T(40);
+        const V reference =
+            V::generate([&](int j) { return T(std::pow(double(x[j]), double(y[j]))); });
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y;
+    }
+    COMPARE(Vc::pow(V(2), V(10)), V(1024));
+    COMPARE(Vc::pow(V(-2), V(3)), V(-8));
+    COMPARE(Vc::pow(V(-2), V(2)), V(4));
+    VERIFY(all_of(isnan(Vc::pow(V(-2), V(0.5)))));
+    COMPARE(Vc::pow(V(0), V(-1)), V(inf));
+    COMPARE(Vc::pow(V(0), V(2)), V(0));
+    COMPARE(Vc::pow(V(inf), V(-1)), V(0));
+    COMPARE(Vc::pow(V(-1), V(inf)), V(1));
+    COMPARE(Vc::pow(V(std::numeric_limits<T>::quiet_NaN()), V(0)), V(1));
+}
+
+TEST_TYPES(V, testErf, RealTypes) //{{{1
+{
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(3);
+    compareToStd<V>([](V x) { return Vc::erf(x); }, [](double x) { return std::erf(x); },
+                    -6, 6);
+    compareToStd<V>([](V x) { return Vc::erf(x); }, [](double x) { return std::erf(x); },
+                    -1, 1);
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(4);
+    compareToStd<V>([](V x) { return Vc::erfc(x); }, [](double x) { return std::erfc(x); },
+                    -6, 26);
+    compareToStd<V>([](V x) { return Vc::erfc(x); }, [](double x) { return std::erfc(x); },
+                    -1, 1);
+    COMPARE(Vc::erf(V(0)), V(0));
+    COMPARE(Vc::erf(V(100)), V(1));
+    COMPARE(Vc::erfc(V(100)), V(0));
+    COMPARE(Vc::erfc(V(-100)), V(2));
+}
+
 TEST_TYPES(V, testMax, AllTypes) //{{{1
 {
     typedef typename V::EntryType T;
@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <Vc/span>
 
 using namespace Vc;
 
@@ -262,6 +263,68 @@ TEST_TYPES(V, memoryOperators, AllVectors)
     VERIFY(m1 == m2);
 }
 
+TEST_TYPES(V, memoryExpressions, AllVectors)
+{
+    using T = typename V::EntryType;
+    for (size_t n : {size_t(1), V::Size - 1, V::Size + 1, size_t(129), size_t(70001)}) {
+        if (n == 0) {
+            continue;
+        }
+        Memory<V> a(n), b(n), c(n), d(n);
+        for (size_t i = 0; i < n; ++i) {
+            b[i] = T(i % 7);
+            c[i] = T(i % 5 + 1);
+            d[i] = T(i % 3);
+        }
+        a = b * c + d;
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] + d[i])) << "n: " << n << ", i: " << i;
+        }
+        a = d - b * c;
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(d[i] - b[i] * c[i])) << "n: " << n << ", i: " << i;
+        }
+        a = (b + T(2)) / c - -d;
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(T(b[i] + 2) / c[i] + d[i])) << "n: " << n << ", i: " << i;
+        }
+        a = b;
+        a += b * c;
+        a -= 2 * b;
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] - b[i])) << "n: " << n << ", i: " << i;
+        }
+
+        // spans as operands and destination; the entry before the span is untouched
+        std::vector<T> out(n + 1, T(99));
+        Vc::span<const T, Vc::dynamic_extent> sb(&b[0], n);
+        evaluate(Vc::span<T, Vc::dynamic_extent>(out.data() + 1, n), sb * c + d * sb);
+        COMPARE(out[0], T(99));
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(out[i + 1], T(b[i] * c[i] + d[i] * b[i])) << "n: " << n << ", i: " << i;
+        }
+
+        evaluate(Vc::parallel, a, b * c + d);
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] + d[i])) << "n: " << n << ", i: " << i;
+        }
+        evaluate(Vc::parallel_policy(0, 1000), Vc::span<T, Vc::dynamic_extent>(out.data(), n),
+                 a - d);
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], T(b[i] * c[i])) << "n: " << n << ", i: " << i;
+        }
+    }
+
+    Memory<V, 19> m1, m2;
+    for (int i = 0; i < 19; ++i) {
+        m2[i] = T(i);
+    }
+    m1 = m2 * m2;
+    for (int i = 0; i < 19; ++i) {
+        COMPARE(m1[i], T(i * i));
+    }
+}
+
 TEST_TYPES(V, testCCtor, AllVectors)
 {
     Memory<V> m1(5);
@@ -26,6 +26,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <Vc/random>
+#include <limits>
 
 #ifdef _WIN32
 void bzero(void *p, size_t n) { memset(p, 0, n); }
@@ -133,4 +135,167 @@ template <> void Random_<double_v>::run()
 }
 }  // namespace Tests
 
+// Xoshiro128 {{{1
+static std::uint32_t referenceXoshiro128(std::uint32_t *s)
+{
+    const auto rotl = [](std::uint32_t x, int k) { return (x << k) | (x >> (32 - k)); };
+    const std::uint32_t result = rotl(s[1] * 5, 7) * 9;
+    const std::uint32_t t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 11);
+    return result;
+}
+
+TEST(engineReference)
+{
+    // lane 0 is seeded from two splitmix64 outputs
+    std::uint64_t x = 12345;
+    std::uint32_t s[4];
+    for (int i = 0; i < 4; i += 2) {
+        std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        z ^= z >> 31;
+        s[i] = static_cast<std::uint32_t>(z);
+        s[i + 1] = static_cast<std::uint32_t>(z >> 32);
+    }
+    Vc::Xoshiro128 engine(12345);
+    for (int i = 0; i < 1000; ++i) {
+        const Vc::uint_v r = engine();
+        COMPARE(r[0], referenceXoshiro128(s)) << "i = " << i;
+        for (std::size_t lane = 1; lane < Vc::uint_v::Size; ++lane) {
+            VERIFY(r[lane] != r[0] || r[lane - 1] != r[0]);
+        }
+    }
+}
+
+TEST(engineStreams)
+{
+    Vc::Xoshiro128 a(42), b(42), c(42, 1), d(43);
+    for (int i = 0; i < 100; ++i) {
+        const Vc::uint_v ra = a();
+        COMPARE(ra, b());
+        VERIFY(any_of(ra != c()));
+        VERIFY(any_of(ra != d()));
+    }
+    Vc::Xoshiro128 e(42), f(42, 1);
+    e.long_jump();
+    for (int i = 0; i < 100; ++i) {
+        COMPARE(e(), f());
+    }
+    e.discard(10);
+    for (int i = 0; i < 10; ++i) {
+        f();
+    }
+    COMPARE(e(), f());
+}
+
+template <class V, class T = typename V::EntryType> struct UniformRange {
+    static V draw(Vc::Xoshiro128 &e) { return Vc::uniform<V>(e, T(0), T(63)); }
+    static V bin(const V &x) { return x; }
+};
+template <class V> struct UniformRange<V, float> {
+    static V draw(Vc::Xoshiro128 &e) { return Vc::uniform<V>(e, -1.f, 1.f); }
+    static V bin(const V &x) { return floor((x + 1.f) * 32.f); }
+};
+template <class V> struct UniformRange<V, double> {
+    static V draw(Vc::Xoshiro128 &e) { return Vc::uniform<V>(e, -1., 1.); }
+    static V bin(const V &x) { return floor((x + 1.) * 32.); }
+};
+
+TEST_TYPES(V, engineUniform, concat<AllVectors, SimdArrays<3>, SimdArrays<8>>)
+{
+    using T = typename V::EntryType;
+    enum { NBins = 64, Mean = 20000, MinGood = Mean - Mean / 10, MaxGood = Mean + Mean / 10 };
+    int histogram[NBins] = {};
+    Vc::Xoshiro128 engine(V::Size);
+    for (std::size_t i = 0; i < NBins * Mean / V::Size; ++i) {
+        const V x = UniformRange<V>::draw(engine);
+        VERIFY(all_of(x >= T(std::is_integral<T>::value ? 0 : -1))) << x;
+        VERIFY(all_of(x < T(std::is_integral<T>::value ? 64 : 1))) << x;
+        const V bin = UniformRange<V>::bin(x);
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            ++histogram[static_cast<int>(bin[k])];
+        }
+    }
+    for (int bin = 0; bin < NBins; ++bin) {
+        VERIFY(histogram[bin] > MinGood) << " bin = " << bin << " is " << histogram[bin];
+        VERIFY(histogram[bin] < MaxGood) << " bin = " << bin << " is " << histogram[bin];
+    }
+}
+
+using Uniform64Types =
+    vir::Typelist<Vc::llong_v, Vc::ullong_v, Vc::long_v, Vc::SimdArray<long long, 3>,
+                  Vc::SimdArray<unsigned long long, 8>>;
+TEST_TYPES(V, engineUniform64, Uniform64Types)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    Vc::Xoshiro128 engine(V::Size);
+
+    // every bit of the 64-bit lanes is random
+    V ored = V::Zero(), anded = ~V::Zero();
+    for (int i = 0; i < 1000; ++i) {
+        const V x = Vc::uniform<V>(engine);
+        ored |= x;
+        anded &= x;
+    }
+    COMPARE(ored, ~V::Zero());
+    COMPARE(anded, V::Zero());
+
+    // a range wider than 2^32: 64 bins of 2^36 each
+    enum { NBins = 64, Mean = 20000, MinGood = Mean - Mean / 10, MaxGood = Mean + Mean / 10 };
+    const T base = std::is_signed<T>::value ? T(-(1ll << 41)) : T(1ull << 50);
+    const T last = T(base + ((1ll << 42) - 1));
+    int histogram[NBins] = {};
+    for (std::size_t i = 0; i < NBins * Mean / V::Size; ++i) {
+        const V x = Vc::uniform<V>(engine, base, last);
+        VERIFY(all_of(x >= V(base) && x <= V(last))) << x;
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            ++histogram[static_cast<unsigned long long>(x[k] - base) >> 36];
+        }
+    }
+    for (int bin = 0; bin < NBins; ++bin) {
+        VERIFY(histogram[bin] > MinGood) << " bin = " << bin << " is " << histogram[bin];
+        VERIFY(histogram[bin] < MaxGood) << " bin = " << bin << " is " << histogram[bin];
+    }
+
+    // the complete range of T
+    V ored2 = V::Zero();
+    for (int i = 0; i < 1000; ++i) {
+        ored2 |= Vc::uniform<V>(engine, L::min(), L::max());
+    }
+    COMPARE(ored2, ~V::Zero());
+}
+
+TEST_TYPES(V, engineDistributions,
+           concat<RealVectors, RealSimdArrays<3>, RealSimdArrays<8>>)
+{
+    using T = typename V::EntryType;
+    enum { Samples = 200000 };
+    Vc::Xoshiro128 engine(7, V::Size);
+    double sum = 0, sum2 = 0, esum = 0;
+    for (std::size_t i = 0; i < Samples / V::Size; ++i) {
+        const V n = Vc::normal<V>(engine, T(2), T(3));
+        VERIFY(all_of(isfinite(n))) << n;
+        const V e = Vc::exponential<V>(engine, T(4));
+        VERIFY(all_of(e >= T(0) && isfinite(e))) << e;
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            sum += n[k];
+            sum2 += n[k] * n[k];
+            esum += e[k];
+        }
+    }
+    const double count = Samples / V::Size * V::Size;
+    const double mean = sum / count;
+    const double variance = sum2 / count - mean * mean;
+    VERIFY(std::abs(mean - 2.) < 0.05) << mean;
+    VERIFY(std::abs(variance - 9.) < 0.2) << variance;
+    VERIFY(std::abs(esum / count - 0.25) < 0.005) << esum / count;
+}
+
 // vim: foldmethod=marker
@@ -27,6 +27,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "unittest.h"
 #include "vectormemoryhelper.h"
+#include <list>
+#include <numeric>
+#include <vector>
 
 TEST_TYPES(Vec, testReduceMin, concat<AllVectors, SimdArrayList>) //{{{1
 {
@@ -104,5 +107,122 @@ TEST_TYPES(Vec, testReduceSum, concat<AllVectors, SimdArrayList>) //{{{1
     }
 }
 
+template <class T> std::vector<T> makeData(std::size_t n) //{{{1
+{
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = static_cast<T>((i * 7 + 3) % 11);
+    }
+    return data;
+}
+
+TEST_TYPES(V, simdReduce, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {0, 1, 2, 3, 7, 16, 17, 31, 64, 65, 100, 1001}) {
+        const auto data = makeData<T>(n);
+        const T ref = std::accumulate(data.begin(), data.end(), T(1));
+        COMPARE(Vc::simd_reduce(data.begin(), data.end(), T(1)), ref) << "n: " << n;
+
+        const auto max = [](auto a, auto b) { return Vc::iif(a < b, b, a); };
+        COMPARE(Vc::simd_reduce(data.begin(), data.end(), T(0), max),
+                n == 0 ? T(0) : *std::max_element(data.begin(), data.end()))
+            << "n: " << n;
+
+        const T ref2 = std::accumulate(data.begin(), data.end(), T(0),
+                                       [](T a, T b) { return T(a + b * b); });
+        COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), T(0),
+                                          [](auto a, auto b) { return a + b; },
+                                          [](auto a) { return a * a; }),
+                ref2)
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), data.begin(), T(0)),
+                ref2)
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), data.begin(), T(0),
+                                          [](auto a, auto b) { return a + b; },
+                                          [](auto a, auto b) { return a * b; }),
+                ref2)
+            << "n: " << n;
+    }
+
+    // non-contiguous ranges fall back to a sequential loop
+    std::list<T> l = {T(1), T(2), T(3)};
+    COMPARE(Vc::simd_reduce(l.begin(), l.end()), T(6));
+}
+
+TEST_TYPES(U, simdReduceWideInit, //{{{1
+           vir::Typelist<short, unsigned short, signed char, unsigned char, float>)
+{
+    // the sums overflow U; an init of type T must accumulate in T, like std::reduce
+    using T = typename std::conditional<std::is_floating_point<U>::value, double,
+                                        long long>::type;
+    for (std::size_t n : {0, 1, 17, 100, 100000}) {
+        std::vector<U> data(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<U>(i % 101);
+        }
+        T sum = 0, sum2 = 0;
+        for (U x : data) {
+            sum += x;
+            sum2 += T(x) * T(x);
+        }
+        COMPARE(Vc::simd_reduce(data.begin(), data.end(), T(0)), sum) << "n: " << n;
+        COMPARE(Vc::simd_reduce(data.begin(), data.end(), 1),
+                static_cast<int>(sum + 1))
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), T(0),
+                                          [](auto a, auto b) { return a + b; },
+                                          [](auto a) { return a * a; }),
+                sum2)
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), data.begin(), T(0)),
+                sum2)
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(data.begin(), data.end(), data.begin(), T(0),
+                                          [](auto a, auto b) { return a + b; },
+                                          [](auto a, auto b) { return a * b; }),
+                sum2)
+            << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, simdScan, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {0, 1, 2, 3, 7, 16, 17, 31, 64, 65, 100, 1001}) {
+        const auto data = makeData<T>(n);
+        std::vector<T> ref(n), out(n);
+
+        std::partial_sum(data.begin(), data.end(), ref.begin());
+        COMPARE(Vc::simd_inclusive_scan(data.begin(), data.end(), out.begin()) -
+                    out.begin(),
+                std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref[i]) << "n: " << n << ", i: " << i;
+        }
+
+        // in-place with initial value
+        out = data;
+        Vc::simd_inclusive_scan(out.begin(), out.end(), out.begin(),
+                                [](auto a, auto b) { return a + b; }, T(2));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], T(ref[i] + 2)) << "n: " << n << ", i: " << i;
+        }
+
+        const auto max = [](auto a, auto b) { return Vc::iif(a < b, b, a); };
+        Vc::simd_inclusive_scan(data.begin(), data.end(), out.begin(), max);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], *std::max_element(data.begin(), data.begin() + i + 1));
+        }
+
+        out = data;
+        Vc::simd_exclusive_scan(out.begin(), out.end(), out.begin(), T(3));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], T((i == 0 ? 0 : ref[i - 1]) + 3)) << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
 //}}}1
 // vim: foldmethod=marker
@@ -0,0 +1,198 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/linalg>
+#include <cmath>
+#include <vector>
+
+using namespace Vc;
+
+// Every lane holds a different matrix: A = G · Gᵀ + (l + 1) · I is positive definite.
+template <class T, std::size_t D, std::size_t N> struct Problems {
+    using M = simd_matrix<T, D, D, N>;
+    static constexpr std::size_t L = M::size();
+    std::vector<T> a = std::vector<T>(L * D * D);
+    std::vector<T> f = std::vector<T>(L * D * D);
+
+    Problems()
+    {
+        for (std::size_t l = 0; l < L; ++l) {
+            for (std::size_t i = 0; i < D; ++i) {
+                for (std::size_t j = 0; j < D; ++j) {
+                    double s = i == j ? l + 1. : 0.;
+                    for (std::size_t k = 0; k < D; ++k) {
+                        s += std::sin(i * 3 + k + l) * std::sin(j * 3 + k + l);
+                    }
+                    a[(l * D + i) * D + j] = T(s);
+                    f[(l * D + i) * D + j] = T(std::cos(i + 2 * j + l));
+                }
+            }
+        }
+    }
+};
+
+template <class T> T tolerance() { return std::is_same<T, float>::value ? 1e-4 : 1e-12; }
+
+template <class T, std::size_t D, std::size_t N> void loadStoreMultiply()
+{
+    using M = simd_matrix<T, D, D, N>;
+    constexpr std::size_t L = M::size();
+    const Problems<T, D, N> p;
+    M a, f;
+    a.load(p.a.data());
+    f.load(p.f.data());
+    std::vector<T> stored(L * D * D);
+    a.store(stored.data());
+    COMPARE(stored == p.a, true);
+
+    const M product = f * a;
+    const M sum = f + a;
+    const M difference = f - a;
+    const M t = transposed(f);
+    for (std::size_t l = 0; l < L; ++l) {
+        const T *fl = &p.f[l * D * D];
+        const T *al = &p.a[l * D * D];
+        for (std::size_t i = 0; i < D; ++i) {
+            for (std::size_t j = 0; j < D; ++j) {
+                T ref = 0;
+                for (std::size_t k = 0; k < D; ++k) {
+                    ref += fl[i * D + k] * al[k * D + j];
+                }
+                VERIFY(std::abs(product(i, j)[l] - ref) <= tolerance<T>() * (1 + std::abs(ref)))
+                    << "D: " << D << ", lane: " << l;
+                COMPARE(sum(i, j)[l], fl[i * D + j] + al[i * D + j]);
+                COMPARE(difference(i, j)[l], fl[i * D + j] - al[i * D + j]);
+                COMPARE(t(j, i)[l], fl[i * D + j]);
+            }
+        }
+    }
+    const M id = M::identity();
+    for (std::size_t i = 0; i < D; ++i) {
+        for (std::size_t j = 0; j < D; ++j) {
+            COMPARE(id(i, j), typename M::value_type(T(i == j)));
+        }
+    }
+}
+
+template <class T, std::size_t D, std::size_t N> void similarityTransform()
+{
+    using M = simd_matrix<T, D, D, N>;
+    const Problems<T, D, N> p;
+    M a, f;
+    a.load(p.a.data());
+    f.load(p.f.data());
+    const M sim = similarity_transform(f, a);
+    const M ref = f * a * transposed(f);
+    for (std::size_t i = 0; i < D; ++i) {
+        for (std::size_t j = 0; j < D; ++j) {
+            COMPARE(sim(i, j), sim(j, i));
+            for (std::size_t l = 0; l < M::size(); ++l) {
+                VERIFY(std::abs(sim(i, j)[l] - ref(i, j)[l]) <=
+                       tolerance<T>() * (1 + std::abs(ref(i, j)[l])))
+                    << "D: " << D << ", lane: " << l;
+            }
+        }
+    }
+}
+
+template <class T, std::size_t D, std::size_t N> void choleskyInverseSolve()
+{
+    using M = simd_matrix<T, D, D, N>;
+    using B = simd_matrix<T, D, 2, N>;
+    const Problems<T, D, N> p;
+    M a;
+    a.load(p.a.data());
+    B b;
+    for (std::size_t i = 0; i < D; ++i) {
+        b(i, 0) = typename M::value_type([&](int l) { return T(std::cos(i + l)); });
+        b(i, 1) = typename M::value_type([&](int l) { return T(i) - T(l); });
+    }
+
+    const auto chol = cholesky(a);
+    VERIFY(all_of(chol.positive_definite()));
+    const M &l = chol.matrix_l();
+    const M llt = l * transposed(l);
+    const M inv = inverse_spd(a);
+    const M id = a * inv;
+    const B x = solve_spd(a, b);
+    const B ax = a * x;
+    for (std::size_t i = 0; i < D; ++i) {
+        for (std::size_t j = 0; j < D; ++j) {
+            COMPARE(inv(i, j), inv(j, i));
+            for (std::size_t lane = 0; lane < M::size(); ++lane) {
+                if (j > i) {
+                    COMPARE(l(i, j)[lane], T(0));
+                }
+                VERIFY(std::abs(llt(i, j)[lane] - a(i, j)[lane]) <=
+                       tolerance<T>() * (1 + std::abs(a(i, j)[lane])));
+                VERIFY(std::abs(id(i, j)[lane] - T(i == j)) <= 10 * tolerance<T>())
+                    << "D: " << D << ", lane: " << lane << ", i: " << i << ", j: " << j;
+            }
+        }
+        for (std::size_t c = 0; c < 2; ++c) {
+            for (std::size_t lane = 0; lane < M::size(); ++lane) {
+                VERIFY(std::abs(ax(i, c)[lane] - b(i, c)[lane]) <= 10 * tolerance<T>());
+            }
+        }
+    }
+
+    // a lane that is not positive definite does not affect the others
+    M bad = a;
+    bad(0, 0)[M::size() - 1] = T(-1);
+    const auto badChol = cholesky(bad);
+    const M badInv = badChol.inverse();
+    for (std::size_t lane = 0; lane < M::size(); ++lane) {
+        COMPARE(badChol.positive_definite()[lane], lane + 1 != M::size());
+        if (lane + 1 != M::size()) {
+            COMPARE(badInv(1, 1)[lane], inv(1, 1)[lane]);
+        }
+    }
+}
+
+template <class T, std::size_t N> void allSizes()
+{
+    loadStoreMultiply<T, 3, N>();
+    loadStoreMultiply<T, 5, N>();
+    similarityTransform<T, 4, N>();
+    similarityTransform<T, 6, N>();
+    choleskyInverseSolve<T, 3, N>();
+    choleskyInverseSolve<T, 4, N>();
+    choleskyInverseSolve<T, 5, N>();
+    choleskyInverseSolve<T, 6, N>();
+}
+
+TEST_TYPES(T, nativeWidth, concat<float, double>)
+{
+    allSizes<T, 0>();
+}
+
+TEST_TYPES(T, simdArrayWidth, concat<float, double>)
+{
+    allSizes<T, 3>();
+    allSizes<T, 11>();
+}
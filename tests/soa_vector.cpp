@@ -0,0 +1,227 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/soa_vector>
+#include <memory>
+
+using Vc::float_v;
+
+template <class T, class I> struct ParticleT {
+    T x, y, mass;
+    I id;
+    Vc_SIMDIZE_INTERFACE((x, y, mass, id));
+};
+using Particle = ParticleT<float, int>;
+
+static Particle makeParticle(int i) { return {1.f * i, 2.f * i, 0.5f, i}; }
+
+TEST(layout)
+{
+    Vc::soa_vector<Particle> v;
+    VERIFY(v.empty());
+    for (int i = 0; i < 21; ++i) {
+        v.push_back(makeParticle(i));
+    }
+    COMPARE(v.size(), 21u);
+    COMPARE(v.vector_count(), (21 + float_v::size() - 1) / float_v::size());
+    VERIFY(v.capacity() >= 21u);
+    COMPARE(reinterpret_cast<std::uintptr_t>(v.data<0>()) % Vc::MemoryAlignment, 0u);
+    COMPARE(reinterpret_cast<std::uintptr_t>(v.data<3>()) % Vc::MemoryAlignment, 0u);
+    for (int i = 0; i < 21; ++i) {
+        COMPARE(v.data<0>()[i], 1.f * i);
+        COMPARE(v.data<1>()[i], 2.f * i);
+        COMPARE(v.data<3>()[i], i);
+        const Particle p = v[i];
+        COMPARE(p.id, i);
+        COMPARE(v[i].get<2>(), 0.5f);
+    }
+    COMPARE(v.member<1>().size(), 21);
+    COMPARE(v.member<1>()[20], 40.f);
+}
+
+TEST(resize)
+{
+    Vc::soa_vector<Particle> v(3, makeParticle(7));
+    COMPARE(v.size(), 3u);
+    for (int i = 0; i < 3; ++i) {
+        COMPARE(v[i].get<3>(), 7);
+    }
+    v.pop_back();
+    v.resize(5);
+    COMPARE(v.size(), 5u);
+    COMPARE(v[1].get<3>(), 7);
+    COMPARE(v[2].get<3>(), 0);
+    COMPARE(v[4].get<0>(), 0.f);
+    v.resize(40, makeParticle(3));
+    COMPARE(v[4].get<3>(), 0);
+    COMPARE(v[39].get<3>(), 3);
+    v.clear();
+    VERIFY(v.empty());
+}
+
+TEST(vector_access)
+{
+    using V = Vc::simdize<Particle>;
+    Vc::soa_vector<Particle> v;
+    for (int i = 0; i < 3 * int(V::size()); ++i) {
+        v.push_back(makeParticle(i));
+    }
+    const V x = v.vector(1);
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(x.x[i], 1.f * (i + V::size()));
+        COMPARE(x.id[i], int(i + V::size()));
+    }
+    V y = x;
+    y.y = -1.f;
+    v.vector(2) = y;
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(v[i + 2 * V::size()].get<1>(), -1.f);
+        COMPARE(v[i + 2 * V::size()].get<3>(), int(i + V::size()));
+    }
+}
+
+TEST(iterators)
+{
+    Vc::soa_vector<Particle> v{makeParticle(0), makeParticle(1), makeParticle(2)};
+    int n = 0;
+    for (Particle p : v) {
+        COMPARE(p.id, n++);
+    }
+    COMPARE(n, 3);
+    COMPARE(v.end() - v.begin(), 3);
+    *(v.begin() + 1) = makeParticle(5);
+    COMPARE(v[1].get<3>(), 5);
+    const auto &cv = v;
+    COMPARE(static_cast<Particle>(cv.begin()[1]).id, 5);
+}
+
+TEST(mixed_member_types)
+{
+    using T = std::tuple<float, double, short>;
+    Vc::soa_vector<T> v;
+    for (int i = 0; i < 19; ++i) {
+        v.push_back(T{1.f * i, 2. * i, short(i)});
+    }
+    for (std::size_t j = 0; j < v.vector_count(); ++j) {
+        const Vc::simdize<T> x = v.vector(j);
+        for (std::size_t i = 0; i < x.size() && j * x.size() + i < v.size(); ++i) {
+            COMPARE(std::get<1>(x)[i], 2. * (j * x.size() + i));
+            COMPARE(std::get<2>(x)[i], short(j * x.size() + i));
+        }
+    }
+}
+
+TEST(for_each)
+{
+    Vc::soa_vector<Particle> v;
+    for (int i = 0; i < 37; ++i) {
+        v.push_back(makeParticle(i));
+    }
+    Vc::simd_for_each(v.begin() + 3, v.end() - 1, [](auto &p) {
+        p.x += p.mass;
+        p.id = -p.id;
+    });
+    for (int i = 0; i < 37; ++i) {
+        const Particle p = v[i];
+        if (i < 3 || i == 36) {
+            COMPARE(p.x, 1.f * i);
+            COMPARE(p.id, i);
+        } else {
+            COMPARE(p.x, 1.f * i + 0.5f);
+            COMPARE(p.id, -i);
+        }
+    }
+    int sum = 0;
+    Vc::simd_for_each(v.cbegin(), v.cend(), [&](const auto &p) {
+        sum += p.id.sum();
+    });
+    COMPARE(sum, 3 + 36 - (35 * 36 / 2 - 3));
+}
+
+/// Returns storage that is offset by one element from Vc::MemoryAlignment.
+template <class T> struct MisalignedAllocator {
+    using value_type = T;
+    MisalignedAllocator() = default;
+    template <class U> MisalignedAllocator(const MisalignedAllocator<U> &) {}
+    T *allocate(std::size_t n)
+    {
+        return Vc::Allocator<T>().allocate(n + 1) + 1;
+    }
+    void deallocate(T *p, std::size_t n) { Vc::Allocator<T>().deallocate(p - 1, n + 1); }
+    bool operator==(const MisalignedAllocator &) const { return true; }
+    bool operator!=(const MisalignedAllocator &) const { return false; }
+};
+
+TEST(unaligned_allocator)
+{
+    using V = Vc::simdize<Particle>;
+    Vc::soa_vector<Particle, MisalignedAllocator<Particle>> v;
+    for (int i = 0; i < 3 * int(V::size()) + 1; ++i) {
+        v.push_back(makeParticle(i));
+    }
+    if (V::size() > 1) {
+        VERIFY(reinterpret_cast<std::uintptr_t>(v.data<0>()) % Vc::MemoryAlignment != 0);
+    }
+    V x = v.vector(1);
+    COMPARE(x.id[0], int(V::size()));
+    x.y = -1.f;
+    v.vector(2) = x;
+    COMPARE(v[2 * V::size()].get<1>(), -1.f);
+    COMPARE(v[2 * V::size()].get<3>(), int(V::size()));
+    Vc::simd_for_each(v.begin(), v.end(), [](auto &p) { p.id += 1; });
+    COMPARE(v[3 * V::size()].get<3>(), 3 * int(V::size()) + 1);
+}
+
+TEST(soa_array)
+{
+    Vc::soa_array<Particle, 13> a;
+    a.fill(makeParticle(2));
+    COMPARE(a.size(), 13u);
+    COMPARE(reinterpret_cast<std::uintptr_t>(a.data<2>()) % Vc::MemoryAlignment, 0u);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = makeParticle(i);
+    }
+    Vc::simd_for_each(a.begin(), a.end(), [](auto &p) { p.y = p.x * p.x; });
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        COMPARE(a[i].get<1>(), float(i * i));
+    }
+}
+
+TEST(soa_array_free_store)
+{
+    using A = Vc::soa_array<Particle, 13>;
+    std::unique_ptr<A> one(new A);
+    COMPARE(reinterpret_cast<std::uintptr_t>(one->data<2>()) % Vc::MemoryAlignment, 0u);
+    std::unique_ptr<A[]> many(new A[3]);
+    for (int i = 0; i < 3; ++i) {
+        COMPARE(reinterpret_cast<std::uintptr_t>(many[i].data<2>()) % Vc::MemoryAlignment,
+                0u);
+    }
+}
+
+// vim: foldmethod=marker
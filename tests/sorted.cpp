@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <vector>
 
 TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, SimdArrays<3>, SimdArrays<1>>)
 {
@@ -89,4 +90,89 @@ TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, Simd
     }
 }
 
+template <class T> std::vector<T> sortInput(std::size_t n, int pattern)
+{
+    std::vector<T> data(n);
+    std::size_t state = n * 7 + pattern;
+    for (std::size_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        switch (pattern) {
+        case 0:  // random
+            data[i] = static_cast<T>((state >> 40) % 30000);
+            break;
+        case 1:  // many duplicates
+            data[i] = static_cast<T>((state >> 40) % 3);
+            break;
+        case 2:  // sorted
+            data[i] = static_cast<T>(i % 30000);
+            break;
+        default:  // reverse sorted
+            data[i] = static_cast<T>((n - i) % 30000);
+            break;
+        }
+    }
+    return data;
+}
+
+TEST_TYPES(Vec, testSortRange, AllVectors)
+{
+    using T = typename Vec::EntryType;
+    for (std::size_t n : {0, 1, 2, 3, 5, 16, 17, 33, 64, 100, 257, 1000, 4099, 20000}) {
+        for (int pattern = 0; pattern < 4; ++pattern) {
+            auto data = sortInput<T>(n, pattern);
+            auto reference = data;
+            std::sort(reference.begin(), reference.end());
+            Vc::sort(data.begin(), data.end());
+            COMPARE(data == reference, true) << "n: " << n << ", pattern: " << pattern;
+        }
+    }
+}
+
+TEST_TYPES(Vec, testPartialSort, AllVectors)
+{
+    using T = typename Vec::EntryType;
+    for (std::size_t n : {1, 17, 100, 1000, 20000}) {
+        for (std::size_t m : {std::size_t(1), n / 3, n}) {
+            for (int pattern = 0; pattern < 4; ++pattern) {
+                auto data = sortInput<T>(n, pattern);
+                auto reference = data;
+                std::sort(reference.begin(), reference.end());
+                Vc::partial_sort(data.begin(), data.begin() + m, data.end());
+                COMPARE(std::equal(data.begin(), data.begin() + m, reference.begin()),
+                        true)
+                    << "n: " << n << ", m: " << m << ", pattern: " << pattern;
+                std::sort(data.begin(), data.end());
+                COMPARE(data == reference, true);
+            }
+        }
+    }
+}
+
+TEST_TYPES(Vec, testSortByKey, AllVectors)
+{
+    using T = typename Vec::EntryType;
+    for (std::size_t n : {2, 17, 100, 1000, 20000}) {
+        for (int pattern = 0; pattern < 4; ++pattern) {
+            auto keys = sortInput<T>(n, pattern);
+            std::vector<std::pair<T, int>> reference(n);
+            std::vector<int> values(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                values[i] = static_cast<int>(i);
+                reference[i] = {keys[i], values[i]};
+            }
+            Vc::sort_by_key(keys.begin(), keys.end(), values.begin());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(keys[i], reference[values[i]].first) << "i: " << i;
+                if (i > 0) {
+                    VERIFY(!(keys[i] < keys[i - 1])) << "i: " << i;
+                }
+            }
+            std::sort(values.begin(), values.end());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(values[i], int(i));
+            }
+        }
+    }
+}
+
 // vim: foldmethod=marker
@@ -28,6 +28,8 @@
 #include <forward_list>
 #include <list>
 #include <deque>
+#include <atomic>
+#include <stdexcept>
 
 #include "../Vc/common/macros.h"
 
@@ -176,4 +178,113 @@ TEST_TYPES(V, simdForEach, AllVectors)
         for_each(test3);
     }
 }
+TEST_TYPES(V, simdForEachMasked, AllVectors)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::Mask M;
+    for (std::size_t size : {std::size_t(1), V::Size - 1, V::Size, 3 * V::Size + 1}) {
+        if (size == 0) {
+            continue;
+        }
+        std::vector<T> data(size + 1);
+        std::iota(data.begin(), data.end(), T(0));
+
+        // mutable: the tail is one masked iteration with V, inactive lanes are not stored
+        std::size_t calls = 0;
+        std::size_t active = 0;
+        Vc::simd_for_each(data.begin(), data.begin() + size, [&](auto &x, auto k) {
+            static_assert(std::is_same<decltype(x), V &>::value, "");
+            static_assert(std::is_same<decltype(k), M>::value, "");
+            VERIFY(Vc::none_of(!k && x != V::Zero())) << "inactive lanes must be zero";
+            x(k) += T(1);
+            ++calls;
+            active += k.count();
+        });
+        COMPARE(calls, (size + V::Size - 1) / V::Size);
+        COMPARE(active, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(data[i], T(i + 1));
+        }
+        COMPARE(data[size], T(size)) << "masked store wrote past the end";
+
+        // immutable: nothing is written back
+        T sum = 0;
+        Vc::simd_for_each_n(data.begin(), size, [&](auto x, auto k) {
+            static_assert(std::is_same<decltype(x), V>::value, "");
+            sum += x.sum(k);
+            x += T(1);
+        });
+        COMPARE(sum, T(size * (size + 1) / 2));
+        for (std::size_t i = 0; i < size; ++i) {
+            COMPARE(data[i], T(i + 1));
+        }
+    }
+}
+TEST_TYPES(V, simdForEachParallel, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> data(20011);
+    for (unsigned threads : {0u, 1u, 3u}) {
+        for (std::size_t chunk : {std::size_t(0), std::size_t(1), std::size_t(100)}) {
+            std::fill(data.begin(), data.end(), T(1));
+            const Vc::parallel_policy policy(threads, chunk);
+            Vc::simd_for_each(policy, std::next(data.begin()), data.end(),
+                              [](auto &x) { x += 2; });
+            COMPARE(data[0], T(1));
+            for (std::size_t i = 1; i < data.size(); ++i) {
+                COMPARE(data[i], T(3)) << "i: " << i << ", chunk: " << chunk;
+            }
+
+            std::atomic<std::size_t> count(0);
+            std::atomic<int> sum(0);
+            Vc::simd_for_each_n(policy, data.begin() + 3, data.size() - 5, [&](auto x) {
+                count += x.size();
+                sum += int(x.sum());
+            });
+            COMPARE(count.load(), data.size() - 5);
+            COMPARE(sum.load(), int(3 * (data.size() - 5)));
+        }
+    }
+
+    bool caught = false;
+    try {
+        Vc::simd_for_each(Vc::parallel_policy(0, 16), data.begin(), data.end(),
+                          [](auto x) {
+                              if (Vc::any_of(x == T(3))) {
+                                  throw std::runtime_error("expected");
+                              }
+                          });
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    VERIFY(caught);
+}
+
+TEST_TYPES(V, simdForEachPrefetch, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> data(10007);
+    const Vc::prefetch_policy policies[] = {Vc::prefetch, Vc::prefetch_policy(64),
+                                            Vc::PrefetchDefault, Vc::PrefetchCalibrated};
+    for (const auto &policy : policies) {
+        std::fill(data.begin(), data.end(), T(1));
+        Vc::simd_for_each(policy, std::next(data.begin()), data.end(),
+                          [](auto &x) { x += 2; });
+        COMPARE(data[0], T(1));
+        for (std::size_t i = 1; i < data.size(); ++i) {
+            COMPARE(data[i], T(3)) << "i: " << i;
+        }
+
+        std::size_t count = 0;
+        T sum = 0;
+        Vc::simd_for_each_n(policy, data.begin() + 3, 1000, [&](auto x, auto k) {
+            count += k.count();
+            sum += x.sum(k);
+        });
+        COMPARE(count, 1000u);
+        COMPARE(sum, T(3000));
+    }
+    VERIFY(Vc::prefetch_policy(Vc::PrefetchCalibrated).distance == 0);
+    COMPARE(Vc::prefetch_policy(Vc::Prefetch<4096>()).distance, 4096u);
+}
 #endif
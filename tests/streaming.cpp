@@ -0,0 +1,128 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <vector>
+
+using namespace Vc;
+
+// sizes below and above the streaming threshold, in bytes
+static const std::size_t byteSizes[] = {0, 1, 7, 100, 4095, 4 << 20, (4 << 20) + 77};
+
+template <class T> std::vector<T> makeInput(std::size_t size)
+{
+    std::vector<T> in(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        in[i] = T(i % 113);
+    }
+    return in;
+}
+
+TEST_TYPES(V, streamCopy, AllVectors)
+{
+    using T = typename V::EntryType;
+    for (std::size_t bytes : byteSizes) {
+        const std::size_t count = (bytes + sizeof(T) - 1) / sizeof(T);
+        const std::vector<T> in = makeInput<T>(count + V::Size);
+        // all destination offsets relative to the alignment boundary, plus guard elements
+        for (std::size_t offset = 0; offset < V::Size; ++offset) {
+            std::vector<T> out(count + V::Size + 2, T(-1));
+            T *const d_first = out.data() + 1 + offset;
+            COMPARE(stream_copy(in.data() + offset, in.data() + offset + count, d_first),
+                    d_first + count);
+            for (std::size_t i = 0; i < out.size(); ++i) {
+                const T expected = out.data() + i >= d_first && out.data() + i < d_first + count
+                                       ? in[i - 1]
+                                       : T(-1);
+                COMPARE(out[i], expected) << "i: " << i << ", count: " << count
+                                          << ", offset: " << offset;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, streamFill, AllVectors)
+{
+    using T = typename V::EntryType;
+    for (std::size_t bytes : byteSizes) {
+        const std::size_t count = (bytes + sizeof(T) - 1) / sizeof(T);
+        for (std::size_t offset = 0; offset < V::Size; ++offset) {
+            std::vector<T> out(count + V::Size + 2, T(-1));
+            stream_fill(out.data() + 1 + offset, out.data() + 1 + offset + count, T(5));
+            for (std::size_t i = 0; i < out.size(); ++i) {
+                COMPARE(out[i], i > offset && i <= offset + count ? T(5) : T(-1))
+                    << "i: " << i << ", count: " << count << ", offset: " << offset;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, streamTransform, AllVectors)
+{
+    using T = typename V::EntryType;
+    for (std::size_t bytes : byteSizes) {
+        const std::size_t count = (bytes + sizeof(T) - 1) / sizeof(T);
+        const std::vector<T> in = makeInput<T>(count);
+        for (std::size_t offset : {std::size_t(0), std::size_t(1)}) {
+            std::vector<T> out(count + 3, T(-1));
+            T *const d_first = out.data() + 1 + offset;
+            COMPARE(stream_transform(in.data(), in.data() + count, d_first,
+                                     [](V x) { return x * T(2) + T(1); }),
+                    d_first + count);
+            for (std::size_t i = 0; i < count; ++i) {
+                COMPARE(d_first[i], T(in[i] * T(2) + T(1))) << "i: " << i
+                                                            << ", count: " << count;
+            }
+            COMPARE(out[offset], T(-1));
+            COMPARE(out[count + 1 + offset], T(-1));
+        }
+    }
+}
+
+TEST(streamTransformConverting)
+{
+    for (std::size_t count : {std::size_t(0), std::size_t(13), std::size_t(5 << 20)}) {
+        const std::vector<short> in = makeInput<short>(count);
+        std::vector<float> out(count + 1, -1.f);
+        stream_transform(in.data(), in.data() + count, out.data(),
+                         [](short_v x) { return x - short(56); });
+        for (std::size_t i = 0; i < count; ++i) {
+            COMPARE(out[i], float(in[i] - 56)) << "i: " << i;
+        }
+        COMPARE(out[count], -1.f);
+    }
+}
+
+TEST(streamTransformInPlace)
+{
+    std::vector<float> data = makeInput<float>((5 << 20) + 3);
+    stream_transform(data.data(), data.data() + data.size(), data.data(),
+                     [](float_v x) { return x + 1.f; });
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        COMPARE(data[i], float(i % 113) + 1.f) << "i: " << i;
+    }
+}
@@ -116,6 +116,35 @@ TEST_TYPES(V, testAsin, RealTypes) //{{{1
     }
 }
 
+TEST_TYPES(V, testAcos, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * T(2) - T(1);
+        const V ref = x.apply([](T _x) { return T(std::acos(double(_x))); });
+        FUZZY_COMPARE(Vc::acos(x), ref) << " x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::acos(V(1)), V(0));
+    COMPARE(Vc::acos(V(-1)), V(T(M_PI)));
+    VERIFY(all_of(isnan(Vc::acos(V(2)))));
+}
+
+TEST_TYPES(V, testTan, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(3);
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(16384);
+        const V ref = x.apply([](T _x) { return T(std::tan(double(_x))); });
+        FUZZY_COMPARE(Vc::tan(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::tan(-x), -ref) << " x = " << -x << ", i = " << i;
+    }
+    COMPARE(Vc::tan(V(0)), V(0));
+}
+
 const union {
     unsigned int hex;
     float value;
@@ -0,0 +1,134 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/simdize>
+#include <tuple>
+#include <vector>
+
+using namespace Vc;
+
+// every item i needs i % 7 iterations to finish
+TEST_TYPES(V, simdizedState, RealVectors)
+{
+    using T = typename V::EntryType;
+    using State = simdize<std::tuple<T, int>>;  // remaining, iterations
+    using I = worklist_index<State>;
+    using IntV = typename std::decay<decltype(std::get<1>(std::declval<State &>()))>::type;
+
+    for (std::size_t n : {0, 1, 3, 17, 1000}) {
+        std::vector<int> result(n, -1), finished(n, 0);
+        const worklist_statistics stats = simd_worklist<State>(
+            n,
+            [&](const I &items) {
+                for (std::size_t i = 0; i < I::size(); ++i) {
+                    VERIFY(items[i] >= 0 && std::size_t(items[i]) < n) << items;
+                }
+                State s;
+                std::get<0>(s) = simd_cast<V>(items % 7);
+                std::get<1>(s) = 0;
+                return s;
+            },
+            [](State &s) {
+                V &remaining = std::get<0>(s);
+                const typename V::mask_type go = remaining > T(0);
+                where(go) | remaining -= T(1);
+                std::get<1>(s)(simd_cast<typename IntV::mask_type>(go)) += 1;
+                return go;
+            },
+            [&](const State &s, const I &items, const typename I::mask_type &done) {
+                for (int lane : where(done)) {
+                    result[items[lane]] = std::get<1>(s)[lane];
+                    ++finished[items[lane]];
+                }
+            });
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(result[i], int(i % 7)) << "n: " << n << ", i: " << i;
+            COMPARE(finished[i], 1) << "n: " << n << ", i: " << i;
+        }
+        COMPARE(stats.items, n);
+        COMPARE(stats.lanes, V::size());
+        VERIFY(stats.active_lanes <= stats.iterations * stats.lanes);
+        VERIFY(stats.utilization() > 0. && stats.utilization() <= 1.) << stats.utilization();
+        if (n >= 1000) {
+            // refilling keeps all lanes busy except at the very end
+            VERIFY(stats.utilization() > 0.9) << stats.utilization();
+        }
+    }
+}
+
+TEST_TYPES(V, vectorState, RealVectors)
+{
+    using T = typename V::EntryType;
+    using I = worklist_index<V>;
+
+    const std::size_t n = 123;
+    std::vector<T> result(n, T(-1));
+    const worklist_statistics stats = simd_worklist<V>(
+        n, [](const I &items) { return simd_cast<V>(items); },
+        [](V &x) {
+            const typename V::mask_type go = x > T(2);
+            where(go) | x = x * T(0.5);
+            return go;
+        },
+        [&](const V &x, const I &items, const typename I::mask_type &done) {
+            for (int lane : where(done)) {
+                result[items[lane]] = x[lane];
+            }
+        });
+    for (std::size_t i = 0; i < n; ++i) {
+        T expected = T(i);
+        while (expected > T(2)) {
+            expected *= T(0.5);
+        }
+        COMPARE(result[i], expected) << "i: " << i;
+    }
+    COMPARE(stats.items, n);
+    VERIFY(stats.refills >= n / V::size());
+}
+
+TEST(emptyWorklist)
+{
+    using I = worklist_index<float_v>;
+    int calls = 0;
+    const worklist_statistics stats = simd_worklist<float_v>(
+        0,
+        [&](const I &) {
+            ++calls;
+            return float_v();
+        },
+        [&](float_v &) {
+            ++calls;
+            return float_m(true);
+        },
+        [&](const float_v &, const I &, const I::mask_type &) { ++calls; });
+    COMPARE(calls, 0);
+    COMPARE(stats.iterations, 0u);
+    COMPARE(stats.utilization(), 1.);
+}
+
+// vim: foldmethod=marker